@@ -87,6 +87,7 @@ public:
                (this->timed_events_thread_ == b.timed_events_thread()) &&
                (this->discovery_server_thread_ == b.discovery_server_thread()) &&
                (this->typelookup_service_thread_ == b.typelookup_service_thread()) &&
+               (this->persistence_commit_thread_ == b.persistence_commit_thread()) &&
 #if HAVE_SECURITY
                (this->security_log_thread_ == b.security_log_thread()) &&
 #endif // if HAVE_SECURITY
@@ -465,6 +466,37 @@ public:
         typelookup_service_thread_ = value;
     }
 
+    /**
+     * Getter for persistence commit ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    rtps::ThreadSettings& persistence_commit_thread()
+    {
+        return persistence_commit_thread_;
+    }
+
+    /**
+     * Getter for persistence commit ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    const rtps::ThreadSettings& persistence_commit_thread() const
+    {
+        return persistence_commit_thread_;
+    }
+
+    /**
+     * Setter for the persistence commit ThreadSettings
+     *
+     * @param value New ThreadSettings to be set
+     */
+    void persistence_commit_thread(
+            const rtps::ThreadSettings& value)
+    {
+        persistence_commit_thread_ = value;
+    }
+
 #if HAVE_SECURITY
     /**
      * Getter for security log ThreadSettings
@@ -540,6 +572,9 @@ private:
     //! Thread settings for the builtin TypeLookup service requests and replies threads
     rtps::ThreadSettings typelookup_service_thread_;
 
+    //! Thread settings for the threads storing the changes of the persistence services with asynchronous commit
+    rtps::ThreadSettings persistence_commit_thread_;
+
 #if HAVE_SECURITY
     //! Thread settings for the security log thread
     rtps::ThreadSettings security_log_thread_;
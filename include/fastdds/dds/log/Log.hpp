@@ -15,8 +15,10 @@
 #ifndef _FASTDDS_DDS_LOG_LOG_HPP_
 #define _FASTDDS_DDS_LOG_LOG_HPP_
 
+#include <cstdint>
 #include <regex>
 #include <sstream>
+#include <string>
 
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/fastdds_dll.hpp>
@@ -184,13 +186,56 @@ public:
      *  * EPROSIMA_LOG_WARNING(cat, msg);
      *  * EPROSIMA_LOG_ERROR(cat, msg);
      *
-     * @todo this method takes 2 mutexes (same mutex) internally.
-     * This is a very high sensible point of the code and it should be refactored to be as efficient as possible.
+     * Category and filename filters are applied on the logging thread.
      */
     FASTDDS_EXPORTED_API static void QueueLog(
             const std::string& message,
             const Log::Context&,
             Log::Kind);
+
+    /**
+     * Not recommended to call this method directly! Use the logging macros.
+     *
+     * Entries are added to a queue owned by the calling thread, so this method does not take any lock
+     * unless the logging thread has to be woken up.
+     * The message is formatted by the caller. The macros only skip formatting it when the category and filename
+     * filters reject the call site, and move the resulting string into the queue.
+     *
+     * @param message   Formatted message of the entry.
+     * @param context   Context of the entry.
+     * @param kind      Kind of the entry.
+     * @param category  Identifier returned by RegisterCategory for the category and filename of the context.
+     *                  Category and filename filters are supposed to have been checked with IsCategoryEnabled.
+     */
+    FASTDDS_EXPORTED_API static void QueueLog(
+            std::string&& message,
+            const Log::Context& context,
+            Log::Kind kind,
+            uint32_t category);
+
+    /**
+     * Not recommended to call this method directly! Used by the logging macros to register their category.
+     * It can be called from a LogConsumer, as it does not take the lock held while consumers run.
+     *
+     * @param category  Category of the log call site.
+     * @param filename  Source file of the log call site.
+     *
+     * @return An identifier to be used on IsCategoryEnabled.
+     */
+    FASTDDS_EXPORTED_API static uint32_t RegisterCategory(
+            const char* category,
+            const char* filename);
+
+    /**
+     * Not recommended to call this method directly! Used by the logging macros to check the category and
+     * filename filters before formatting the message.
+     *
+     * @param category  Identifier returned by RegisterCategory.
+     *
+     * @return whether the current filters allow logging on the category.
+     */
+    FASTDDS_EXPORTED_API static bool IsCategoryEnabled(
+            uint32_t category);
 };
 
 //! Streams Log::Kind serialization
@@ -290,11 +335,16 @@ protected:
 
 #define EPROSIMA_LOG_ERROR_IMPL_(cat, msg)                                                                             \
     do {                                                                                                               \
-        std::stringstream fastdds_log_ss_tmp__;                                                                        \
-        fastdds_log_ss_tmp__ << msg;                                                                                   \
-        eprosima::fastdds::dds::Log::QueueLog(                                                                         \
-            fastdds_log_ss_tmp__.str(), eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat},      \
-            eprosima::fastdds::dds::Log::Kind::Error);                                                                 \
+        static const uint32_t fastdds_log_cat_tmp__ =                                                                  \
+                eprosima::fastdds::dds::Log::RegisterCategory(#cat, __FILE__);                                         \
+        if (eprosima::fastdds::dds::Log::IsCategoryEnabled(fastdds_log_cat_tmp__))                                     \
+        {                                                                                                              \
+            std::stringstream fastdds_log_ss_tmp__;                                                                    \
+            fastdds_log_ss_tmp__ << msg;                                                                               \
+            eprosima::fastdds::dds::Log::QueueLog(                                                                     \
+                fastdds_log_ss_tmp__.str(), eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat},  \
+                eprosima::fastdds::dds::Log::Kind::Error, fastdds_log_cat_tmp__);                                      \
+        }                                                                                                              \
     } while (0)
 
 #elif (__INTERNALDEBUG || _INTERNALDEBUG)
@@ -323,11 +373,17 @@ protected:
     do {                                                                                                              \
         if (eprosima::fastdds::dds::Log::GetVerbosity() >= eprosima::fastdds::dds::Log::Kind::Warning)                \
         {                                                                                                             \
-            std::stringstream fastdds_log_ss_tmp__;                                                                   \
-            fastdds_log_ss_tmp__ << msg;                                                                              \
-            eprosima::fastdds::dds::Log::QueueLog(                                                                    \
-                fastdds_log_ss_tmp__.str(), eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat}, \
-                eprosima::fastdds::dds::Log::Kind::Warning);                                                          \
+            static const uint32_t fastdds_log_cat_tmp__ =                                                             \
+                    eprosima::fastdds::dds::Log::RegisterCategory(#cat, __FILE__);                                    \
+            if (eprosima::fastdds::dds::Log::IsCategoryEnabled(fastdds_log_cat_tmp__))                                \
+            {                                                                                                         \
+                std::stringstream fastdds_log_ss_tmp__;                                                               \
+                fastdds_log_ss_tmp__ << msg;                                                                          \
+                eprosima::fastdds::dds::Log::QueueLog(                                                                \
+                    fastdds_log_ss_tmp__.str(),                                                                       \
+                    eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat},                         \
+                    eprosima::fastdds::dds::Log::Kind::Warning, fastdds_log_cat_tmp__);                               \
+            }                                                                                                         \
         }                                                                                                             \
     } while (0)
 
@@ -362,11 +418,17 @@ protected:
     do {                                                                                                              \
         if (eprosima::fastdds::dds::Log::GetVerbosity() >= eprosima::fastdds::dds::Log::Kind::Info)                   \
         {                                                                                                             \
-            std::stringstream fastdds_log_ss_tmp__;                                                                   \
-            fastdds_log_ss_tmp__ << msg;                                                                              \
-            eprosima::fastdds::dds::Log::QueueLog(                                                                    \
-                fastdds_log_ss_tmp__.str(), eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat}, \
-                eprosima::fastdds::dds::Log::Kind::Info);                                                             \
+            static const uint32_t fastdds_log_cat_tmp__ =                                                             \
+                    eprosima::fastdds::dds::Log::RegisterCategory(#cat, __FILE__);                                    \
+            if (eprosima::fastdds::dds::Log::IsCategoryEnabled(fastdds_log_cat_tmp__))                                \
+            {                                                                                                         \
+                std::stringstream fastdds_log_ss_tmp__;                                                               \
+                fastdds_log_ss_tmp__ << msg;                                                                          \
+                eprosima::fastdds::dds::Log::QueueLog(                                                                \
+                    fastdds_log_ss_tmp__.str(),                                                                       \
+                    eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat},                         \
+                    eprosima::fastdds::dds::Log::Kind::Info, fastdds_log_cat_tmp__);                                  \
+            }                                                                                                         \
         }                                                                                                             \
     } while (0)
 
@@ -315,6 +315,17 @@ public:
     FASTDDS_EXPORTED_API ReturnCode_t wait_for_acknowledgments(
             const fastdds::Duration_t& max_wait);
 
+    /**
+     * Waits the current thread until the samples written, and those removed from the history, are stored by the
+     * persistence service of the DataWriter.
+     * With property dds.persistence.async_commit, write returns before the sample is stored, so the samples written
+     * after the last call to this method may be lost if the process ends abruptly.
+     *
+     * @return RETCODE_OK if all of them were stored, or the DataWriter has no persistence service,
+     * RETCODE_NOT_ENABLED if the DataWriter is not enabled, and RETCODE_ERROR otherwise
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t flush_persistent_changes();
+
     /**
      * @brief Returns the offered deadline missed status
      *
@@ -563,6 +574,22 @@ public:
     FASTDDS_EXPORTED_API ReturnCode_t get_sending_locators(
             rtps::LocatorList& locators) const;
 
+    /**
+     * @brief Get the number of writer-side content filter evaluations performed by this DataWriter.
+     *
+     * Matched readers using the built-in DDS-SQL filter with the same expression and parameters share a single
+     * evaluation of the filter for each sample written.
+     *
+     * @param [out] evaluations        Number of filter evaluations performed.
+     * @param [out] evaluations_saved  Number of filter evaluations saved by sharing the result of another reader.
+     *
+     * @return NOT_ENABLED if the writer has not been enabled.
+     * @return OK otherwise. Both counters are 0 when writer-side filtering is disabled.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t get_content_filter_evaluations(
+            uint64_t& evaluations,
+            uint64_t& evaluations_saved) const;
+
     /**
      * Block the current thread until the writer has received the acknowledgment corresponding to the given instance.
      * Operations performed on the same instance while the current thread is waiting will not be taken into
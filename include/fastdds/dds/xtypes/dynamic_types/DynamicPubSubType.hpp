@@ -15,6 +15,8 @@
 #ifndef FASTDDS_DDS_XTYPES_DYNAMIC_TYPES_DYNAMIC_PUB_SUB_TYPE_HPP
 #define FASTDDS_DDS_XTYPES_DYNAMIC_TYPES_DYNAMIC_PUB_SUB_TYPE_HPP
 
+#include <memory>
+
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <fastdds/dds/topic/TopicDataType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/Types.hpp>
@@ -22,6 +24,11 @@
 
 namespace eprosima {
 namespace fastdds {
+
+namespace rtps {
+class KeyHashCache;
+} // namespace rtps
+
 namespace dds {
 
 class DynamicType;
@@ -33,13 +40,17 @@ class DynamicPubSubType : public virtual eprosima::fastdds::dds::TopicDataType
 
     unsigned char* key_buffer_ {nullptr};
 
+    size_t key_buffer_size_ {0};
+
     MD5 md5_;
 
+    std::unique_ptr<rtps::KeyHashCache> key_hash_cache_;
+
 public:
 
     //{{{ Public functions
 
-    FASTDDS_EXPORTED_API DynamicPubSubType() = default;
+    FASTDDS_EXPORTED_API DynamicPubSubType();
 
     /*
      * Constructs a @ref DynamicPubSubType from a @ref DynamicType
@@ -140,6 +151,15 @@ public:
     FASTDDS_EXPORTED_API ReturnCode_t set_dynamic_type(
             traits<DynamicType>::ref_type type);
 
+    /*
+     * Keeps the instance handles of the last keys hashed with MD5, so repeated keys skip computing it again
+     * @param max_entries Maximum number of keys kept. 0 disables the cache, which is the default.
+     * @remark Only available for dynamic types. Types generated with Fast DDS-Gen compute their keys on their own
+     * TopicDataType implementation, which does not use this cache.
+     */
+    FASTDDS_EXPORTED_API void set_key_hash_cache_size(
+            uint32_t max_entries);
+
     //Register TypeObject representation in Fast DDS TypeObjectRegistry
     FASTDDS_EXPORTED_API void register_type_object_representation() override;
 
@@ -442,7 +442,8 @@ public:
 #endif // if HAVE_SECURITY
                (this->discovery_server_thread == b.discovery_server_thread) &&
                (this->typelookup_service_thread == b.typelookup_service_thread) &&
-               (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads);
+               (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads) &&
+               (this->persistence_commit_thread == b.persistence_commit_thread);
 
     }
 
@@ -557,6 +558,9 @@ public:
     //! Thread settings for the builtin transports reception threads
     fastdds::rtps::ThreadSettings builtin_transports_reception_threads;
 
+    //! Thread settings for the threads storing the changes of the persistence services with asynchronous commit
+    fastdds::rtps::ThreadSettings persistence_commit_thread;
+
 #if HAVE_SECURITY
     //! Thread settings for the security log thread
     fastdds::rtps::ThreadSettings security_log_thread;
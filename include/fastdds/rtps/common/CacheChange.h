@@ -21,6 +21,7 @@
 
 #include <atomic>
 #include <cassert>
+#include <vector>
 
 #include <fastdds/rtps/common/ChangeKind_t.hpp>
 #include <fastdds/rtps/common/FragmentNumber.h>
@@ -152,6 +153,7 @@ struct FASTDDS_EXPORTED_API CacheChange_t
         fragment_size_ = ch_ptr->fragment_size_;
         fragment_count_ = ch_ptr->fragment_count_;
         first_missing_fragment_ = ch_ptr->first_missing_fragment_;
+        missing_fragments_ = ch_ptr->missing_fragments_;
 
         return serializedPayload.copy(&ch_ptr->serializedPayload, !ch_ptr->is_untyped_);
     }
@@ -253,6 +255,7 @@ struct FASTDDS_EXPORTED_API CacheChange_t
         fragment_size_ = fragment_size;
         fragment_count_ = 0;
         first_missing_fragment_ = 0;
+        missing_fragments_.clear();
 
         if (fragment_size > 0)
         {
@@ -261,12 +264,13 @@ struct FASTDDS_EXPORTED_API CacheChange_t
 
             if (create_fragment_list)
             {
-                // Keep index of next fragment on the payload portion at the beginning of each fragment. Last
-                // fragment will have fragment_count_ as 'next fragment index'
-                size_t offset = 0;
-                for (uint32_t i = 1; i <= fragment_count_; i++, offset += fragment_size_)
+                // All fragments are missing. The bitmap is kept apart from the payload, so the fragments can be
+                // written directly at their final position in any order.
+                missing_fragments_.assign((fragment_count_ + 31u) / 32u, 0xFFFFFFFFu);
+                uint32_t last_bits = fragment_count_ % 32u;
+                if (0 != last_bits)
                 {
-                    set_next_missing_fragment(i - 1, i);  // index to next fragment in missing list
+                    missing_fragments_.back() = ~(0xFFFFFFFFu >> last_bits);
                 }
             }
             else
@@ -332,34 +336,57 @@ private:
     // First fragment in missing list
     uint32_t first_missing_fragment_ = 0;
 
+    // Bitmap of missing fragments, one bit per fragment starting with the most significant bit of the first word
+    std::vector<uint32_t> missing_fragments_;
+
     uint32_t get_next_missing_fragment(
             uint32_t fragment_index)
     {
-        uint32_t* ptr = next_fragment_pointer(fragment_index);
-        return *ptr;
+        return find_missing_fragment(fragment_index + 1u);
     }
 
-    void set_next_missing_fragment(
-            uint32_t fragment_index,
-            uint32_t next_fragment_index)
+    /*!
+     * Find the first missing fragment starting at a given one.
+     *
+     * @param fragment_index Index (0-based) of the first fragment to check.
+     * @return Index of the first missing fragment not lower than fragment_index, fragment_count_ if there is none.
+     */
+    uint32_t find_missing_fragment(
+            uint32_t fragment_index) const
     {
-        uint32_t* ptr = next_fragment_pointer(fragment_index);
-        *ptr = next_fragment_index;
-    }
+        size_t word = fragment_index / 32u;
+        if (word < missing_fragments_.size())
+        {
+            uint32_t bits = missing_fragments_[word] & (0xFFFFFFFFu >> (fragment_index % 32u));
+            while (true)
+            {
+                if (bits)
+                {
+                    // Index of the highest bit set, as in BitmapRange::min()
+#if _MSC_VER
+                    unsigned long bit;
+                    _BitScanReverse(&bit, bits);
+                    uint32_t offset = 31u ^ bit;
+#else
+                    uint32_t offset = static_cast<uint32_t>(__builtin_clz(bits));
+#endif // if _MSC_VER
+                    return static_cast<uint32_t>(word * 32u) + offset;
+                }
 
-    uint32_t* next_fragment_pointer(
-            uint32_t fragment_index)
-    {
-        size_t offset = fragment_size_;
-        offset *= fragment_index;
-        offset = (offset + 3u) & ~3u;
-        return reinterpret_cast<uint32_t*>(&serializedPayload.data[offset]);
+                if (++word >= missing_fragments_.size())
+                {
+                    break;
+                }
+                bits = missing_fragments_[word];
+            }
+        }
+
+        return fragment_count_;
     }
 
     /*!
      * Mark a set of consecutive fragments as received.
      * This will remove a set of consecutive fragments from the missing list.
-     * Should be called BEFORE copying the received data into the serialized payload.
      *
      * @param initial_fragment Index (0-based) of first received fragment.
      * @param num_of_fragments Number of received fragments. Should be strictly positive.
@@ -371,7 +398,7 @@ private:
     {
         bool at_least_one_changed = false;
 
-        if ((fragment_size_ > 0) && (initial_fragment < fragment_count_))
+        if ((fragment_size_ > 0) && (initial_fragment < fragment_count_) && !missing_fragments_.empty())
         {
             uint32_t last_fragment = initial_fragment + num_of_fragments;
             if (last_fragment > fragment_count_)
@@ -379,42 +406,35 @@ private:
                 last_fragment = fragment_count_;
             }
 
-            if (initial_fragment <= first_missing_fragment_)
+            uint32_t fragment = initial_fragment;
+            while (fragment < last_fragment)
             {
-                // Perform first = *first until first >= last_received
-                while (first_missing_fragment_ < last_fragment)
+                uint32_t first_bit = fragment % 32u;
+                uint32_t end_bit = first_bit + (last_fragment - fragment);
+                if (end_bit > 32u)
                 {
-                    first_missing_fragment_ = get_next_missing_fragment(first_missing_fragment_);
+                    end_bit = 32u;
+                }
+
+                uint32_t mask = 0xFFFFFFFFu >> first_bit;
+                if (end_bit < 32u)
+                {
+                    mask &= ~(0xFFFFFFFFu >> end_bit);
+                }
+
+                uint32_t& bits = missing_fragments_[fragment / 32u];
+                if (bits & mask)
+                {
+                    bits &= ~mask;
                     at_least_one_changed = true;
                 }
+                fragment += end_bit - first_bit;
             }
-            else
+
+            if (at_least_one_changed && (initial_fragment <= first_missing_fragment_) &&
+                    (first_missing_fragment_ < last_fragment))
             {
-                // Find prev in missing list
-                uint32_t current_frag = first_missing_fragment_;
-                while (current_frag < initial_fragment)
-                {
-                    uint32_t next_frag = get_next_missing_fragment(current_frag);
-                    if (next_frag >= initial_fragment)
-                    {
-                        // This is the fragment previous to initial_fragment.
-                        // Find future value for next by repeating next = *next until next >= last_fragment.
-                        uint32_t next_missing_fragment = next_frag;
-                        while (next_missing_fragment < last_fragment)
-                        {
-                            next_missing_fragment = get_next_missing_fragment(next_missing_fragment);
-                            at_least_one_changed = true;
-                        }
-
-                        // Update next and finish loop
-                        if (at_least_one_changed)
-                        {
-                            set_next_missing_fragment(current_frag, next_missing_fragment);
-                        }
-                        break;
-                    }
-                    current_frag = next_frag;
-                }
+                first_missing_fragment_ = find_missing_fragment(last_fragment);
             }
         }
 
@@ -55,9 +55,26 @@ struct FlowControllerDescriptor
     //! Default value: 100ms.
     uint64_t period_ms = 100;
 
+    //! Maximum number of bytes that can be sent back-to-back.
+    //!
+    //! When greater than 0, max_bytes_per_period is enforced with a token bucket of this size, refilled continuously
+    //! at a rate of max_bytes_per_period every period_ms. This spreads the datagrams evenly inside the period instead
+    //! of sending the whole budget at its beginning. It also limits the maximum payload of each datagram.
+    //! Range of bytes: [1, max_bytes_per_period];
+    //! 0 value means the budget is reset at the beginning of each period.
+    //! Default value: 0
+    int32_t max_burst_bytes = 0;
+
     //! Thread settings for the sender thread
     ThreadSettings sender_thread;
 
+    //! Number of sender threads.
+    //!
+    //! When greater than 1, the writers are distributed among the sender threads by their GUID, each thread with its
+    //! own queue and scheduler. The bandwidth limitation applies to all the sender threads together.
+    //! Default value: 1
+    uint32_t num_sender_threads = 1;
+
 };
 
 } // namespace rtps
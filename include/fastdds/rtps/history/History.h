@@ -26,6 +26,7 @@
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/utils/collections/RingVector.hpp>
 #include <fastdds/utils/TimedMutex.hpp>
 
 #include <cassert>
@@ -55,9 +56,10 @@ protected:
 
 public:
 
-    using iterator = std::vector<CacheChange_t*>::iterator;
-    using reverse_iterator = std::vector<CacheChange_t*>::reverse_iterator;
-    using const_iterator = std::vector<CacheChange_t*>::const_iterator;
+    using ChangeCollection = RingVector<CacheChange_t*>;
+    using iterator = ChangeCollection::iterator;
+    using reverse_iterator = ChangeCollection::reverse_iterator;
+    using const_iterator = ChangeCollection::const_iterator;
 
     //!Attributes of the History
     HistoryAttributes m_att;
@@ -259,8 +261,8 @@ public:
 
 protected:
 
-    //!Vector of pointers to the CacheChange_t.
-    std::vector<CacheChange_t*> m_changes;
+    //!Pointers to the CacheChange_t, on a ring so the oldest ones can be removed in constant time.
+    ChangeCollection m_changes;
 
     //!Variable to know if the history is full without needing to block the History mutex.
     bool m_isHistoryFull = false;
@@ -59,6 +59,9 @@ namespace rtps {
  *
  * - \c tcp_negotiation_timeout: time to wait for logical port negotiation (in ms).
  *
+ * - \c reactor_threads: number of threads receiving from all the TCP connections. When 0, each connection has its
+ *      own reception thread.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct TCPTransportDescriptor : public SocketTransportDescriptor
@@ -296,6 +299,21 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
      */
     bool non_blocking_send;
 
+    /**
+     * Number of threads receiving the messages of all the TCP connections.
+     *
+     * When set to 0, which is the default, each connection has its own reception thread, blocked reading from its
+     * socket. This does not scale to a large number of connections (e.g. a discovery server with thousands of
+     * clients).
+     *
+     * When greater than 0, the connections are read asynchronously by this fixed number of threads, which are
+     * created with the \c default_reception_threads settings. Each connection reassembles its messages on its own
+     * buffer, and they are delivered from the thread that completed their reception.
+     * These threads only run the receptions: accepting and connecting sockets is still done on the accept thread.
+     * Connections using TLS always have their own reception thread.
+     */
+    uint32_t reactor_threads;
+
     //! Add listener port to the listening_ports list
     void add_listener_port(
             uint16_t port)
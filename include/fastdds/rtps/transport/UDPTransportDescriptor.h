@@ -31,6 +31,10 @@ namespace rtps {
  * immediately if the buffer is full, but no error will be returned to the upper layer. This means that the
  * application will behave as if the datagram is sent and lost.
  *
+ * - \c receive_batch_size: maximum number of datagrams drained from an input socket on each receive operation.
+ *
+ * - \c send_batch_size: maximum number of datagrams pushed to an output socket on each send operation.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct UDPTransportDescriptor : public SocketTransportDescriptor
@@ -68,6 +72,32 @@ struct UDPTransportDescriptor : public SocketTransportDescriptor
      * datagram. This may hinder performance on high-frequency writers.
      */
     bool non_blocking_send = false;
+
+    /**
+     * Maximum number of datagrams to read from an input socket on each receive operation.
+     *
+     * When set to a value greater than 1, and the platform supports it (i.e. Linux), the reception threads will
+     * drain up to this number of datagrams with a single recvmmsg() call, using a ring of pre-allocated buffers
+     * of \c maxMessageSize bytes each. This reduces the number of system calls and thread wake-ups per datagram
+     * on high-rate topics, at the cost of \c receive_batch_size * \c maxMessageSize bytes of memory per input
+     * channel.
+     *
+     * When set to 0 or 1, datagrams are received one by one.
+     * The transport fails to initialize when this value is greater than 1024.
+     */
+    uint32_t receive_batch_size = 1;
+
+    /**
+     * Maximum number of datagrams to push to an output socket on each send operation.
+     *
+     * When set to a value greater than 1, and the platform supports it (i.e. Linux), the datagrams that a single
+     * send operation addresses to several destination locators (e.g. one RTPS message flushed to many unicast
+     * readers) are queued and sent with a single sendmmsg() call, instead of one send_to() call per destination.
+     *
+     * When set to 0 or 1, one system call is performed per destination.
+     * The transport fails to initialize when this value is greater than 1024.
+     */
+    uint32_t send_batch_size = 1;
 };
 
 } // namespace rtps
@@ -39,6 +39,9 @@ class TransportInterface;
  *
  * - rtps_dump_file_: full path of the protocol dump file.
  *
+ * - listener_spin_time_us_: maximum time (in microseconds) a listener polls its port for new messages
+ *   before blocking on it. 0 disables spinning.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct SharedMemTransportDescriptor : public PortBasedTransportDescriptor
@@ -130,6 +133,24 @@ struct SharedMemTransportDescriptor : public PortBasedTransportDescriptor
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    //! Return the maximum time (us) a listener polls its port before blocking
+    FASTDDS_EXPORTED_API uint32_t listener_spin_time_us() const
+    {
+        return listener_spin_time_us_;
+    }
+
+    /**
+     * Set the maximum time (us) a listener polls its port before blocking.
+     * While a listener is polling, writers do not need to notify it, which reduces latency at the
+     * expense of CPU usage. The actual polling time adapts to the traffic, up to this value.
+     * 0 (default) disables polling.
+     */
+    FASTDDS_EXPORTED_API void listener_spin_time_us(
+            uint32_t listener_spin_time_us)
+    {
+        listener_spin_time_us_ = listener_spin_time_us;
+    }
+
     //! Return the thread settings for the transport dump thread
     FASTDDS_EXPORTED_API ThreadSettings dump_thread() const
     {
@@ -153,6 +174,7 @@ private:
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    uint32_t listener_spin_time_us_;
 
     //! Thread settings for the transport dump thread
     ThreadSettings dump_thread_;
@@ -238,6 +238,15 @@ public:
         return true;
     }
 
+    /**
+     * Waits until the changes added to or removed from the history are stored by the persistence service.
+     * @return True if all of them were stored. Writers without persistence always return true.
+     */
+    FASTDDS_EXPORTED_API virtual bool flush_persistent_changes()
+    {
+        return true;
+    }
+
     /**
      * Update the Attributes of the Writer.
      * @param att New attributes
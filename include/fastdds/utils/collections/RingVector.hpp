@@ -0,0 +1,592 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RingVector.hpp
+ *
+ */
+
+#ifndef FASTDDS_UTILS_COLLECTIONS_RINGVECTOR_HPP_
+#define FASTDDS_UTILS_COLLECTIONS_RINGVECTOR_HPP_
+
+#include <assert.h>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+
+/**
+ * Sequence container stored on a growable circular buffer.
+ *
+ * This template class offers the interface of a std::vector with random access iterators, but elements are kept on
+ * a circular buffer. Adding or removing elements at any of both ends takes constant time, and inserting or erasing
+ * elements in the middle only moves the elements on the shortest side.
+ *
+ * The capacity is always a power of two, and is doubled when a new element does not fit.
+ *
+ * Iterators hold the position of the element on the sequence. Inserting or erasing an element makes the iterators to
+ * that and the following positions (including end()) refer to other elements, while the iterators to the preceding
+ * positions remain valid. As push_front and pop_front change the position of every element, they invalidate all the
+ * iterators.
+ * References and pointers to the elements are invalidated when the element is moved. Inserting or erasing on the
+ * front half of the sequence moves the preceding elements, and doing it on the back half moves the following ones.
+ * Growing the capacity invalidates all of them.
+ *
+ * @tparam _Ty                 Element type. Must be default constructible and move assignable.
+ * @tparam _Alloc              Allocator to use on the underlying collection type, defaults to std::allocator<_Ty>.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <
+    typename _Ty,
+    typename _Alloc = std::allocator<_Ty>>
+class RingVector
+{
+public:
+
+    using collection_type = std::vector<_Ty, _Alloc>;
+    using value_type = _Ty;
+    using allocator_type = _Alloc;
+    using pointer = _Ty*;
+    using const_pointer = const _Ty*;
+    using reference = _Ty&;
+    using const_reference = const _Ty&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /**
+     * Random access iterator, holding the position of the element on the sequence.
+     *
+     * @tparam _IsConst Whether the iterator gives constant access to the elements.
+     */
+    template<bool _IsConst>
+    class iterator_base
+    {
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = RingVector::value_type;
+        using difference_type = RingVector::difference_type;
+        using pointer = typename std::conditional<_IsConst, const_pointer, RingVector::pointer>::type;
+        using reference = typename std::conditional<_IsConst, const_reference, RingVector::reference>::type;
+        using owner_type = typename std::conditional<_IsConst, const RingVector*, RingVector*>::type;
+
+        iterator_base() = default;
+
+        iterator_base(
+                owner_type owner,
+                size_type index)
+            : owner_(owner)
+            , index_(index)
+        {
+        }
+
+        //! Conversion from iterator to const_iterator
+        template<bool _OtherConst, typename = typename std::enable_if<_IsConst && !_OtherConst>::type>
+        iterator_base(
+                const iterator_base<_OtherConst>& other)
+            : owner_(other.owner_)
+            , index_(other.index_)
+        {
+        }
+
+        reference operator *() const
+        {
+            return (*owner_)[index_];
+        }
+
+        pointer operator ->() const
+        {
+            return &(*owner_)[index_];
+        }
+
+        reference operator [](
+                difference_type n) const
+        {
+            return (*owner_)[index_ + n];
+        }
+
+        iterator_base& operator ++()
+        {
+            ++index_;
+            return *this;
+        }
+
+        iterator_base operator ++(
+                int)
+        {
+            iterator_base ret = *this;
+            ++index_;
+            return ret;
+        }
+
+        iterator_base& operator --()
+        {
+            --index_;
+            return *this;
+        }
+
+        iterator_base operator --(
+                int)
+        {
+            iterator_base ret = *this;
+            --index_;
+            return ret;
+        }
+
+        iterator_base& operator +=(
+                difference_type n)
+        {
+            index_ += n;
+            return *this;
+        }
+
+        iterator_base& operator -=(
+                difference_type n)
+        {
+            index_ -= n;
+            return *this;
+        }
+
+        iterator_base operator +(
+                difference_type n) const
+        {
+            return iterator_base(owner_, index_ + n);
+        }
+
+        friend iterator_base operator +(
+                difference_type n,
+                const iterator_base& it)
+        {
+            return it + n;
+        }
+
+        iterator_base operator -(
+                difference_type n) const
+        {
+            return iterator_base(owner_, index_ - n);
+        }
+
+        template<bool _OtherConst>
+        difference_type operator -(
+                const iterator_base<_OtherConst>& rhs) const
+        {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        template<bool _OtherConst>
+        bool operator ==(
+                const iterator_base<_OtherConst>& rhs) const
+        {
+            return index_ == rhs.index_ && owner_ == rhs.owner_;
+        }
+
+        template<bool _OtherConst>
+        bool operator !=(
+                const iterator_base<_OtherConst>& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        template<bool _OtherConst>
+        bool operator <(
+                const iterator_base<_OtherConst>& rhs) const
+        {
+            return index_ < rhs.index_;
+        }
+
+        template<bool _OtherConst>
+        bool operator <=(
+                const iterator_base<_OtherConst>& rhs) const
+        {
+            return index_ <= rhs.index_;
+        }
+
+        template<bool _OtherConst>
+        bool operator >(
+                const iterator_base<_OtherConst>& rhs) const
+        {
+            return index_ > rhs.index_;
+        }
+
+        template<bool _OtherConst>
+        bool operator >=(
+                const iterator_base<_OtherConst>& rhs) const
+        {
+            return index_ >= rhs.index_;
+        }
+
+    private:
+
+        friend class RingVector;
+        template<bool _OtherConst>
+        friend class iterator_base;
+
+        //! Container of the element
+        owner_type owner_ = nullptr;
+        //! Position of the element on the sequence
+        size_type index_ = 0;
+    };
+
+    using iterator = iterator_base<false>;
+    using const_iterator = iterator_base<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * Construct an empty RingVector.
+     *
+     * @param alloc   Allocator object. Forwarded to collection constructor.
+     */
+    RingVector(
+            const allocator_type& alloc = allocator_type())
+        : collection_(alloc)
+    {
+    }
+
+    RingVector(
+            const RingVector& other)
+        : collection_(other.collection_.get_allocator())
+    {
+        reserve(other.size());
+        for (const_reference item : other)
+        {
+            push_back(item);
+        }
+    }
+
+    RingVector& operator = (
+            const RingVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.size());
+            for (const_reference item : other)
+            {
+                push_back(item);
+            }
+        }
+        return *this;
+    }
+
+    virtual ~RingVector() = default;
+
+    /**
+     * Ensure the capacity is at least a number of elements.
+     *
+     * @param new_capacity Number of elements that should fit without reallocating.
+     */
+    void reserve(
+            size_type new_capacity)
+    {
+        if (new_capacity > capacity())
+        {
+            size_type size = 1;
+            while (size < new_capacity)
+            {
+                size <<= 1;
+            }
+            reallocate(size);
+        }
+    }
+
+    reference operator [](
+            size_type pos)
+    {
+        assert(pos < size_);
+        return collection_[(head_ + pos) & mask_];
+    }
+
+    const_reference operator [](
+            size_type pos) const
+    {
+        assert(pos < size_);
+        return collection_[(head_ + pos) & mask_];
+    }
+
+    reference front()
+    {
+        return (*this)[0];
+    }
+
+    const_reference front() const
+    {
+        return (*this)[0];
+    }
+
+    reference back()
+    {
+        return (*this)[size_ - 1];
+    }
+
+    const_reference back() const
+    {
+        return (*this)[size_ - 1];
+    }
+
+    void push_back(
+            const value_type& val)
+    {
+        value_type copy(val);
+        push_back(std::move(copy));
+    }
+
+    void push_back(
+            value_type&& val)
+    {
+        grow_if_full();
+        ++size_;
+        back() = std::move(val);
+    }
+
+    void push_front(
+            const value_type& val)
+    {
+        value_type copy(val);
+        push_front(std::move(copy));
+    }
+
+    void push_front(
+            value_type&& val)
+    {
+        grow_if_full();
+        head_ = (head_ - 1) & mask_;
+        ++size_;
+        front() = std::move(val);
+    }
+
+    void pop_back()
+    {
+        assert(!empty());
+        back() = value_type();
+        --size_;
+    }
+
+    void pop_front()
+    {
+        assert(!empty());
+        front() = value_type();
+        head_ = (head_ + 1) & mask_;
+        --size_;
+    }
+
+    /**
+     * Insert an element before a given position.
+     * The elements on the shortest side of the sequence are moved to make room for it.
+     *
+     * @param pos Iterator to the position where the element will be inserted.
+     * @param val Value to be copied to the collection.
+     *
+     * @return iterator to the inserted element.
+     */
+    iterator insert(
+            const_iterator pos,
+            const value_type& val)
+    {
+        size_type index = pos.index_;
+        assert(index <= size_);
+
+        value_type copy(val);
+        grow_if_full();
+        if (index < size_ / 2)
+        {
+            head_ = (head_ - 1) & mask_;
+            ++size_;
+            for (size_type i = 0; i < index; ++i)
+            {
+                (*this)[i] = std::move((*this)[i + 1]);
+            }
+        }
+        else
+        {
+            ++size_;
+            for (size_type i = size_ - 1; i > index; --i)
+            {
+                (*this)[i] = std::move((*this)[i - 1]);
+            }
+        }
+        (*this)[index] = std::move(copy);
+
+        return iterator(this, index);
+    }
+
+    /**
+     * Remove the element referenced by @c pos.
+     * The elements on the shortest side of the sequence are moved to fill the gap, so removing the first or the
+     * last element takes constant time.
+     *
+     * @param pos Iterator to the element to remove.
+     *
+     * @return iterator to the element following the removed one.
+     */
+    iterator erase(
+            const_iterator pos)
+    {
+        size_type index = pos.index_;
+        assert(index < size_);
+
+        if (index < size_ / 2)
+        {
+            for (size_type i = index; i > 0; --i)
+            {
+                (*this)[i] = std::move((*this)[i - 1]);
+            }
+            pop_front();
+        }
+        else
+        {
+            for (size_type i = index; i + 1 < size_; ++i)
+            {
+                (*this)[i] = std::move((*this)[i + 1]);
+            }
+            pop_back();
+        }
+
+        return iterator(this, index);
+    }
+
+    void clear()
+    {
+        while (!empty())
+        {
+            pop_back();
+        }
+        head_ = 0;
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(this, size_);
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    bool empty() const noexcept
+    {
+        return 0 == size_;
+    }
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return collection_.size();
+    }
+
+    allocator_type get_allocator() const
+    {
+        return collection_.get_allocator();
+    }
+
+private:
+
+    void grow_if_full()
+    {
+        if (size_ == capacity())
+        {
+            reallocate(0 == size_ ? static_cast<size_type>(MIN_CAPACITY) : size_ * 2);
+        }
+    }
+
+    void reallocate(
+            size_type new_capacity)
+    {
+        collection_type new_collection(new_capacity, value_type(), collection_.get_allocator());
+        for (size_type i = 0; i < size_; ++i)
+        {
+            new_collection[i] = std::move((*this)[i]);
+        }
+        collection_.swap(new_collection);
+        head_ = 0;
+        mask_ = new_capacity - 1;
+    }
+
+    static constexpr size_type MIN_CAPACITY = 8;
+
+    //! Underlying storage. Its size is the capacity of the ring, always a power of two.
+    collection_type collection_;
+    //! Position on collection_ of the first element
+    size_type head_ = 0;
+    //! Number of elements
+    size_type size_ = 0;
+    //! Capacity minus one
+    size_type mask_ = 0;
+};
+
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif /* FASTDDS_UTILS_COLLECTIONS_RINGVECTOR_HPP_ */
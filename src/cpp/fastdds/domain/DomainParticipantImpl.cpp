@@ -1841,6 +1841,12 @@ bool DomainParticipantImpl::can_qos_be_updated(
         EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
                 "Participant typelookup_service_thread cannot be changed after the participant is enabled");
     }
+    if (!(to.persistence_commit_thread() == from.persistence_commit_thread()))
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant persistence_commit_thread cannot be changed after the participant is enabled");
+    }
 #if HAVE_SECURITY
     if (!(to.security_log_thread() == from.security_log_thread()))
     {
@@ -12,11 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <fastdds/dds/log/Colors.hpp>
 #include <fastdds/dds/log/Log.hpp>
@@ -24,7 +32,8 @@
 #include <fastdds/dds/log/StdoutConsumer.hpp>
 #include <fastdds/dds/log/StdoutErrConsumer.hpp>
 
-#include <utils/DBQueue.hpp>
+#include "LogRingBuffer.hpp"
+
 #include <utils/SystemInfo.hpp>
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
@@ -44,6 +53,11 @@ struct LogResources
         , functions_(true)
         , verbosity_(Log::Error)
     {
+        for (auto& word : enabled_categories_)
+        {
+            word.store(0, std::memory_order_relaxed);
+        }
+
 #if STDOUTERR_LOG_CONSUMER
         consumers_.emplace_back(new StdoutErrConsumer);
 #else
@@ -112,13 +126,17 @@ struct LogResources
             const std::regex& filter)
     {
         std::unique_lock<std::mutex> configGuard(config_mutex_);
+        std::lock_guard<std::mutex> categories_guard(categories_mutex_);
         category_filter_.reset(new std::regex(filter));
+        update_categories();
     }
 
     void UnsetCategoryFilter()
     {
         std::unique_lock<std::mutex> configGuard(config_mutex_);
+        std::lock_guard<std::mutex> categories_guard(categories_mutex_);
         category_filter_.reset();
+        update_categories();
     }
 
     bool HasCategoryFilter()
@@ -139,7 +157,9 @@ struct LogResources
             const std::regex& filter)
     {
         std::unique_lock<std::mutex> configGuard(config_mutex_);
+        std::lock_guard<std::mutex> categories_guard(categories_mutex_);
         filename_filter_.reset(new std::regex(filter));
+        update_categories();
     }
 
     //! Returns a copy of the current filename filter or an empty object otherwise
@@ -179,9 +199,11 @@ struct LogResources
         SetThreadConfig(thr_config);
 
         std::lock_guard<std::mutex> configGuard(config_mutex_);
+        std::lock_guard<std::mutex> categories_guard(categories_mutex_);
         category_filter_.reset();
         filename_filter_.reset();
         error_string_filter_.reset();
+        update_categories();
         filenames_ = false;
         functions_ = true;
         verbosity_ = Log::Error;
@@ -205,33 +227,84 @@ struct LogResources
             return;
         }
 
-        /*   Flush() two steps strategy:
+        // Take note of the entries pushed up to now on every queue
+        std::vector<std::pair<std::shared_ptr<ProducerQueue>, uint64_t>> targets;
+        {
+            std::lock_guard<std::mutex> queues_guard(queues_mutex_);
+            targets.reserve(queues_.size());
+            for (const auto& queue : queues_)
+            {
+                targets.emplace_back(queue, queue->entries.pushed());
+            }
+        }
+        uint64_t overflow_target = 0;
+        {
+            std::lock_guard<std::mutex> overflow_guard(overflow_mutex_);
+            overflow_target = overflow_pushed_;
+        }
+
+        work_ = true;
+        cv_.notify_all();
+        cv_.wait(guard,
+                [&]()
+                {
+                    if (!logging_)
+                    {
+                        return true;
+                    }
 
-             I must assure Log::Run swaps the queues because only swapping the queues the background content
-             will be consumed (first Run() loop).
+                    for (const auto& target : targets)
+                    {
+                        if (target.first->consumed < target.second)
+                        {
+                            return false;
+                        }
+                    }
+                    return overflow_consumed_ >= overflow_target;
+                });
+    }
 
-             Then, I must assure the new front queue content is consumed (second Run() loop).
-         */
+    /**
+     * Get the identifier of a category on a source file, used to check at the call site whether the category
+     * and filename filters allow logging.
+     * It does not take config_mutex_, which is held while the consumers run, so consumers can log.
+     */
+    uint32_t RegisterCategory(
+            const char* category,
+            const char* filename)
+    {
+        std::lock_guard<std::mutex> categories_guard(categories_mutex_);
 
-        int last_loop = -1;
+        auto key = std::make_pair(std::string(category), std::string(filename ? filename : ""));
+        auto it = category_ids_.find(key);
+        if (it != category_ids_.end())
+        {
+            return it->second;
+        }
 
-        for (int i = 0; i < 2; ++i)
+        if (categories_.size() >= max_categories)
         {
-            cv_.wait(guard,
-                    [&]()
-                    {
-                        /* I must avoid:
-                         + the two calls be processed without an intermediate Run() loop (by using last_loop sequence number)
-                         + deadlock by absence of Run() loop activity (by using BothEmpty() call)
-                         */
-                        return !logging_ ||
-                        (logs_.Empty() &&
-                        (last_loop != current_loop_ || logs_.BothEmpty()));
-                    });
+            // Entries from this call site will be filtered on the logging thread
+            return max_categories;
+        }
 
-            last_loop = current_loop_;
+        uint32_t id = static_cast<uint32_t>(categories_.size());
+        categories_.push_back(key);
+        category_ids_.emplace(key, id);
+        update_category(id);
+        return id;
+    }
 
+    //! Whether the category and filename filters allow logging on a category registered with RegisterCategory.
+    bool IsCategoryEnabled(
+            uint32_t id) const
+    {
+        if (id >= max_categories)
+        {
+            return true;
         }
+
+        return 0 != (enabled_categories_[id / 64].load(std::memory_order_relaxed) & (uint64_t(1) << (id % 64)));
     }
 
     /**
@@ -240,28 +313,47 @@ struct LogResources
      *  * EPROSIMA_LOG_WARNING(cat, msg);
      *  * EPROSIMA_LOG_ERROR(cat, msg);
      *
-     * @todo this method takes 2 mutexes (same mutex) internally.
-     * This is a very high sensible point of the code and it should be refactored to be as efficient as possible.
+     * The entry is added to a queue owned by the calling thread, without taking any lock unless the logging
+     * thread is idle and needs to be woken up.
      */
     void QueueLog(
-            const std::string& message,
+            std::string&& message,
             const Log::Context& context,
-            Log::Kind kind)
+            Log::Kind kind,
+            uint32_t category)
     {
         StartThread();
 
-        std::string timestamp = SystemInfo::get_timestamp();
-        logs_.Push(Log::Entry{ message, context, kind, timestamp });
+        QueuedEntry queued;
+        queued.sequence = next_sequence_.fetch_add(1, std::memory_order_relaxed);
+        queued.time = std::chrono::system_clock::now();
+        queued.filtered = category < max_categories;
+        queued.entry.message = std::move(message);
+        queued.entry.context = context;
+        queued.entry.kind = kind;
+
+        // Once a thread falls back to the shared queue, it keeps using it until the logging thread takes its
+        // entries from there, so entries taken from its own queue are always older than those left on the shared one
+        ProducerQueue* queue = local_queue();
+        if (nullptr == queue || queue->overflowed.load(std::memory_order_relaxed) ||
+                !queue->entries.push(std::move(queued)))
         {
-            std::unique_lock<std::mutex> guard(cv_mutex_);
+            std::lock_guard<std::mutex> overflow_guard(overflow_mutex_);
+            overflow_.push_back(std::move(queued));
+            ++overflow_pushed_;
+            if (nullptr != queue)
+            {
+                queue->overflowed.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        // Pairs with the fence on run(), so either the logging thread sees the entry or we see it idle
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (consumer_idle_.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> guard(cv_mutex_);
             work_ = true;
-            // pessimization
             cv_.notify_all();
-            // wait till the thread is initialized
-            cv_.wait(guard, [&]
-                    {
-                        return current_loop_;
-                    });
         }
     }
 
@@ -280,14 +372,81 @@ struct LogResources
             if (!logging_thread_.is_calling_thread())
             {
                 logging_thread_.join();
+                thread_running_.store(false, std::memory_order_release);
             }
         }
     }
 
 private:
 
+    //! Maximum number of categories that can be filtered at the call site
+    static constexpr uint32_t max_categories = 4096;
+    //! Maximum number of entries queued by each thread before falling back to the shared queue
+    static constexpr size_t producer_queue_capacity = 256;
+
+    //! Entry on the queues, with the information that is formatted on the logging thread
+    struct QueuedEntry
+    {
+        uint64_t sequence = 0;
+        std::chrono::system_clock::time_point time;
+        //! Whether the category and filename filters were already checked at the call site
+        bool filtered = false;
+        Log::Entry entry;
+    };
+
+    //! Queue of entries of a single thread
+    struct ProducerQueue
+    {
+        ProducerQueue()
+            : entries(producer_queue_capacity)
+        {
+        }
+
+        LogRingBuffer<QueuedEntry> entries;
+        //! Set when the owning thread finishes
+        std::atomic<bool> orphaned{false};
+        //! Whether the owning thread has entries on the shared queue. Only written with overflow_mutex_ taken
+        std::atomic<bool> overflowed{false};
+        //! Number of entries delivered to the consumers. Protected by cv_mutex_
+        uint64_t consumed = 0;
+    };
+
+    struct ProducerQueueHolder
+    {
+        ~ProducerQueueHolder()
+        {
+            if (queue)
+            {
+                queue->orphaned.store(true, std::memory_order_release);
+            }
+            destroyed = true;
+        }
+
+        std::shared_ptr<ProducerQueue> queue;
+        bool destroyed = false;
+    };
+
+    ProducerQueue* local_queue()
+    {
+        static thread_local ProducerQueueHolder holder;
+
+        if (!holder.queue && !holder.destroyed)
+        {
+            holder.queue = std::make_shared<ProducerQueue>();
+            std::lock_guard<std::mutex> queues_guard(queues_mutex_);
+            queues_.push_back(holder.queue);
+        }
+
+        return holder.destroyed ? nullptr : holder.queue.get();
+    }
+
     void StartThread()
     {
+        if (thread_running_.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
         std::unique_lock<std::mutex> guard(cv_mutex_);
         if (!logging_ && !logging_thread_.joinable())
         {
@@ -297,46 +456,128 @@ private:
                         run();
                     };
             logging_thread_ = eprosima::create_thread(thread_fn, thread_settings_, "dds.log");
+            thread_running_.store(true, std::memory_order_release);
+        }
+    }
+
+    //! Moves the pending entries of every queue to batch_, ordered as they were logged
+    void collect_entries(
+            std::vector<std::pair<ProducerQueue*, uint64_t>>& progress,
+            uint64_t& overflow_progress)
+    {
+        progress.clear();
+
+        // The shared queue is taken first. A thread only starts using it when its own queue is full, and keeps
+        // using it until its entries are taken here. Hence the entries of that thread remaining on its own queue
+        // are older than the ones taken here, and are all taken below before it becomes empty. Entries pushed to
+        // the shared queue after this point are newer than anything taken from the queue of the same thread.
+        {
+            std::lock_guard<std::mutex> overflow_guard(overflow_mutex_);
+            for (auto& queued : overflow_)
+            {
+                batch_.push_back(std::move(queued));
+            }
+            overflow_.clear();
+            overflow_progress = overflow_pushed_;
+
+            std::lock_guard<std::mutex> queues_guard(queues_mutex_);
+            for (const auto& queue : queues_)
+            {
+                queue->overflowed.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> queues_guard(queues_mutex_);
+            auto it = queues_.begin();
+            while (it != queues_.end())
+            {
+                // Check orphaned before emptiness, so no entry pushed by a finished thread is left behind
+                bool orphaned = (*it)->orphaned.load(std::memory_order_acquire);
+                QueuedEntry queued;
+                while ((*it)->entries.pop(queued))
+                {
+                    batch_.push_back(std::move(queued));
+                }
+                progress.emplace_back(it->get(), (*it)->entries.popped());
+
+                if (orphaned)
+                {
+                    // Keep it alive until its progress has been notified
+                    finished_queues_.push_back(std::move(*it));
+                    it = queues_.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        std::sort(batch_.begin(), batch_.end(), [](const QueuedEntry& lhs, const QueuedEntry& rhs)
+                {
+                    return lhs.sequence < rhs.sequence;
+                });
+    }
+
+    bool has_pending_entries()
+    {
+        {
+            std::lock_guard<std::mutex> queues_guard(queues_mutex_);
+            for (const auto& queue : queues_)
+            {
+                if (!queue->entries.empty())
+                {
+                    return true;
+                }
+            }
         }
+        std::lock_guard<std::mutex> overflow_guard(overflow_mutex_);
+        return !overflow_.empty();
     }
 
     void run()
     {
+        std::vector<std::pair<ProducerQueue*, uint64_t>> progress;
+        uint64_t overflow_progress = 0;
         std::unique_lock<std::mutex> guard(cv_mutex_);
+        bool keep_running = true;
 
-        while (logging_)
+        // When stopped, a last iteration consumes the entries already queued
+        while (keep_running)
         {
-            cv_.wait(guard,
-                    [&]()
-                    {
-                        return !logging_ || work_;
-                    });
-
+            keep_running = logging_;
             work_ = false;
 
             guard.unlock();
             {
-                logs_.Swap();
-                while (!logs_.Empty())
+                collect_entries(progress, overflow_progress);
+                if (!batch_.empty())
                 {
-                    Log::Entry& entry = logs_.Front();
+                    std::unique_lock<std::mutex> configGuard(config_mutex_);
+                    for (QueuedEntry& queued : batch_)
                     {
-                        std::unique_lock<std::mutex> configGuard(config_mutex_);
-
-                        if (preprocess(entry))
+                        if (preprocess(queued))
                         {
                             for (auto& consumer : consumers_)
                             {
-                                consumer->Consume(entry);
+                                consumer->Consume(queued.entry);
                             }
                         }
                     }
-                    // This Pop() is also a barrier for Log::Flush wait condition
-                    logs_.Pop();
                 }
+                batch_.clear();
             }
             guard.lock();
 
+            // Notify the progress to Log::Flush
+            for (const auto& queue_progress : progress)
+            {
+                queue_progress.first->consumed = queue_progress.second;
+            }
+            overflow_consumed_ = overflow_progress;
+            finished_queues_.clear();
+
             // avoid overflow
             if (++current_loop_ > 10000)
             {
@@ -344,19 +585,42 @@ private:
             }
 
             cv_.notify_all();
+
+            if (keep_running && !work_ && logging_)
+            {
+                consumer_idle_.store(true, std::memory_order_relaxed);
+                // Pairs with the fence on QueueLog, so either we see the new entries or the producer sees us idle
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                guard.unlock();
+                bool pending = has_pending_entries();
+                guard.lock();
+                if (!pending)
+                {
+                    cv_.wait(guard,
+                            [&]()
+                            {
+                                return !logging_ || work_;
+                            });
+                }
+                consumer_idle_.store(false, std::memory_order_relaxed);
+            }
         }
     }
 
     bool preprocess(
-            Log::Entry& entry)
+            QueuedEntry& queued)
     {
-        if (category_filter_ && !regex_search(entry.context.category, *category_filter_))
-        {
-            return false;
-        }
-        if (filename_filter_ && !regex_search(entry.context.filename, *filename_filter_))
+        Log::Entry& entry = queued.entry;
+        if (!queued.filtered)
         {
-            return false;
+            if (category_filter_ && !regex_search(entry.context.category, *category_filter_))
+            {
+                return false;
+            }
+            if (filename_filter_ && !regex_search(entry.context.filename, *filename_filter_))
+            {
+                return false;
+            }
         }
         if (error_string_filter_ && !regex_search(entry.message, *error_string_filter_))
         {
@@ -370,13 +634,54 @@ private:
         {
             entry.context.function = nullptr;
         }
+        entry.timestamp = SystemInfo::get_timestamp(queued.time);
 
         return true;
     }
 
-    DBQueue<Log::Entry> logs_;
+    //! Recomputes the enabled bit of a registered category. Should be called with categories_mutex_ taken.
+    void update_category(
+            uint32_t id)
+    {
+        const auto& category = categories_[id];
+        bool enabled = (!category_filter_ || regex_search(category.first, *category_filter_)) &&
+                (!filename_filter_ || regex_search(category.second, *filename_filter_));
+
+        uint64_t mask = uint64_t(1) << (id % 64);
+        if (enabled)
+        {
+            enabled_categories_[id / 64].fetch_or(mask, std::memory_order_relaxed);
+        }
+        else
+        {
+            enabled_categories_[id / 64].fetch_and(~mask, std::memory_order_relaxed);
+        }
+    }
+
+    //! Recomputes the enabled bits of all registered categories. Should be called with categories_mutex_ taken.
+    void update_categories()
+    {
+        for (uint32_t id = 0; id < categories_.size(); ++id)
+        {
+            update_category(id);
+        }
+    }
+
+    // Queues segment.
+    std::mutex queues_mutex_;
+    std::vector<std::shared_ptr<ProducerQueue>> queues_;
+    std::atomic<uint64_t> next_sequence_{0};
+    std::mutex overflow_mutex_;
+    std::vector<QueuedEntry> overflow_;
+    uint64_t overflow_pushed_ = 0;
+
+    // Logging thread segment.
+    std::vector<QueuedEntry> batch_;
+    std::vector<std::shared_ptr<ProducerQueue>> finished_queues_;
     std::vector<std::unique_ptr<LogConsumer>> consumers_;
     eprosima::thread logging_thread_;
+    std::atomic<bool> thread_running_{false};
+    std::atomic<bool> consumer_idle_{false};
 
     // Condition variable segment.
     std::condition_variable cv_;
@@ -384,6 +689,7 @@ private:
     bool logging_;
     bool work_;
     int current_loop_;
+    uint64_t overflow_consumed_ = 0;
 
     // Context configuration.
     std::mutex config_mutex_;
@@ -393,6 +699,13 @@ private:
     std::unique_ptr<std::regex> filename_filter_;
     std::unique_ptr<std::regex> error_string_filter_;
 
+    // Call site categories. category_filter_ and filename_filter_ are only modified with both config_mutex_ and
+    // categories_mutex_ taken, so they can be read holding either of them.
+    std::mutex categories_mutex_;
+    std::map<std::pair<std::string, std::string>, uint32_t> category_ids_;
+    std::vector<std::pair<std::string, std::string>> categories_;
+    std::array<std::atomic<uint64_t>, max_categories / 64> enabled_categories_;
+
     std::atomic<Log::Kind> verbosity_;
     rtps::ThreadSettings thread_settings_;
 };
@@ -448,7 +761,29 @@ void Log::QueueLog(
         const Log::Context& context,
         Log::Kind kind)
 {
-    detail::get_log_resources()->QueueLog(message, context, kind);
+    detail::get_log_resources()->QueueLog(std::string(message), context, kind, (std::numeric_limits<uint32_t>::max)());
+}
+
+void Log::QueueLog(
+        std::string&& message,
+        const Log::Context& context,
+        Log::Kind kind,
+        uint32_t category)
+{
+    detail::get_log_resources()->QueueLog(std::move(message), context, kind, category);
+}
+
+uint32_t Log::RegisterCategory(
+        const char* category,
+        const char* filename)
+{
+    return detail::get_log_resources()->RegisterCategory(category, filename);
+}
+
+bool Log::IsCategoryEnabled(
+        uint32_t category)
+{
+    return detail::get_log_resources()->IsCategoryEnabled(category);
 }
 
 Log::Kind Log::GetVerbosity()
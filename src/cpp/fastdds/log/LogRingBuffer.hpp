@@ -0,0 +1,137 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_LOG__LOGRINGBUFFER_HPP
+#define FASTDDS_LOG__LOGRINGBUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Fixed capacity ring buffer with a single producer and a single consumer.
+ *
+ * Both push and pop are wait-free. Positions are monotonically increasing counters, so the number of elements
+ * ever pushed and popped can be used to check the progress of the consumer.
+ *
+ * @tparam T Element type. Must be default constructible and move assignable.
+ */
+template<typename T>
+class LogRingBuffer
+{
+public:
+
+    /**
+     * Construct a ring buffer.
+     *
+     * @param capacity Maximum number of elements. Rounded up to the next power of two.
+     */
+    explicit LogRingBuffer(
+            size_t capacity)
+    {
+        size_t size = 1;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        slots_.resize(size);
+        mask_ = size - 1;
+    }
+
+    /**
+     * Add an element at the back of the buffer. Only to be called from the producer thread.
+     *
+     * @param item Element to add. It is only moved from when the operation succeeds.
+     *
+     * @return false if the buffer is full.
+     */
+    bool push(
+            T&& item)
+    {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) > mask_)
+        {
+            return false;
+        }
+
+        slots_[head & mask_] = std::move(item);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Take the element at the front of the buffer. Only to be called from the consumer thread.
+     *
+     * @param item Where the element is moved to.
+     *
+     * @return false if the buffer is empty.
+     */
+    bool pop(
+            T& item)
+    {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        item = std::move(slots_[tail & mask_]);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Number of elements ever pushed
+    uint64_t pushed() const
+    {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    //! Number of elements ever popped
+    uint64_t popped() const
+    {
+        return tail_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const
+    {
+        return popped() == pushed();
+    }
+
+private:
+
+    std::vector<T> slots_;
+    uint64_t mask_ = 0;
+
+    // Keep producer and consumer positions on different cache lines
+    char pad_head_[64];
+    //! Written by the producer
+    std::atomic<uint64_t> head_{0};
+    char pad_tail_[64];
+    //! Written by the consumer
+    std::atomic<uint64_t> tail_{0};
+};
+
+}  // namespace detail
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif  // FASTDDS_LOG__LOGRINGBUFFER_HPP
@@ -237,6 +237,11 @@ ReturnCode_t DataWriter::wait_for_acknowledgments(
     return impl_->wait_for_acknowledgments(max_wait);
 }
 
+ReturnCode_t DataWriter::flush_persistent_changes()
+{
+    return impl_->flush_persistent_changes();
+}
+
 ReturnCode_t DataWriter::get_offered_deadline_missed_status(
         OfferedDeadlineMissedStatus& status)
 {
@@ -300,6 +305,13 @@ ReturnCode_t DataWriter::get_sending_locators(
     return impl_->get_sending_locators(locators);
 }
 
+ReturnCode_t DataWriter::get_content_filter_evaluations(
+        uint64_t& evaluations,
+        uint64_t& evaluations_saved) const
+{
+    return impl_->get_content_filter_evaluations(evaluations, evaluations_saved);
+}
+
 ReturnCode_t DataWriter::wait_for_acknowledgments(
         void* instance,
         const InstanceHandle_t& handle,
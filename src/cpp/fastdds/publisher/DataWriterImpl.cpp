@@ -1126,6 +1126,25 @@ ReturnCode_t DataWriterImpl::get_sending_locators(
     return RETCODE_OK;
 }
 
+ReturnCode_t DataWriterImpl::get_content_filter_evaluations(
+        uint64_t& evaluations,
+        uint64_t& evaluations_saved) const
+{
+    if (nullptr == writer_)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    evaluations = 0;
+    evaluations_saved = 0;
+    if (reader_filters_)
+    {
+        evaluations = reader_filters_->filter_evaluations();
+        evaluations_saved = reader_filters_->filter_evaluations_saved();
+    }
+    return RETCODE_OK;
+}
+
 const fastdds::rtps::GUID_t& DataWriterImpl::guid() const
 {
     return guid_;
@@ -1388,6 +1407,20 @@ ReturnCode_t DataWriterImpl::wait_for_acknowledgments(
     return RETCODE_ERROR;
 }
 
+ReturnCode_t DataWriterImpl::flush_persistent_changes()
+{
+    if (writer_ == nullptr)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    if (writer_->flush_persistent_changes())
+    {
+        return RETCODE_OK;
+    }
+    return RETCODE_ERROR;
+}
+
 ReturnCode_t DataWriterImpl::wait_for_acknowledgments(
         void* instance,
         const InstanceHandle_t& handle,
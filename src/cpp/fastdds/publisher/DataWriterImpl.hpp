@@ -302,6 +302,8 @@ public:
             const InstanceHandle_t& handle,
             const fastdds::Duration_t& max_wait);
 
+    ReturnCode_t flush_persistent_changes();
+
     ReturnCode_t get_publication_matched_status(
             PublicationMatchedStatus& status);
 
@@ -370,6 +372,10 @@ public:
     ReturnCode_t get_sending_locators(
             rtps::LocatorList& locators) const;
 
+    ReturnCode_t get_content_filter_evaluations(
+            uint64_t& evaluations,
+            uint64_t& evaluations_saved) const;
+
     /**
      * Called from the DomainParticipant when a filter factory is being unregistered.
      *
@@ -19,7 +19,16 @@
 #ifndef _FASTDDS_PUBLISHER_FILTERING_READERFILTERCOLLECTION_HPP_
 #define _FASTDDS_PUBLISHER_FILTERING_READERFILTERCOLLECTION_HPP_
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 #include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 #include <fastdds/dds/topic/IContentFilter.hpp>
 #include <fastdds/dds/topic/IContentFilterFactory.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
@@ -50,6 +59,9 @@ namespace dds {
  * Class responsible for writer side filtering.
  * Contains a resource-limited map associating a reader GUID with its filtering information.
  * Performs the evaluation of filters when a change is added to the DataWriter's history.
+ * Readers using the built-in DDS-SQL filter with the same filter signature share the result of a single evaluation
+ * of the filter. Filters created by user factories are always evaluated for each reader, as they may depend on the
+ * reader GUID they receive.
  */
 class ReaderFilterCollection
 {
@@ -89,6 +101,22 @@ public:
         return reader_filters_.empty();
     }
 
+    /**
+     * @return number of filter evaluations performed since the creation of the collection.
+     */
+    uint64_t filter_evaluations() const
+    {
+        return filter_evaluations_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return number of filter evaluations saved by reusing the result of another reader with the same filter.
+     */
+    uint64_t filter_evaluations_saved() const
+    {
+        return filter_evaluations_saved_.load(std::memory_order_relaxed);
+    }
+
     /**
      * Performs filter evaluation on a DataWriterFilteredChange.
      *
@@ -120,15 +148,22 @@ public:
             info.sample_identity.writer_guid(change.writerGUID);
             info.sample_identity.sequence_number(change.sequenceNumber);
 
+            // Each distinct filter is evaluated once, the first time one of its readers is processed
+            std::fill(group_results_.begin(), group_results_.end(), FILTER_NOT_EVALUATED);
+            uint64_t evaluations = 0;
+            uint64_t evaluations_saved = 0;
+
             // Functor used from the serialization process to evaluate each filter and write its signature.
-            auto filter_process = [this, &change, &info](
-                std::size_t i,
+            // It is called once for each entry, in order.
+            auto it = reader_filters_.cbegin();
+            auto filter_process = [this, &change, &info, &it, &evaluations, &evaluations_saved](
+                std::size_t /*i*/,
                 uint8_t* signature) -> bool
                     {
                         // Point to the corresponding entry
-                        auto it = reader_filters_.cbegin();
-                        std::advance(it, i);
+                        const fastdds::rtps::GUID_t& reader_guid = it->first;
                         const ReaderFilterInformation& entry = it->second;
+                        ++it;
 
                         // Copy the signature
                         std::copy(entry.filter_signature.begin(), entry.filter_signature.end(), signature);
@@ -137,11 +172,23 @@ public:
                         bool filter_result = true;
                         if (fastdds::rtps::ALIVE == change.kind)
                         {
-                            // Evaluate filter and update filtered_out_readers
-                            filter_result = entry.filter->evaluate(change.serializedPayload, info, it->first);
+                            uint8_t& group_result = group_results_[entry.filter_group];
+                            if (FILTER_NOT_EVALUATED == group_result)
+                            {
+                                group_result = entry.filter->evaluate(change.serializedPayload, info, reader_guid) ?
+                                        FILTER_ACCEPTED : FILTER_REJECTED;
+                                ++evaluations;
+                            }
+                            else
+                            {
+                                ++evaluations_saved;
+                            }
+
+                            // Update filtered_out_readers
+                            filter_result = FILTER_ACCEPTED == group_result;
                             if (!filter_result)
                             {
-                                change.filtered_out_readers.emplace_back(it->first);
+                                change.filtered_out_readers.emplace_back(reader_guid);
                             }
                         }
                         return filter_result;
@@ -149,6 +196,9 @@ public:
 
             // Perform ContentFilterInfo serialization and filter evaluation
             ContentFilterInfo::cdr_serialize(change.inline_qos, num_filters, filter_process);
+
+            filter_evaluations_.fetch_add(evaluations, std::memory_order_relaxed);
+            filter_evaluations_saved_.fetch_add(evaluations_saved, std::memory_order_relaxed);
         }
     }
 
@@ -171,6 +221,8 @@ public:
             }
             ++it;
         }
+
+        update_filter_groups();
     }
 
     /**
@@ -188,6 +240,7 @@ public:
         {
             destroy_filter(it->second);
             reader_filters_.erase(it);
+            update_filter_groups();
         }
     }
 
@@ -230,6 +283,7 @@ public:
                 if (update_entry(entry, filter_info, participant, writer_topic->get_type()))
                 {
                     reader_filters_.emplace(std::make_pair(guid, std::move(entry)));
+                    update_filter_groups();
                 }
             }
             else
@@ -242,12 +296,51 @@ public:
                     destroy_filter(it->second);
                     reader_filters_.erase(it);
                 }
+                update_filter_groups();
             }
         }
     }
 
 private:
 
+    //! Values of group_results_
+    enum : uint8_t
+    {
+        FILTER_NOT_EVALUATED,
+        FILTER_ACCEPTED,
+        FILTER_REJECTED
+    };
+
+    /**
+     * Assign a filter group to each entry, so entries using the built-in DDS-SQL filter with the same filter signature
+     * share the same one. Entries using filters of other factories get a group of their own.
+     * Called whenever an entry is added, updated or removed.
+     */
+    void update_filter_groups()
+    {
+        using FilterKey = std::pair<std::array<uint8_t, 16>, IContentFilterFactory*>;
+
+        // Number of distinct filters is expected to be low, so a linear search is enough
+        std::vector<FilterKey> groups;
+        for (auto& item : reader_filters_)
+        {
+            ReaderFilterInformation& entry = item.second;
+            FilterKey key(entry.filter_signature, entry.filter_factory);
+            auto group = groups.end();
+            if (0 == strcmp(entry.filter_class_name.c_str(), FASTDDS_SQLFILTER_NAME))
+            {
+                group = std::find(groups.begin(), groups.end(), key);
+            }
+            entry.filter_group = static_cast<size_t>(group - groups.begin());
+            if (groups.end() == group)
+            {
+                groups.push_back(key);
+            }
+        }
+
+        group_results_.assign(groups.size(), FILTER_NOT_EVALUATED);
+    }
+
     /**
      * Ensure a filter instance is removed before an information entry is removed.
      *
@@ -338,6 +431,13 @@ private:
     foonathan::memory::map<fastdds::rtps::GUID_t, ReaderFilterInformation, pool_allocator_t> reader_filters_;
 
     std::size_t max_filters_;
+
+    //! Result of each filter group on the change being filtered
+    mutable std::vector<uint8_t> group_results_;
+
+    mutable std::atomic<uint64_t> filter_evaluations_{0};
+
+    mutable std::atomic<uint64_t> filter_evaluations_saved_{0};
 };
 
 }  // namespace dds
@@ -37,6 +37,8 @@ struct ReaderFilterInformation
     IContentFilterFactory* filter_factory = nullptr;
     IContentFilter* filter = nullptr;
     std::array<uint8_t, 16> filter_signature{ { 0 } };
+    //! Index of the group of entries sharing the same filter, used to evaluate it only once per change
+    size_t filter_group = 0;
 };
 
 }  // namespace dds
@@ -535,7 +535,7 @@ ReturnCode_t DataReaderImpl::read_or_take(
         return RETCODE_TIMEOUT;
     }
 #else
-    std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
 
     set_read_communication_status(false);
@@ -560,6 +560,7 @@ ReturnCode_t DataReaderImpl::read_or_take(
     }
 
     detail::StateFilter states = { sample_states, view_states, instance_states };
+    LoanableCollection::size_type first_slot = data_values.length();
     detail::ReadTakeCommand cmd(
         *this,
         data_values,
@@ -568,7 +569,8 @@ ReturnCode_t DataReaderImpl::read_or_take(
         states,
         it.second,
         single_instance,
-        !exact_instance);
+        !exact_instance,
+        should_take);
 
     while (!cmd.is_finished())
     {
@@ -577,9 +579,95 @@ ReturnCode_t DataReaderImpl::read_or_take(
 
     try_notify_read_conditions();
 
+    if (cmd.has_pending_samples())
+    {
+        // Taken samples have been copied out of the history, so they can be deserialized without blocking the reception
+        lock.unlock();
+        int32_t failed_samples = cmd.deserialize_pending_samples();
+
+        // When the take was limited by max_samples, there may be more samples to replace the failed ones
+        if (0 < failed_samples && cmd.reached_max_samples())
+        {
+            return take_replacement_samples(data_values, sample_infos, first_slot, failed_samples, handle, states,
+                           exact_instance, single_instance);
+        }
+    }
+
     return cmd.return_value();
 }
 
+ReturnCode_t DataReaderImpl::take_replacement_samples(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        LoanableCollection::size_type first_slot,
+        int32_t num_samples,
+        const InstanceHandle_t& handle,
+        const detail::StateFilter& states,
+        bool exact_instance,
+        bool single_instance)
+{
+#if HAVE_STRICT_REALTIME
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+            std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+#endif // if HAVE_STRICT_REALTIME
+
+    while (0 < num_samples)
+    {
+        LoanableCollection::size_type pass_first_slot = data_values.length();
+
+#if HAVE_STRICT_REALTIME
+        std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
+
+        if (!lock.try_lock_until(max_blocking_time))
+        {
+            break;
+        }
+#else
+        std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+        auto it = history_.lookup_available_instance(handle, exact_instance);
+        if (!it.first)
+        {
+            break;
+        }
+
+        detail::ReadTakeCommand cmd(*this, data_values, sample_infos, num_samples, states, it.second,
+                single_instance, !exact_instance, true);
+        while (!cmd.is_finished())
+        {
+            cmd.add_instance(true);
+        }
+
+        try_notify_read_conditions();
+
+        num_samples = 0;
+        if (cmd.has_pending_samples())
+        {
+            lock.unlock();
+            int32_t failed_samples = cmd.deserialize_pending_samples();
+            if (cmd.reached_max_samples())
+            {
+                num_samples = failed_samples;
+            }
+        }
+
+        // Samples of the same instance taken on previous passes have the new ones after them
+        for (LoanableCollection::size_type slot = pass_first_slot; slot < sample_infos.length(); ++slot)
+        {
+            for (LoanableCollection::size_type n = first_slot; n < pass_first_slot; ++n)
+            {
+                if (sample_infos[n].instance_handle == sample_infos[slot].instance_handle)
+                {
+                    ++sample_infos[n].sample_rank;
+                }
+            }
+        }
+    }
+
+    return data_values.length() > first_slot ? RETCODE_OK : RETCODE_NO_DATA;
+}
+
 ReturnCode_t DataReaderImpl::read(
         LoanableCollection& data_values,
         SampleInfoSeq& sample_infos,
@@ -718,51 +806,72 @@ ReturnCode_t DataReaderImpl::read_or_take_next_sample(
         return RETCODE_NOT_ENABLED;
     }
 
-    if (history_.getHistorySize() == 0)
-    {
-        return RETCODE_NO_DATA;
-    }
-
 #if HAVE_STRICT_REALTIME
     auto max_blocking_time = std::chrono::steady_clock::now() +
             std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
-    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
+#endif // if HAVE_STRICT_REALTIME
 
-    if (!lock.try_lock_until(max_blocking_time))
+    ReturnCode_t code = RETCODE_NO_DATA;
+    bool try_next_sample = false;
+    do
     {
-        return RETCODE_TIMEOUT;
-    }
+        try_next_sample = false;
+        if (history_.getHistorySize() == 0)
+        {
+            return RETCODE_NO_DATA;
+        }
+
+#if HAVE_STRICT_REALTIME
+        std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
+
+        if (!lock.try_lock_until(max_blocking_time))
+        {
+            return RETCODE_TIMEOUT;
+        }
 
 #else
-    std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+        std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
 
-    set_read_communication_status(false);
+        set_read_communication_status(false);
 
-    auto it = history_.lookup_available_instance(HANDLE_NIL, false);
-    if (!it.first)
-    {
-        return RETCODE_NO_DATA;
-    }
+        auto it = history_.lookup_available_instance(HANDLE_NIL, false);
+        if (!it.first)
+        {
+            return RETCODE_NO_DATA;
+        }
 
-    StackAllocatedSequence<void*, 1> data_values;
-    const_cast<void**>(data_values.buffer())[0] = data;
-    StackAllocatedSequence<SampleInfo, 1> sample_infos;
+        StackAllocatedSequence<void*, 1> data_values;
+        const_cast<void**>(data_values.buffer())[0] = data;
+        StackAllocatedSequence<SampleInfo, 1> sample_infos;
 
-    detail::StateFilter states{ NOT_READ_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE };
-    detail::ReadTakeCommand cmd(*this, data_values, sample_infos, 1, states, it.second, false, false);
-    while (!cmd.is_finished())
-    {
-        cmd.add_instance(should_take);
-    }
+        detail::StateFilter states{ NOT_READ_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE };
+        detail::ReadTakeCommand cmd(*this, data_values, sample_infos, 1, states, it.second, false, false,
+                should_take);
+        while (!cmd.is_finished())
+        {
+            cmd.add_instance(should_take);
+        }
 
-    ReturnCode_t code = cmd.return_value();
-    if (RETCODE_OK == code)
-    {
-        *info = sample_infos[0];
-    }
+        try_notify_read_conditions();
 
-    try_notify_read_conditions();
+        if (cmd.has_pending_samples())
+        {
+            // The taken sample has been copied out of the history, so it can be deserialized without blocking the
+            // reception
+            lock.unlock();
+            cmd.deserialize_pending_samples();
+
+            // When the sample could not be deserialized, try with the next one
+            try_next_sample = (RETCODE_NO_DATA == cmd.return_value());
+        }
+
+        code = cmd.return_value();
+        if (RETCODE_OK == code)
+        {
+            *info = sample_infos[0];
+        }
+    } while (try_next_sample);
 
     return code;
 }
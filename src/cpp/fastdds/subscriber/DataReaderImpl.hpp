@@ -561,6 +561,25 @@ protected:
             bool single_instance,
             bool should_take);
 
+    /**
+     * Take samples to replace the ones which could not be deserialized after a take without loans, as they are
+     * deserialized once the reader mutex is unlocked, and removed from the collections when they fail.
+     *
+     * @param first_slot  Position of the first sample added to the collections by the take.
+     * @param num_samples  Number of samples to replace.
+     *
+     * @return RETCODE_OK when the collections hold any sample added by the take, RETCODE_NO_DATA otherwise.
+     */
+    ReturnCode_t take_replacement_samples(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            LoanableCollection::size_type first_slot,
+            int32_t num_samples,
+            const InstanceHandle_t& handle,
+            const detail::StateFilter& states,
+            bool exact_instance,
+            bool single_instance);
+
     ReturnCode_t read_or_take_next_sample(
             void* data,
             SampleInfo* info,
@@ -21,6 +21,8 @@
 
 #include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <vector>
 
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <fastdds/dds/core/LoanableCollection.hpp>
@@ -56,6 +58,13 @@ struct ReadTakeCommand
     using WriterProxy = eprosima::fastdds::rtps::WriterProxy;
     using SampleInfoSeq = LoanableTypedCollection<SampleInfo>;
     using DataSharingPayloadPool = eprosima::fastdds::rtps::DataSharingPayloadPool;
+    using SerializedPayload_t = eprosima::fastdds::rtps::SerializedPayload_t;
+
+    /**
+     * Amount of payload bytes kept by each thread to defer the deserialization of taken samples.
+     * A take may copy more than this, but the extra memory is freed once the samples are deserialized.
+     */
+    static constexpr size_t max_deferred_payload_bytes = 1024 * 1024;
 
     ReadTakeCommand(
             DataReaderImpl& reader,
@@ -65,7 +74,8 @@ struct ReadTakeCommand
             const StateFilter& states,
             const history_type::instance_info& instance,
             bool single_instance,
-            bool loop_for_data)
+            bool loop_for_data,
+            bool defer_deserialization = false)
         : type_(reader.type_)
         , loan_manager_(reader.loan_manager_)
         , history_(reader.history_)
@@ -80,10 +90,11 @@ struct ReadTakeCommand
         , handle_(instance->first)
         , single_instance_(single_instance)
         , loop_for_data_(loop_for_data)
+        , defer_deserialization_(defer_deserialization && data_values.has_ownership())
     {
         assert(0 <= remaining_samples_);
 
-        current_slot_ = data_values_.length();
+        first_slot_ = current_slot_ = data_values_.length();
         finished_ = false;
     }
 
@@ -220,6 +231,72 @@ struct ReadTakeCommand
         return return_value_;
     }
 
+    //! Whether there are taken samples whose deserialization was deferred.
+    inline bool has_pending_samples() const
+    {
+        return !pending_samples_.empty();
+    }
+
+    //! Whether the command added the maximum number of samples, so there may be more available.
+    inline bool reached_max_samples() const
+    {
+        return 0 == remaining_samples_;
+    }
+
+    /**
+     * Deserialize the samples whose deserialization was deferred.
+     * The samples which cannot be deserialized are removed from the collections.
+     *
+     * Should be called without holding the reader mutex, so incoming samples are not blocked during deserialization.
+     * Their changes were already released when they were taken, so they do not count against the resource limits.
+     *
+     * @return Number of samples removed from the collections.
+     */
+    int32_t deserialize_pending_samples()
+    {
+        std::vector<rtps::octet>& buffer = deferred_payloads();
+        std::vector<LoanableCollection::size_type> failed_slots;
+
+        // The payload points to the buffer, which it should not free even if the deserialization throws
+        struct PayloadView : public SerializedPayload_t
+        {
+            ~PayloadView()
+            {
+                data = nullptr;
+            }
+
+        };
+
+        PayloadView payload;
+
+        for (const PendingSample& pending : pending_samples_)
+        {
+            payload.data = buffer.data() + pending.offset;
+            payload.length = pending.length;
+            payload.max_size = pending.length;
+            payload.encapsulation = pending.encapsulation;
+            payload.pos = 0;
+            if (!type_->deserialize(&payload, data_values_.buffer()[pending.slot]))
+            {
+                failed_slots.push_back(pending.slot);
+            }
+        }
+
+        pending_samples_.clear();
+        if (buffer.capacity() > max_deferred_payload_bytes)
+        {
+            std::vector<rtps::octet>().swap(buffer);
+        }
+
+        // Remove from the last one, so the slots of the others remain valid
+        for (auto it = failed_slots.rbegin(); it != failed_slots.rend(); ++it)
+        {
+            remove_slot(*it);
+        }
+
+        return static_cast<int32_t>(failed_slots.size());
+    }
+
     static void generate_info(
             SampleInfo& info,
             const DataReaderInstance& instance,
@@ -279,10 +356,26 @@ private:
     InstanceHandle_t handle_;
     bool single_instance_;
     bool loop_for_data_;
+    bool defer_deserialization_;
+
+    //! A taken sample whose payload was copied to the deferred payloads buffer of the calling thread.
+    struct PendingSample
+    {
+        //! Slot of the sample on the collections.
+        LoanableCollection::size_type slot;
+        //! Position of the payload on the buffer.
+        size_t offset;
+        uint32_t length;
+        uint16_t encapsulation;
+    };
+
+    //! Taken samples pending deserialization.
+    std::vector<PendingSample> pending_samples_;
 
     bool finished_ = false;
     ReturnCode_t return_value_ = RETCODE_NO_DATA;
 
+    LoanableCollection::size_type first_slot_ = 0;
     LoanableCollection::size_type current_slot_ = 0;
 
     bool go_to_first_valid_instance()
@@ -369,6 +462,11 @@ private:
         auto payload = &(change->serializedPayload);
         if (data_values_.has_ownership())
         {
+            if (defer_sample(*payload))
+            {
+                return true;
+            }
+
             // perform deserialization
             return type_->deserialize(payload, data_values_.buffer()[current_slot_]);
         }
@@ -382,6 +480,80 @@ private:
         }
     }
 
+    //! Buffer holding the payloads of the samples taken by the calling thread until they are deserialized.
+    static std::vector<rtps::octet>& deferred_payloads()
+    {
+        static thread_local std::vector<rtps::octet> buffer;
+        return buffer;
+    }
+
+    /**
+     * Copy the payload of a taken sample, so it can be deserialized once the reader mutex is unlocked.
+     * The copy lets the change be released to the pools right away.
+     *
+     * @return Whether the deserialization of the sample was deferred.
+     */
+    bool defer_sample(
+            const SerializedPayload_t& payload)
+    {
+        // Payloads from data-sharing may be overridden by the writer, so they are checked after deserialization
+        if (!defer_deserialization_ || nullptr != dynamic_cast<DataSharingPayloadPool*>(payload.payload_owner))
+        {
+            return false;
+        }
+
+        std::vector<rtps::octet>& buffer = deferred_payloads();
+        if (pending_samples_.empty())
+        {
+            buffer.clear();
+            pending_samples_.reserve(static_cast<size_t>(remaining_samples_));
+        }
+
+        // Keep the payloads aligned to 8 bytes, as they would be on a pool
+        size_t offset = (buffer.size() + 7u) & ~static_cast<size_t>(7u);
+        if (!pending_samples_.empty() && offset + payload.length > max_deferred_payload_bytes)
+        {
+            return false;
+        }
+
+        buffer.resize(offset + payload.length);
+        memcpy(buffer.data() + offset, payload.data, payload.length);
+        pending_samples_.push_back({current_slot_, offset, payload.length, payload.encapsulation});
+        return true;
+    }
+
+    void remove_slot(
+            LoanableCollection::size_type slot)
+    {
+        // Previous samples of the same instance added by this command have one sample less after them
+        const InstanceHandle_t& handle = sample_infos_[slot].instance_handle;
+        for (LoanableCollection::size_type n = first_slot_; n < slot; ++n)
+        {
+            if (sample_infos_[n].instance_handle == handle)
+            {
+                --sample_infos_[n].sample_rank;
+            }
+        }
+
+        // Move the following samples one slot back, keeping the removed buffer at the end
+        void** buffer = const_cast<void**>(data_values_.buffer());
+        LoanableCollection::size_type length = data_values_.length();
+        void* removed = buffer[slot];
+        for (LoanableCollection::size_type n = slot; n + 1 < length; ++n)
+        {
+            buffer[n] = buffer[n + 1];
+            sample_infos_[n] = sample_infos_[n + 1];
+        }
+        buffer[length - 1] = removed;
+
+        data_values_.length(length - 1);
+        sample_infos_.length(length - 1);
+        if (first_slot_ + 1 == length)
+        {
+            return_value_ = RETCODE_NO_DATA;
+        }
+    }
+
     void generate_info(
             const DataReaderCacheChange& item)
     {
@@ -16,6 +16,7 @@
  * @file DataReaderHistory.cpp
  */
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -102,9 +103,16 @@ DataReaderHistory::DataReaderHistory(
         key_changes_allocation_.initial = resource_limited_qos_.allocated_samples;
         key_changes_allocation_.maximum = resource_limited_qos_.max_samples;
 
-        instances_.emplace(c_InstanceHandle_Unknown,
-                std::make_shared<DataReaderInstance>(key_changes_allocation_, key_writers_allocation_));
-        data_available_instances_[c_InstanceHandle_Unknown] = instances_[c_InstanceHandle_Unknown];
+        data_available_instances_[c_InstanceHandle_Unknown] = instances_.emplace(c_InstanceHandle_Unknown,
+                        key_changes_allocation_, key_writers_allocation_).first->second;
+    }
+
+    if (resource_limited_qos_.max_instances < std::numeric_limits<int32_t>::max())
+    {
+        // Avoid huge preallocations on readers with a high but not expected to be reached limit
+        constexpr size_t max_reserved_instances = 1024 * 1024;
+        instances_.reserve((std::min)(static_cast<size_t>(resource_limited_qos_.max_instances),
+                max_reserved_instances));
     }
 
     using std::placeholders::_1;
@@ -342,7 +350,7 @@ void DataReaderHistory::add_to_instance(
     // ADD TO KEY VECTOR
     DataReaderCacheChange item = a_change;
     eprosima::utilities::collections::sorted_vector_insert(instance.cache_changes, item, rtps::history_order_cmp);
-    data_available_instances_[a_change->instanceHandle] = instances_[a_change->instanceHandle];
+    data_available_instances_[a_change->instanceHandle] = &instance;
 
     EPROSIMA_LOG_INFO(SUBSCRIBER, mp_reader->getGuid().entityId
             << ": Change " << a_change->sequenceNumber << " added from: "
@@ -394,24 +402,29 @@ bool DataReaderHistory::find_key(
 
     if (instances_.size() < static_cast<size_t>(resource_limited_qos_.max_instances))
     {
-        vit_out = instances_.emplace(handle,
-                        std::make_shared<DataReaderInstance>(key_changes_allocation_, key_writers_allocation_)).first;
+        vit_out = instances_.emplace(handle, key_changes_allocation_, key_writers_allocation_).first;
         return true;
     }
 
+    // Reuse the non-alive instance with the lowest handle. The index is not ordered, so all of them are visited.
+    InstanceCollection::iterator reused = instances_.end();
     for (vit = instances_.begin(); vit != instances_.end(); ++vit)
     {
-        if (InstanceStateKind::ALIVE_INSTANCE_STATE != vit->second->instance_state)
+        if (InstanceStateKind::ALIVE_INSTANCE_STATE != vit->second->instance_state &&
+                (instances_.end() == reused || vit->first < reused->first))
         {
-            data_available_instances_.erase(vit->first);
-            instances_.erase(vit);
-            vit_out = instances_.emplace(handle,
-                            std::make_shared<DataReaderInstance>(key_changes_allocation_,
-                            key_writers_allocation_)).first;
-            return true;
+            reused = vit;
         }
     }
 
+    if (instances_.end() != reused)
+    {
+        data_available_instances_.erase(reused->first);
+        instances_.erase(reused);
+        vit_out = instances_.emplace(handle, key_changes_allocation_, key_writers_allocation_).first;
+        return true;
+    }
+
     EPROSIMA_LOG_WARNING(SUBSCRIBER, "History has reached the maximum number of instances");
     return false;
 }
@@ -602,7 +615,7 @@ std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::lookup_avai
         const InstanceHandle_t& handle,
         bool exact)
 {
-    InstanceCollection::iterator it = data_available_instances_.end();
+    instance_info it = data_available_instances_.end();
 
     if (!has_keys_)
     {
@@ -634,11 +647,7 @@ std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::lookup_avai
             else
             {
                 // Looking for an instance with a handle greater than the one on the input
-                auto comp = [](const InstanceHandle_t& h, const InstanceCollection::value_type& it)
-                        {
-                            return h < it.first;
-                        };
-                it = std::upper_bound(data_available_instances_.begin(), data_available_instances_.end(), handle, comp);
+                it = data_available_instances_.upper_bound(handle);
             }
         }
     }
@@ -666,7 +675,7 @@ std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::next_availa
 void DataReaderHistory::check_and_remove_instance(
         DataReaderHistory::instance_info& instance_info)
 {
-    DataReaderInstance* instance = instance_info->second.get();
+    DataReaderInstance* instance = instance_info->second;
 
     if (instance->cache_changes.empty())
     {
@@ -842,7 +851,7 @@ void DataReaderHistory::change_was_processed_nts(
 }
 
 void DataReaderHistory::instance_viewed_nts(
-        const InstanceCollection::mapped_type& instance)
+        DataReaderInstance* instance)
 {
     if (ViewStateKind::NEW_VIEW_STATE == instance->view_state)
     {
@@ -48,6 +48,7 @@
 
 #include "DataReaderHistoryCounters.hpp"
 #include "DataReaderInstance.hpp"
+#include "DataReaderInstanceIndex.hpp"
 
 namespace eprosima {
 namespace fastdds {
@@ -67,8 +68,9 @@ public:
     using GUID_t = eprosima::fastdds::rtps::GUID_t;
     using SequenceNumber_t = eprosima::fastdds::rtps::SequenceNumber_t;
 
-    using InstanceCollection = std::map<InstanceHandle_t, std::shared_ptr<DataReaderInstance>>;
-    using instance_info = InstanceCollection::iterator;
+    using InstanceCollection = DataReaderInstanceIndex;
+    using AvailableInstanceCollection = std::map<InstanceHandle_t, DataReaderInstance*>;
+    using instance_info = AvailableInstanceCollection::iterator;
 
     /**
      * Constructor.
@@ -337,7 +339,7 @@ public:
      * @param instance        Instance on which the view state should be modified.
      */
     void instance_viewed_nts(
-            const InstanceCollection::mapped_type& instance);
+            DataReaderInstance* instance);
 
     /*!
      * @brief Updates instance's information and also decides whether the sample is finally accepted or denied depending
@@ -375,8 +377,8 @@ private:
     eprosima::fastdds::ResourceLimitedContainerConfig key_writers_allocation_;
     //!Collection of DataReaderInstance objects accessible by their handle
     InstanceCollection instances_;
-    //!Collection of DataReaderInstance objects with available data, accessible by their handle
-    InstanceCollection data_available_instances_;
+    //!Collection of DataReaderInstance objects with available data, ordered by their handle
+    AvailableInstanceCollection data_available_instances_;
     //!HistoryQosPolicy values.
     HistoryQosPolicy history_qos_;
     //!ResourceLimitsQosPolicy values.
@@ -67,6 +67,23 @@ struct DataReaderInstance
     {
     }
 
+    /**
+     * Return the instance to the state it had just after construction, so it can be reused for another handle.
+     * Memory already allocated by the collections is kept.
+     */
+    void reset()
+    {
+        cache_changes.clear();
+        alive_writers.clear();
+        current_owner = { {}, (std::numeric_limits<uint32_t>::max)() };
+        next_deadline_us = std::chrono::steady_clock::time_point();
+        view_state = ViewStateKind::NEW_VIEW_STATE;
+        instance_state = InstanceStateKind::ALIVE_INSTANCE_STATE;
+        disposed_generation_count = 0;
+        no_writers_generation_count = 0;
+        has_been_accounted_ = false;
+    }
+
     void writer_update_its_ownership_strength(
             const fastdds::rtps::GUID_t& writer_guid,
             const uint32_t ownership_strength)
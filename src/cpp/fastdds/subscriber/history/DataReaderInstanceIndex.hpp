@@ -0,0 +1,338 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataReaderInstanceIndex.hpp
+ */
+
+#ifndef _FASTDDS_SUBSCRIBER_HISTORY_DATAREADERINSTANCEINDEX_HPP_
+#define _FASTDDS_SUBSCRIBER_HISTORY_DATAREADERINSTANCEINDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
+
+#include "DataReaderInstance.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Collection of DataReaderInstance objects accessible by their handle.
+ *
+ * Handles are indexed on an open-addressing hash table (linear probing with backward-shift deletion), which
+ * points to a dense vector of entries that can be iterated in an unspecified order.
+ * The DataReaderInstance objects are taken from an internal pool. They keep their address while present on the
+ * collection, and are reused (keeping the memory of their internal collections) after being erased.
+ */
+class DataReaderInstanceIndex final
+{
+public:
+
+    using InstanceHandle_t = eprosima::fastdds::rtps::InstanceHandle_t;
+    using value_type = std::pair<InstanceHandle_t, DataReaderInstance*>;
+    using iterator = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    DataReaderInstanceIndex() = default;
+
+    DataReaderInstanceIndex(
+            const DataReaderInstanceIndex&) = delete;
+
+    DataReaderInstanceIndex& operator =(
+            const DataReaderInstanceIndex&) = delete;
+
+    /**
+     * Preallocate the index for a number of instances.
+     *
+     * @param instances  Number of instances the index should hold without reallocating.
+     */
+    void reserve(
+            size_t instances)
+    {
+        entries_.reserve(instances);
+        free_instances_.reserve(instances);
+        size_t required = table_size_for(instances);
+        if (required > slots_.size())
+        {
+            rehash(required);
+        }
+    }
+
+    iterator begin() noexcept
+    {
+        return entries_.begin();
+    }
+
+    iterator end() noexcept
+    {
+        return entries_.end();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return entries_.begin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return entries_.end();
+    }
+
+    size_t size() const noexcept
+    {
+        return entries_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return entries_.empty();
+    }
+
+    iterator find(
+            const InstanceHandle_t& handle)
+    {
+        size_t slot = find_slot(handle);
+        return (INVALID_SLOT == slot) ? entries_.end() : entries_.begin() + slots_[slot];
+    }
+
+    const_iterator find(
+            const InstanceHandle_t& handle) const
+    {
+        size_t slot = find_slot(handle);
+        return (INVALID_SLOT == slot) ? entries_.end() : entries_.begin() + slots_[slot];
+    }
+
+    /**
+     * Add an instance to the collection, if not present.
+     *
+     * @param handle              Handle of the instance.
+     * @param changes_allocation  Allocation configuration for the changes of the instance.
+     * @param writers_allocation  Allocation configuration for the alive writers of the instance.
+     *
+     * @return A pair where:
+     *         - @c first is an iterator to the entry of the instance
+     *         - @c second is a boolean indicating if the instance has been added
+     */
+    std::pair<iterator, bool> emplace(
+            const InstanceHandle_t& handle,
+            const eprosima::fastdds::ResourceLimitedContainerConfig& changes_allocation,
+            const eprosima::fastdds::ResourceLimitedContainerConfig& writers_allocation)
+    {
+        size_t slot = find_slot(handle);
+        if (INVALID_SLOT != slot)
+        {
+            return { entries_.begin() + slots_[slot], false };
+        }
+
+        // Keep the load factor at or below 1/2
+        if ((entries_.size() + 1) * 2 > slots_.size())
+        {
+            rehash(table_size_for(entries_.size() + 1));
+        }
+
+        uint32_t index = static_cast<uint32_t>(entries_.size());
+        entries_.emplace_back(handle, acquire_instance(changes_allocation, writers_allocation));
+
+        size_t mask = slots_.size() - 1;
+        for (slot = hash(handle) & mask; EMPTY_SLOT != slots_[slot]; slot = (slot + 1) & mask)
+        {
+        }
+        slots_[slot] = index;
+
+        return { entries_.begin() + index, true };
+    }
+
+    /**
+     * Remove an instance from the collection, returning it to the pool.
+     * Iterators to the removed entry and to the last entry of the collection are invalidated.
+     *
+     * @param pos  Iterator to the entry to remove.
+     *
+     * @return Iterator to the entry that takes the position of the removed one.
+     */
+    iterator erase(
+            iterator pos)
+    {
+        size_t index = static_cast<size_t>(pos - entries_.begin());
+        erase_slot(find_slot(pos->first));
+        release_instance(pos->second);
+
+        size_t last = entries_.size() - 1;
+        if (index != last)
+        {
+            entries_[index] = entries_[last];
+            slots_[find_slot(entries_[index].first)] = static_cast<uint32_t>(index);
+        }
+        entries_.pop_back();
+
+        return entries_.begin() + index;
+    }
+
+    /**
+     * Remove an instance from the collection, returning it to the pool.
+     *
+     * @param handle  Handle of the instance to remove.
+     *
+     * @return Number of removed instances.
+     */
+    size_t erase(
+            const InstanceHandle_t& handle)
+    {
+        iterator it = find(handle);
+        if (entries_.end() == it)
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+private:
+
+    static constexpr uint32_t EMPTY_SLOT = (std::numeric_limits<uint32_t>::max)();
+    static constexpr size_t INVALID_SLOT = (std::numeric_limits<size_t>::max)();
+    static constexpr size_t MIN_TABLE_SIZE = 16;
+
+    static size_t table_size_for(
+            size_t instances)
+    {
+        size_t size = MIN_TABLE_SIZE;
+        while (size < instances * 2)
+        {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    static size_t hash(
+            const InstanceHandle_t& handle)
+    {
+        // Handles of types with small keys hold the key itself, so the bits need to be mixed.
+        const rtps::octet* value = handle.value;
+        uint64_t low = 0;
+        uint64_t high = 0;
+        memcpy(&low, value, sizeof(low));
+        memcpy(&high, value + sizeof(low), sizeof(high));
+
+        uint64_t h = low ^ (high * 0x9E3779B97F4A7C15ull);
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+
+    size_t find_slot(
+            const InstanceHandle_t& handle) const
+    {
+        if (slots_.empty())
+        {
+            return INVALID_SLOT;
+        }
+
+        size_t mask = slots_.size() - 1;
+        for (size_t slot = hash(handle) & mask; EMPTY_SLOT != slots_[slot]; slot = (slot + 1) & mask)
+        {
+            if (entries_[slots_[slot]].first == handle)
+            {
+                return slot;
+            }
+        }
+
+        return INVALID_SLOT;
+    }
+
+    void erase_slot(
+            size_t hole)
+    {
+        // Backward-shift deletion: move back the entries of the probe sequence that would become unreachable.
+        size_t mask = slots_.size() - 1;
+        for (size_t next = (hole + 1) & mask; EMPTY_SLOT != slots_[next]; next = (next + 1) & mask)
+        {
+            size_t ideal = hash(entries_[slots_[next]].first) & mask;
+            if (((next - ideal) & mask) >= ((next - hole) & mask))
+            {
+                slots_[hole] = slots_[next];
+                hole = next;
+            }
+        }
+        slots_[hole] = EMPTY_SLOT;
+    }
+
+    void rehash(
+            size_t table_size)
+    {
+        slots_.assign(table_size, static_cast<uint32_t>(EMPTY_SLOT));
+        size_t mask = table_size - 1;
+        for (size_t index = 0; index < entries_.size(); ++index)
+        {
+            size_t slot = hash(entries_[index].first) & mask;
+            while (EMPTY_SLOT != slots_[slot])
+            {
+                slot = (slot + 1) & mask;
+            }
+            slots_[slot] = static_cast<uint32_t>(index);
+        }
+    }
+
+    DataReaderInstance* acquire_instance(
+            const eprosima::fastdds::ResourceLimitedContainerConfig& changes_allocation,
+            const eprosima::fastdds::ResourceLimitedContainerConfig& writers_allocation)
+    {
+        if (free_instances_.empty())
+        {
+            pool_.emplace_back(changes_allocation, writers_allocation);
+            return &pool_.back();
+        }
+
+        DataReaderInstance* ret = free_instances_.back();
+        free_instances_.pop_back();
+        return ret;
+    }
+
+    void release_instance(
+            DataReaderInstance* instance)
+    {
+        instance->reset();
+        free_instances_.push_back(instance);
+    }
+
+    //! Storage of every DataReaderInstance ever created. Elements never move.
+    std::deque<DataReaderInstance> pool_;
+    //! Instances of pool_ not currently present on the collection
+    std::vector<DataReaderInstance*> free_instances_;
+    //! Dense collection of entries
+    std::vector<value_type> entries_;
+    //! Hash table with indexes to entries_
+    std::vector<uint32_t> slots_;
+};
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif  // _FASTDDS_SUBSCRIBER_HISTORY_DATAREADERINSTANCEINDEX_HPP_
@@ -0,0 +1,708 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterCdrPlan.cpp
+ */
+
+#include "DDSFilterCdrPlan.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <fastcdr/Cdr.h>
+
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/xtypes/type_representation/ITypeObjectRegistry.hpp>
+#include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
+
+#include "DDSFilterField.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+// Encapsulation identifiers (see XTypes 1.3, section 7.6.3.1.2)
+static constexpr uint8_t CDR_BE = 0x00;
+static constexpr uint8_t CDR_LE = 0x01;
+static constexpr uint8_t CDR2_BE = 0x06;
+static constexpr uint8_t PL_CDR2_LE = 0x0b;
+
+// Length codes of XCDRv2 member headers (see XTypes 1.3, section 7.4.3.4.8)
+static constexpr uint32_t LC_NEXTINT = 4;
+static constexpr uint32_t LC_NEXTINT_X1 = 5;
+static constexpr uint32_t LC_NEXTINT_X4 = 6;
+
+static constexpr uint32_t EMHEADER_LC_SHIFT = 28;
+static constexpr uint32_t EMHEADER_LC_MASK = 0x7;
+static constexpr uint32_t EMHEADER_ID_MASK = 0x0FFFFFFF;
+
+bool DDSFilterCdrPlan::compile(
+        const xtypes::TypeObject& type_object)
+{
+    clear();
+
+    if (xtypes::EK_COMPLETE == type_object._d())
+    {
+        root_ = add_complete_type(type_object.complete(), nullptr);
+    }
+
+    valid_ = (INVALID_INDEX != root_) && (NodeKind::STRUCTURE == nodes_[root_].kind);
+    return valid_;
+}
+
+bool DDSFilterCdrPlan::add_field(
+        const DDSFilterField& field)
+{
+    if (!valid_)
+    {
+        return false;
+    }
+
+    FieldPlan plan;
+    uint32_t node = root_;
+    for (const DDSFilterField::FieldAccessor& accessor : field.access_path())
+    {
+        if (NodeKind::STRUCTURE != nodes_[node].kind || nodes_[node].members.size() <= accessor.member_index)
+        {
+            valid_ = false;
+            return false;
+        }
+
+        Step step {node, static_cast<uint32_t>(accessor.member_index), INVALID_INDEX};
+        node = nodes_[node].members[accessor.member_index].node;
+        if (accessor.array_index < MEMBER_ID_INVALID)
+        {
+            if (NodeKind::ARRAY != nodes_[node].kind && NodeKind::SEQUENCE != nodes_[node].kind)
+            {
+                valid_ = false;
+                return false;
+            }
+            step.array_index = static_cast<uint32_t>(accessor.array_index);
+            node = nodes_[node].element;
+        }
+        plan.steps.push_back(step);
+    }
+
+    // The leaf should be exactly the type the field expects to read
+    const xtypes::TypeIdentifier& type_id = field.type_id();
+    bool leaf_ok = false;
+    if (NodeKind::STRING == nodes_[node].kind)
+    {
+        leaf_ok = xtypes::TI_STRING8_SMALL == type_id._d() || xtypes::TI_STRING8_LARGE == type_id._d();
+    }
+    else if (NodeKind::PRIMITIVE == nodes_[node].kind)
+    {
+        leaf_ok = (xtypes::TK_ENUM == nodes_[node].type_kind) ?
+                xtypes::EK_COMPLETE == type_id._d() :
+                nodes_[node].type_kind == type_id._d();
+    }
+
+    if (!leaf_ok || plan.steps.empty())
+    {
+        valid_ = false;
+        return false;
+    }
+
+    plan.leaf = node;
+    fields_.push_back(std::move(plan));
+    return true;
+}
+
+void DDSFilterCdrPlan::clear()
+{
+    valid_ = false;
+    root_ = INVALID_INDEX;
+    nodes_.clear();
+    complete_types_.clear();
+    fields_.clear();
+}
+
+bool DDSFilterCdrPlan::read_encapsulation(
+        const IContentFilter::SerializedPayload& payload,
+        Encoding& encoding) const
+{
+    if (nullptr == payload.data || 4u > payload.length || 0 != payload.data[0])
+    {
+        return false;
+    }
+
+    uint8_t kind = payload.data[1];
+    if (CDR_BE == kind || CDR_LE == kind)
+    {
+        encoding.xcdr2 = false;
+    }
+    else if (CDR2_BE <= kind && PL_CDR2_LE >= kind)
+    {
+        encoding.xcdr2 = true;
+    }
+    else
+    {
+        // XCDRv1 parameter list
+        return false;
+    }
+
+    bool payload_is_le = 0 != (kind & 0x01);
+    bool host_is_le = eprosima::fastcdr::Cdr::Endianness::LITTLE_ENDIANNESS ==
+            eprosima::fastcdr::Cdr::DEFAULT_ENDIAN;
+    encoding.swap = payload_is_le != host_is_le;
+    encoding.buffer = payload.data + 4;
+    encoding.length = payload.length - 4u;
+    return true;
+}
+
+DDSFilterCdrPlan::Result DDSFilterCdrPlan::locate(
+        const Encoding& encoding,
+        size_t field_index,
+        const uint8_t*& data,
+        size_t& size) const
+{
+    assert(field_index < fields_.size());
+    const FieldPlan& plan = fields_[field_index];
+
+    Cursor cursor {encoding.buffer, 0, encoding.length, encoding.swap, encoding.xcdr2};
+    for (const Step& step : plan.steps)
+    {
+        Result ret = find_member(step.node, step.member_index, cursor);
+        if (Result::OK == ret && INVALID_INDEX != step.array_index)
+        {
+            uint32_t collection = nodes_[step.node].members[step.member_index].node;
+            ret = find_element(collection, step.array_index, cursor);
+        }
+
+        if (Result::OK != ret)
+        {
+            return ret;
+        }
+    }
+
+    const Node& leaf = nodes_[plan.leaf];
+    if (!align(cursor, NodeKind::STRING == leaf.kind ? 4u : leaf.size))
+    {
+        return Result::NOT_FOUND;
+    }
+
+    data = cursor.buffer + cursor.pos;
+    size = cursor.end - cursor.pos;
+    return Result::OK;
+}
+
+uint32_t DDSFilterCdrPlan::add_type(
+        const xtypes::TypeIdentifier& type_id)
+{
+    switch (type_id._d())
+    {
+        case xtypes::TK_BOOLEAN:
+        case xtypes::TK_BYTE:
+        case xtypes::TK_INT8:
+        case xtypes::TK_UINT8:
+        case xtypes::TK_CHAR8:
+            return add_primitive(type_id._d(), 1);
+
+        case xtypes::TK_INT16:
+        case xtypes::TK_UINT16:
+            return add_primitive(type_id._d(), 2);
+
+        case xtypes::TK_INT32:
+        case xtypes::TK_UINT32:
+        case xtypes::TK_FLOAT32:
+            return add_primitive(type_id._d(), 4);
+
+        case xtypes::TK_INT64:
+        case xtypes::TK_UINT64:
+        case xtypes::TK_FLOAT64:
+            return add_primitive(type_id._d(), 8);
+
+        case xtypes::TK_FLOAT128:
+            // Only read when the host representation matches the serialized one
+            return 16 == sizeof(long double) ? add_primitive(type_id._d(), 16) : INVALID_INDEX;
+
+        case xtypes::TI_STRING8_SMALL:
+        case xtypes::TI_STRING8_LARGE:
+        {
+            Node node;
+            node.kind = NodeKind::STRING;
+            nodes_.push_back(node);
+            return static_cast<uint32_t>(nodes_.size() - 1);
+        }
+
+        case xtypes::TI_PLAIN_SEQUENCE_SMALL:
+            return add_collection(NodeKind::SEQUENCE, *type_id.seq_sdefn().element_identifier(), 0);
+
+        case xtypes::TI_PLAIN_SEQUENCE_LARGE:
+            return add_collection(NodeKind::SEQUENCE, *type_id.seq_ldefn().element_identifier(), 0);
+
+        case xtypes::TI_PLAIN_ARRAY_SMALL:
+        {
+            uint64_t length = 1;
+            for (auto bound : type_id.array_sdefn().array_bound_seq())
+            {
+                length *= bound;
+            }
+            return add_collection(NodeKind::ARRAY, *type_id.array_sdefn().element_identifier(),
+                           static_cast<uint32_t>(length));
+        }
+
+        case xtypes::TI_PLAIN_ARRAY_LARGE:
+        {
+            uint64_t length = 1;
+            for (auto bound : type_id.array_ldefn().array_bound_seq())
+            {
+                length *= bound;
+                if (length > (std::numeric_limits<uint32_t>::max)())
+                {
+                    return INVALID_INDEX;
+                }
+            }
+            return add_collection(NodeKind::ARRAY, *type_id.array_ldefn().element_identifier(),
+                           static_cast<uint32_t>(length));
+        }
+
+        case xtypes::EK_COMPLETE:
+        {
+            auto it = complete_types_.find(type_id.equivalence_hash());
+            if (it != complete_types_.end())
+            {
+                return it->second;
+            }
+
+            xtypes::TypeObject type_object;
+            if (RETCODE_OK != DomainParticipantFactory::get_instance()->type_object_registry().get_type_object(
+                        type_id, type_object) || xtypes::EK_COMPLETE != type_object._d())
+            {
+                return INVALID_INDEX;
+            }
+            return add_complete_type(type_object.complete(), &type_id.equivalence_hash());
+        }
+
+        default:
+            break;
+    }
+
+    return INVALID_INDEX;
+}
+
+uint32_t DDSFilterCdrPlan::add_complete_type(
+        const xtypes::CompleteTypeObject& type_object,
+        const xtypes::EquivalenceHash* hash)
+{
+    switch (type_object._d())
+    {
+        case xtypes::TK_ALIAS:
+            return add_type(type_object.alias_type().body().common().related_type());
+
+        case xtypes::TK_ENUM:
+            // Fast CDR serializes enumerations with their underlying type, which is only known for 32 bits
+            return 32 == type_object.enumerated_type().header().common().bit_bound() ?
+                   add_primitive(xtypes::TK_ENUM, 4) : INVALID_INDEX;
+
+        case xtypes::TK_STRUCTURE:
+        {
+            const xtypes::CompleteStructType& struct_type = type_object.struct_type();
+            if (xtypes::TK_NONE != struct_type.header().base_type()._d())
+            {
+                // Inherited members are not part of the member indexes used by the access paths
+                return INVALID_INDEX;
+            }
+
+            Node node;
+            node.kind = NodeKind::STRUCTURE;
+            node.flags = struct_type.struct_flags();
+            nodes_.push_back(node);
+            uint32_t index = static_cast<uint32_t>(nodes_.size() - 1);
+            if (nullptr != hash)
+            {
+                // Registered before processing the members to support recursive types
+                complete_types_[*hash] = index;
+            }
+
+            std::vector<Member> members;
+            members.reserve(struct_type.member_seq().size());
+            for (const xtypes::CompleteStructMember& member : struct_type.member_seq())
+            {
+                uint32_t member_node = add_type(member.common().member_type_id());
+                if (INVALID_INDEX == member_node)
+                {
+                    return INVALID_INDEX;
+                }
+
+                members.push_back(Member{member_node, member.common().member_id(),
+                                         0 != (member.common().member_flags() & xtypes::IS_OPTIONAL)});
+            }
+            nodes_[index].members = std::move(members);
+            return index;
+        }
+
+        default:
+            break;
+    }
+
+    return INVALID_INDEX;
+}
+
+uint32_t DDSFilterCdrPlan::add_collection(
+        NodeKind kind,
+        const xtypes::TypeIdentifier& element_id,
+        uint32_t length)
+{
+    uint32_t element = add_type(element_id);
+    if (INVALID_INDEX == element)
+    {
+        return INVALID_INDEX;
+    }
+
+    Node node;
+    node.kind = kind;
+    node.element = element;
+    node.length = length;
+    nodes_.push_back(node);
+    return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+uint32_t DDSFilterCdrPlan::add_primitive(
+        xtypes::TypeKind type_kind,
+        uint8_t size)
+{
+    Node node;
+    node.kind = NodeKind::PRIMITIVE;
+    node.type_kind = type_kind;
+    node.size = size;
+    nodes_.push_back(node);
+    return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+bool DDSFilterCdrPlan::align(
+        Cursor& cursor,
+        size_t size)
+{
+    // XCDRv1 aligns up to 8 bytes, XCDRv2 up to 4 bytes
+    size_t alignment = (std::min)(size, cursor.xcdr2 ? size_t(4) : size_t(8));
+    if (1 < alignment)
+    {
+        cursor.pos = (cursor.pos + alignment - 1) & ~(alignment - 1);
+    }
+    return cursor.pos <= cursor.end;
+}
+
+bool DDSFilterCdrPlan::read_uint32(
+        Cursor& cursor,
+        uint32_t& value)
+{
+    if (!align(cursor, 4) || cursor.end - cursor.pos < 4)
+    {
+        return false;
+    }
+
+    std::memcpy(&value, cursor.buffer + cursor.pos, sizeof(value));
+    if (cursor.swap)
+    {
+        value = ((value & 0x000000FF) << 24) | ((value & 0x0000FF00) << 8) |
+                ((value & 0x00FF0000) >> 8) | ((value & 0xFF000000) >> 24);
+    }
+    cursor.pos += 4;
+    return true;
+}
+
+bool DDSFilterCdrPlan::advance(
+        Cursor& cursor,
+        size_t count,
+        size_t size)
+{
+    if (0 == count)
+    {
+        return true;
+    }
+
+    if (!align(cursor, size) || (cursor.end - cursor.pos) / size < count)
+    {
+        return false;
+    }
+
+    cursor.pos += count * size;
+    return true;
+}
+
+DDSFilterCdrPlan::Result DDSFilterCdrPlan::skip(
+        uint32_t node_index,
+        Cursor& cursor) const
+{
+    const Node& node = nodes_[node_index];
+    uint32_t count = 0;
+
+    switch (node.kind)
+    {
+        case NodeKind::PRIMITIVE:
+            return advance(cursor, 1, node.size) ? Result::OK : Result::NOT_FOUND;
+
+        case NodeKind::STRING:
+            return read_uint32(cursor, count) && advance(cursor, count, 1) ? Result::OK : Result::NOT_FOUND;
+
+        case NodeKind::STRUCTURE:
+            if (0 == (node.flags & xtypes::IS_FINAL))
+            {
+                if (cursor.xcdr2)
+                {
+                    // Skip using the DHEADER
+                    return read_uint32(cursor, count) && advance(cursor, count, 1) ? Result::OK : Result::NOT_FOUND;
+                }
+                else if (0 != (node.flags & xtypes::IS_MUTABLE))
+                {
+                    return Result::UNSUPPORTED;
+                }
+            }
+
+            for (const Member& member : node.members)
+            {
+                Result ret = skip_member(member, cursor);
+                if (Result::OK != ret)
+                {
+                    return ret;
+                }
+            }
+            return Result::OK;
+
+        case NodeKind::ARRAY:
+            if (is_primitive(node.element))
+            {
+                return advance(cursor, node.length, nodes_[node.element].size) ? Result::OK : Result::NOT_FOUND;
+            }
+            if (cursor.xcdr2)
+            {
+                return read_uint32(cursor, count) && advance(cursor, count, 1) ? Result::OK : Result::NOT_FOUND;
+            }
+            for (uint32_t i = 0; i < node.length; ++i)
+            {
+                Result ret = skip(node.element, cursor);
+                if (Result::OK != ret)
+                {
+                    return ret;
+                }
+            }
+            return Result::OK;
+
+        case NodeKind::SEQUENCE:
+            if (is_primitive(node.element))
+            {
+                return read_uint32(cursor, count) && advance(cursor, count, nodes_[node.element].size) ?
+                       Result::OK : Result::NOT_FOUND;
+            }
+            if (cursor.xcdr2)
+            {
+                return read_uint32(cursor, count) && advance(cursor, count, 1) ? Result::OK : Result::NOT_FOUND;
+            }
+            if (!read_uint32(cursor, count))
+            {
+                return Result::NOT_FOUND;
+            }
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                Result ret = skip(node.element, cursor);
+                if (Result::OK != ret)
+                {
+                    return ret;
+                }
+            }
+            return Result::OK;
+    }
+
+    return Result::UNSUPPORTED;
+}
+
+DDSFilterCdrPlan::Result DDSFilterCdrPlan::skip_member(
+        const Member& member,
+        Cursor& cursor) const
+{
+    if (member.optional)
+    {
+        if (!cursor.xcdr2)
+        {
+            // XCDRv1 serializes optional members with a parameter header
+            return Result::UNSUPPORTED;
+        }
+
+        if (cursor.pos >= cursor.end)
+        {
+            return Result::NOT_FOUND;
+        }
+
+        bool is_present = 0 != cursor.buffer[cursor.pos++];
+        if (!is_present)
+        {
+            return Result::OK;
+        }
+    }
+
+    return skip(member.node, cursor);
+}
+
+DDSFilterCdrPlan::Result DDSFilterCdrPlan::find_member(
+        uint32_t node_index,
+        uint32_t member_index,
+        Cursor& cursor) const
+{
+    const Node& node = nodes_[node_index];
+    bool is_final = 0 != (node.flags & xtypes::IS_FINAL);
+    bool is_mutable = 0 != (node.flags & xtypes::IS_MUTABLE);
+
+    if (!is_final && cursor.xcdr2)
+    {
+        uint32_t dheader = 0;
+        if (!read_uint32(cursor, dheader) || cursor.end - cursor.pos < dheader)
+        {
+            return Result::NOT_FOUND;
+        }
+        cursor.end = cursor.pos + dheader;
+
+        if (is_mutable)
+        {
+            // Look for the EMHEADER of the member
+            uint32_t member_id = node.members[member_index].id;
+            uint32_t emheader = 0;
+            while (read_uint32(cursor, emheader))
+            {
+                uint32_t lc = (emheader >> EMHEADER_LC_SHIFT) & EMHEADER_LC_MASK;
+                size_t start = cursor.pos;
+                size_t length = 0;
+                uint32_t nextint = 0;
+                if (LC_NEXTINT > lc)
+                {
+                    length = size_t(1) << lc;
+                }
+                else
+                {
+                    if (!read_uint32(cursor, nextint))
+                    {
+                        return Result::NOT_FOUND;
+                    }
+
+                    if (LC_NEXTINT == lc)
+                    {
+                        start = cursor.pos;
+                        length = nextint;
+                    }
+                    else
+                    {
+                        // NEXTINT is also the first word of the member value
+                        size_t multiplier = LC_NEXTINT_X1 == lc ? 1 : (LC_NEXTINT_X4 == lc ? 4 : 8);
+                        if ((std::numeric_limits<size_t>::max)() / multiplier <= nextint)
+                        {
+                            return Result::NOT_FOUND;
+                        }
+                        length = 4 + nextint * multiplier;
+                    }
+                }
+
+                if (cursor.end - start < length)
+                {
+                    return Result::NOT_FOUND;
+                }
+
+                if ((emheader & EMHEADER_ID_MASK) == member_id)
+                {
+                    cursor.pos = start;
+                    cursor.end = start + length;
+                    return Result::OK;
+                }
+                cursor.pos = start + length;
+            }
+
+            return Result::NOT_FOUND;
+        }
+    }
+    else if (is_mutable)
+    {
+        // XCDRv1 parameter list
+        return Result::UNSUPPORTED;
+    }
+
+    for (uint32_t i = 0; i < member_index; ++i)
+    {
+        Result ret = skip_member(node.members[i], cursor);
+        if (Result::OK != ret)
+        {
+            return ret;
+        }
+    }
+
+    const Member& member = node.members[member_index];
+    if (member.optional)
+    {
+        if (!cursor.xcdr2)
+        {
+            return Result::UNSUPPORTED;
+        }
+
+        if (cursor.pos >= cursor.end || 0 == cursor.buffer[cursor.pos++])
+        {
+            return Result::NOT_FOUND;
+        }
+    }
+
+    return Result::OK;
+}
+
+DDSFilterCdrPlan::Result DDSFilterCdrPlan::find_element(
+        uint32_t node_index,
+        uint32_t element_index,
+        Cursor& cursor) const
+{
+    const Node& node = nodes_[node_index];
+    bool primitive_elements = is_primitive(node.element);
+    uint32_t count = node.length;
+
+    if (!primitive_elements && cursor.xcdr2)
+    {
+        uint32_t dheader = 0;
+        if (!read_uint32(cursor, dheader) || cursor.end - cursor.pos < dheader)
+        {
+            return Result::NOT_FOUND;
+        }
+        cursor.end = cursor.pos + dheader;
+    }
+
+    if (NodeKind::SEQUENCE == node.kind && !read_uint32(cursor, count))
+    {
+        return Result::NOT_FOUND;
+    }
+
+    if (element_index >= count)
+    {
+        return Result::NOT_FOUND;
+    }
+
+    if (primitive_elements)
+    {
+        return advance(cursor, element_index, nodes_[node.element].size) ? Result::OK : Result::NOT_FOUND;
+    }
+
+    for (uint32_t i = 0; i < element_index; ++i)
+    {
+        Result ret = skip(node.element, cursor);
+        if (Result::OK != ret)
+        {
+            return ret;
+        }
+    }
+
+    return Result::OK;
+}
+
+}  // namespace DDSSQLFilter
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
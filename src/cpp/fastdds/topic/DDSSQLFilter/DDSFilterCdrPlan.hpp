@@ -0,0 +1,270 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterCdrPlan.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCDRPLAN_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCDRPLAN_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include <fastdds/dds/topic/IContentFilter.hpp>
+#include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+class DDSFilterField;
+
+/**
+ * A field-access plan for the fields referenced by a DDS-SQL filter expression.
+ *
+ * It is compiled from the TypeObject of the filtered type, and allows locating the referenced fields
+ * directly on a CDR serialized payload, skipping the members in between, without deserializing the
+ * whole payload.
+ * Only a subset of the type system is supported (structures without inheritance, primitive types,
+ * 32-bit enumerations, strings, and plain arrays and sequences of them). Payloads encoded with the
+ * XCDRv1 parameter list representation are not supported either.
+ */
+class DDSFilterCdrPlan final
+{
+
+public:
+
+    /**
+     * Result of locating a field on a payload.
+     */
+    enum class Result
+    {
+        OK,             ///< The field has been located
+        NOT_FOUND,      ///< The field is not present on the payload, or the payload is malformed
+        UNSUPPORTED     ///< The payload uses an encoding not supported by the plan
+    };
+
+    /**
+     * Encoding information of a payload.
+     */
+    struct Encoding
+    {
+        /// Pointer to the first byte after the encapsulation header (the CDR origin)
+        const uint8_t* buffer = nullptr;
+        /// Number of bytes after the encapsulation header
+        size_t length = 0;
+        /// Whether the payload endianness is the opposite to the host one
+        bool swap = false;
+        /// Whether the payload is encoded with XCDRv2
+        bool xcdr2 = false;
+    };
+
+    /**
+     * Compile the type information of the filtered type.
+     *
+     * @param[in] type_object  Complete TypeObject of the filtered type.
+     *
+     * @return whether the type is supported by the plan.
+     */
+    bool compile(
+            const xtypes::TypeObject& type_object);
+
+    /**
+     * Add a field to the plan.
+     * Fields are assigned consecutive indexes, starting at 0, in the order they are added.
+     *
+     * @param[in] field  The field to add.
+     *
+     * @return whether the access path and the type of the field are supported by the plan.
+     */
+    bool add_field(
+            const DDSFilterField& field);
+
+    /**
+     * @return whether the plan can be used to evaluate payloads.
+     */
+    inline bool is_valid() const noexcept
+    {
+        return valid_;
+    }
+
+    /**
+     * Clear the information held by this object.
+     */
+    void clear();
+
+    /**
+     * Read the encapsulation header of a payload.
+     *
+     * @param[in]  payload   The payload to be filtered.
+     * @param[out] encoding  The encoding information of the payload.
+     *
+     * @return whether the encoding of the payload is supported by the plan.
+     */
+    bool read_encapsulation(
+            const IContentFilter::SerializedPayload& payload,
+            Encoding& encoding) const;
+
+    /**
+     * Locate the value of a field on a payload.
+     *
+     * @param[in]  encoding     Encoding information of the payload, as returned by @c read_encapsulation.
+     * @param[in]  field_index  Index of the field, as assigned by @c add_field.
+     * @param[out] data         Pointer to the (aligned) serialized value of the field.
+     * @param[out] size         Number of bytes available from @c data.
+     *
+     * @return the result of the operation.
+     */
+    Result locate(
+            const Encoding& encoding,
+            size_t field_index,
+            const uint8_t*& data,
+            size_t& size) const;
+
+private:
+
+    static constexpr uint32_t INVALID_INDEX = (std::numeric_limits<uint32_t>::max)();
+
+    enum class NodeKind : uint8_t
+    {
+        PRIMITIVE,
+        STRING,
+        STRUCTURE,
+        ARRAY,
+        SEQUENCE
+    };
+
+    struct Member
+    {
+        /// Index of the node of the member type
+        uint32_t node;
+        /// Member id, used on mutable structures
+        uint32_t id;
+        /// Whether the member is optional
+        bool optional;
+    };
+
+    struct Node
+    {
+        NodeKind kind = NodeKind::PRIMITIVE;
+        /// PRIMITIVE: TypeKind of the value (TK_ENUM for enumerations)
+        xtypes::TypeKind type_kind = xtypes::TK_NONE;
+        /// PRIMITIVE: serialized size of the value
+        uint8_t size = 0;
+        /// STRUCTURE: extensibility flags
+        xtypes::StructTypeFlag flags = 0;
+        /// ARRAY / SEQUENCE: index of the node of the element type
+        uint32_t element = INVALID_INDEX;
+        /// ARRAY: total number of elements
+        uint32_t length = 0;
+        /// STRUCTURE: members
+        std::vector<Member> members;
+    };
+
+    struct Step
+    {
+        /// Index of the node of the structure containing the member
+        uint32_t node;
+        /// Index of the member on the structure
+        uint32_t member_index;
+        /// Element index for array / sequence members
+        uint32_t array_index;
+    };
+
+    struct FieldPlan
+    {
+        std::vector<Step> steps;
+        uint32_t leaf;
+    };
+
+    struct Cursor
+    {
+        const uint8_t* buffer;
+        size_t pos;
+        size_t end;
+        bool swap;
+        bool xcdr2;
+    };
+
+    uint32_t add_type(
+            const xtypes::TypeIdentifier& type_id);
+
+    uint32_t add_complete_type(
+            const xtypes::CompleteTypeObject& type_object,
+            const xtypes::EquivalenceHash* hash);
+
+    uint32_t add_collection(
+            NodeKind kind,
+            const xtypes::TypeIdentifier& element_id,
+            uint32_t length);
+
+    uint32_t add_primitive(
+            xtypes::TypeKind type_kind,
+            uint8_t size);
+
+    bool is_primitive(
+            uint32_t node) const
+    {
+        return NodeKind::PRIMITIVE == nodes_[node].kind;
+    }
+
+    static bool align(
+            Cursor& cursor,
+            size_t size);
+
+    static bool read_uint32(
+            Cursor& cursor,
+            uint32_t& value);
+
+    static bool advance(
+            Cursor& cursor,
+            size_t count,
+            size_t size);
+
+    Result skip(
+            uint32_t node,
+            Cursor& cursor) const;
+
+    Result skip_member(
+            const Member& member,
+            Cursor& cursor) const;
+
+    Result find_member(
+            uint32_t node,
+            uint32_t member_index,
+            Cursor& cursor) const;
+
+    Result find_element(
+            uint32_t node,
+            uint32_t element_index,
+            Cursor& cursor) const;
+
+    bool valid_ = false;
+    uint32_t root_ = INVALID_INDEX;
+    std::vector<Node> nodes_;
+    std::map<xtypes::EquivalenceHash, uint32_t> complete_types_;
+    std::vector<FieldPlan> fields_;
+};
+
+}  // namespace DDSSQLFilter
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif  // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCDRPLAN_HPP_
@@ -50,6 +50,12 @@ bool DDSFilterExpression::evaluate(
     using namespace eprosima::fastdds::dds::xtypes;
     using namespace eprosima::fastcdr;
 
+    bool result = false;
+    if (evaluate_with_plan(payload, result))
+    {
+        return result;
+    }
+
     dyn_data_->clear_all_values();
     try
     {
@@ -82,8 +88,62 @@ bool DDSFilterExpression::evaluate(
     return DDSFilterConditionState::RESULT_TRUE == root->get_state();
 }
 
+bool DDSFilterExpression::evaluate_with_plan(
+        const IContentFilter::SerializedPayload& payload,
+        bool& result) const
+{
+    DDSFilterCdrPlan::Encoding encoding;
+    if (!cdr_plan_.is_valid() || !cdr_plan_.read_encapsulation(payload, encoding))
+    {
+        return false;
+    }
+
+    root->reset();
+    size_t field_index = 0;
+    for (auto it = fields.begin();
+            it != fields.end() && DDSFilterConditionState::UNDECIDED == root->get_state();
+            ++it, ++field_index)
+    {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        DDSFilterCdrPlan::Result ret = cdr_plan_.locate(encoding, field_index, data, size);
+        if (DDSFilterCdrPlan::Result::UNSUPPORTED == ret)
+        {
+            return false;
+        }
+
+        if (DDSFilterCdrPlan::Result::NOT_FOUND == ret || !it->second->set_value(data, size, encoding.swap))
+        {
+            result = false;
+            return true;
+        }
+    }
+
+    result = DDSFilterConditionState::RESULT_TRUE == root->get_state();
+    return true;
+}
+
+bool DDSFilterExpression::compile_plan(
+        const xtypes::TypeObject& type_object)
+{
+    if (cdr_plan_.compile(type_object))
+    {
+        // Fields are added in the same order they are evaluated
+        for (const auto& field : fields)
+        {
+            if (!cdr_plan_.add_field(*field.second))
+            {
+                break;
+            }
+        }
+    }
+
+    return cdr_plan_.is_valid();
+}
+
 void DDSFilterExpression::clear()
 {
+    cdr_plan_.clear();
     DynamicDataFactory::get_instance()->delete_data(dyn_data_);
     DynamicTypeBuilderFactory::get_instance()->delete_type(dyn_type_);
     parameters.clear();
@@ -28,6 +28,7 @@
 #include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
 
+#include "DDSFilterCdrPlan.hpp"
 #include "DDSFilterCondition.hpp"
 #include "DDSFilterField.hpp"
 #include "DDSFilterParameter.hpp"
@@ -65,6 +66,26 @@ public:
     void set_type(
             DynamicType::_ref_type type);
 
+    /**
+     * Compile the field-access plan used to evaluate this expression directly on the serialized payloads.
+     * Should be called once the fields of the expression have been set.
+     * When the plan cannot be compiled, payloads are deserialized into a DynamicData for evaluation.
+     *
+     * @param [in] type_object  Complete TypeObject of the filtered type.
+     *
+     * @return whether the plan could be compiled.
+     */
+    bool compile_plan(
+            const xtypes::TypeObject& type_object);
+
+    /**
+     * @return whether payloads are evaluated with the field-access plan, without deserializing them.
+     */
+    bool has_plan() const
+    {
+        return cdr_plan_.is_valid();
+    }
+
     /// The root condition of the expression tree.
     std::unique_ptr<DDSFilterCondition> root;
     /// The fields referenced by this expression.
@@ -74,6 +95,20 @@ public:
 
 private:
 
+    /**
+     * Evaluate the expression using the field-access plan.
+     *
+     * @param [in]  payload  The payload to be filtered.
+     * @param [out] result   The result of the evaluation.
+     *
+     * @return false when the payload is not supported by the plan, and should be deserialized.
+     */
+    bool evaluate_with_plan(
+            const SerializedPayload& payload,
+            bool& result) const;
+
+    /// The field-access plan used to evaluate the payloads without deserializing them
+    DDSFilterCdrPlan cdr_plan_;
     /// The Dynamic type used to deserialize the payloads
     DynamicType::_ref_type dyn_type_;
     /// The Dynamic data used to deserialize the payloads
@@ -19,6 +19,7 @@
 #include "DDSFilterField.hpp"
 
 #include <cassert>
+#include <cstring>
 #include <unordered_set>
 #include <vector>
 
@@ -88,19 +89,151 @@ bool DDSFilterField::set_value(
 
     if (ret && last_step)
     {
-        has_value_ = true;
-        value_has_changed();
+        value_was_set();
+    }
 
-        // Inform parent predicates
-        for (DDSFilterPredicate* parent : parents_)
+    return ret;
+}
+
+template<typename T>
+static T read_cdr_value(
+        const uint8_t* data,
+        bool swap)
+{
+    T value;
+    if (swap)
+    {
+        uint8_t* dst = reinterpret_cast<uint8_t*>(&value);
+        for (size_t i = 0; i < sizeof(T); ++i)
         {
-            parent->value_has_changed();
+            dst[i] = data[sizeof(T) - 1 - i];
         }
     }
+    else
+    {
+        std::memcpy(&value, data, sizeof(T));
+    }
+    return value;
+}
+
+bool DDSFilterField::set_value(
+        const uint8_t* data,
+        size_t size,
+        bool swap)
+{
+    bool ret = false;
+    switch (type_id_->_d())
+    {
+        case eprosima::fastdds::dds::xtypes::TK_BOOLEAN:
+            ret = 1 <= size;
+            boolean_value = ret && 0 != data[0];
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_CHAR8:
+            ret = 1 <= size;
+            char_value = ret ? static_cast<char>(data[0]) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_STRING8:
+        case eprosima::fastdds::dds::xtypes::TI_STRING8_SMALL:
+        case eprosima::fastdds::dds::xtypes::TI_STRING8_LARGE:
+            if (4 <= size)
+            {
+                uint32_t length = read_cdr_value<uint32_t>(data, swap);
+                string_value = "";
+                if (0 == length)
+                {
+                    ret = true;
+                }
+                else if (size - 4 >= length && '\0' == data[4 + length - 1])
+                {
+                    string_value = reinterpret_cast<const char*>(&data[4]);
+                    ret = true;
+                }
+            }
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_INT8:
+            ret = 1 <= size;
+            signed_integer_value = ret ? static_cast<int8_t>(data[0]) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_INT16:
+            ret = 2 <= size;
+            signed_integer_value = ret ? read_cdr_value<int16_t>(data, swap) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_INT32:
+        case eprosima::fastdds::dds::xtypes::EK_COMPLETE:
+            ret = 4 <= size;
+            signed_integer_value = ret ? read_cdr_value<int32_t>(data, swap) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_INT64:
+            ret = 8 <= size;
+            signed_integer_value = ret ? read_cdr_value<int64_t>(data, swap) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_BYTE:
+        case eprosima::fastdds::dds::xtypes::TK_UINT8:
+            ret = 1 <= size;
+            unsigned_integer_value = ret ? data[0] : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_UINT16:
+            ret = 2 <= size;
+            unsigned_integer_value = ret ? read_cdr_value<uint16_t>(data, swap) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_UINT32:
+            ret = 4 <= size;
+            unsigned_integer_value = ret ? read_cdr_value<uint32_t>(data, swap) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_UINT64:
+            ret = 8 <= size;
+            unsigned_integer_value = ret ? read_cdr_value<uint64_t>(data, swap) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_FLOAT32:
+            ret = 4 <= size;
+            float_value = ret ? read_cdr_value<float>(data, swap) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_FLOAT64:
+            ret = 8 <= size;
+            float_value = ret ? read_cdr_value<double>(data, swap) : 0;
+            break;
+
+        case eprosima::fastdds::dds::xtypes::TK_FLOAT128:
+            ret = sizeof(long double) <= size;
+            float_value = ret ? read_cdr_value<long double>(data, swap) : 0;
+            break;
+
+        default:
+            break;
+    }
+
+    if (ret)
+    {
+        value_was_set();
+    }
 
     return ret;
 }
 
+void DDSFilterField::value_was_set()
+{
+    has_value_ = true;
+    value_has_changed();
+
+    // Inform parent predicates
+    for (DDSFilterPredicate* parent : parents_)
+    {
+        parent->value_has_changed();
+    }
+}
+
 bool DDSFilterField::set_value_using_member_id(
         DynamicData::_ref_type data,
         MemberId member_id)
@@ -123,6 +123,39 @@ public:
             DynamicData::_ref_type data,
             size_t n);
 
+    /**
+     * Read the value of the field represented by this DDSFilterField directly from its CDR representation.
+     * Will notify the predicates where this DDSFilterField is being used.
+     *
+     * @param[in]  data  Pointer to the serialized value, already aligned.
+     * @param[in]  size  Number of bytes available from @c data.
+     * @param[in]  swap  Whether the serialized value has the opposite endianness to the host one.
+     *
+     * @return Whether the deserialization process succeeded.
+     *
+     * @post Method @c has_value returns true.
+     */
+    bool set_value(
+            const uint8_t* data,
+            size_t size,
+            bool swap);
+
+    /**
+     * @return the access path to the field.
+     */
+    inline const std::vector<FieldAccessor>& access_path() const noexcept
+    {
+        return access_path_;
+    }
+
+    /**
+     * @return the TypeIdentifier of the data type of the field.
+     */
+    inline const xtypes::TypeIdentifier& type_id() const noexcept
+    {
+        return *type_id_;
+    }
+
 protected:
 
     inline void add_parent(
@@ -138,6 +171,8 @@ private:
             DynamicData::_ref_type data,
             MemberId member_id);
 
+    void value_was_set();
+
     bool has_value_ = false;
     std::vector<FieldAccessor> access_path_;
     const std::shared_ptr<xtypes::TypeIdentifier> type_id_;
@@ -160,6 +160,7 @@ void set_qos_from_attributes(
     qos.timed_events_thread() = attr.timed_events_thread;
     qos.discovery_server_thread() = attr.discovery_server_thread;
     qos.typelookup_service_thread() = attr.typelookup_service_thread;
+    qos.persistence_commit_thread() = attr.persistence_commit_thread;
 #if HAVE_SECURITY
     qos.security_log_thread() = attr.security_log_thread;
 #endif // if HAVE_SECURITY
@@ -208,6 +209,7 @@ void set_attributes_from_qos(
     attr.timed_events_thread = qos.timed_events_thread();
     attr.discovery_server_thread = qos.discovery_server_thread();
     attr.typelookup_service_thread = qos.typelookup_service_thread();
+    attr.persistence_commit_thread = qos.persistence_commit_thread();
 #if HAVE_SECURITY
     attr.security_log_thread = qos.security_log_thread();
 #endif // if HAVE_SECURITY
@@ -21,6 +21,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <new>
 #include <numeric>
 #include <string>
 #include <vector>
@@ -162,13 +163,12 @@ DynamicDataImpl::DynamicDataImpl(
     {
         for (auto& member : enclosing_type_->get_all_members_by_index())
         {
-            traits<DynamicData>::ref_type data = DynamicDataFactory::get_instance()->create_data(
-                member->get_descriptor().type());
-            traits<DynamicDataImpl>::ref_type data_impl = traits<DynamicData>::narrow<DynamicDataImpl>(data);
+            traits<DynamicDataImpl>::ref_type data_impl =
+                    std::make_shared<DynamicDataImpl>(member->get_descriptor().type());
 
             set_default_value(member, data_impl);
 
-            value_.emplace(member->get_id(), data);
+            value_.emplace(member->get_id(), std::move(data_impl));
         }
     }
     else if (TK_ARRAY == type_kind ||
@@ -192,6 +192,22 @@ DynamicDataImpl::DynamicDataImpl(
     }
 }
 
+DynamicDataImpl::~DynamicDataImpl() noexcept
+{
+    // Only strings need to be destroyed, the rest of kinds stored inline are trivially destructible.
+    using String8 = TypeForKind<TK_STRING8>;
+    using String16 = TypeForKind<TK_STRING16>;
+
+    if (TK_STRING8 == inline_value_kind_)
+    {
+        reinterpret_cast<String8*>(&inline_value_)->~String8();
+    }
+    else if (TK_STRING16 == inline_value_kind_)
+    {
+        reinterpret_cast<String16*>(&inline_value_)->~String16();
+    }
+}
+
 ReturnCode_t DynamicDataImpl::clear_all_values() noexcept
 {
     return clear_all_values(false);
@@ -2208,87 +2224,87 @@ std::map<MemberId, std::shared_ptr<void>>::iterator DynamicDataImpl::add_value(
     {
         case TK_INT32:
         {
-            ret_value =  value_.emplace(id, std::make_shared<TypeForKind<TK_INT32>>()).first;
+            ret_value = add_value<TK_INT32>(id);
         }
         break;
         case TK_UINT32:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_UINT32>>()).first;
+            ret_value = add_value<TK_UINT32>(id);
         }
         break;
         case TK_INT8:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_INT8>>()).first;
+            ret_value = add_value<TK_INT8>(id);
         }
         break;
         case TK_INT16:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_INT16>>()).first;
+            ret_value = add_value<TK_INT16>(id);
         }
         break;
         case TK_UINT16:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_UINT16>>()).first;
+            ret_value = add_value<TK_UINT16>(id);
         }
         break;
         case TK_INT64:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_INT64>>()).first;
+            ret_value = add_value<TK_INT64>(id);
         }
         break;
         case TK_UINT64:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_UINT64>>()).first;
+            ret_value = add_value<TK_UINT64>(id);
         }
         break;
         case TK_FLOAT32:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_FLOAT32>>()).first;
+            ret_value = add_value<TK_FLOAT32>(id);
         }
         break;
         case TK_FLOAT64:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_FLOAT64>>()).first;
+            ret_value = add_value<TK_FLOAT64>(id);
         }
         break;
         case TK_FLOAT128:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_FLOAT128>>()).first;
+            ret_value = add_value<TK_FLOAT128>(id);
         }
         break;
         case TK_CHAR8:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_CHAR8>>()).first;
+            ret_value = add_value<TK_CHAR8>(id);
         }
         break;
         case TK_CHAR16:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_CHAR16>>()).first;
+            ret_value = add_value<TK_CHAR16>(id);
         }
         break;
         case TK_BOOLEAN:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_BOOLEAN>>()).first;
+            ret_value = add_value<TK_BOOLEAN>(id);
         }
         break;
         case TK_BYTE:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_BYTE>>()).first;
+            ret_value = add_value<TK_BYTE>(id);
         }
         break;
         case TK_UINT8:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_UINT8>>()).first;
+            ret_value = add_value<TK_UINT8>(id);
         }
         break;
         case TK_STRING8:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_STRING8>>()).first;
+            ret_value = add_value<TK_STRING8>(id);
         }
         break;
         case TK_STRING16:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_STRING16>>()).first;
+            ret_value = add_value<TK_STRING16>(id);
         }
         break;
         default:
@@ -2298,6 +2314,21 @@ std::map<MemberId, std::shared_ptr<void>>::iterator DynamicDataImpl::add_value(
     return ret_value;
 }
 
+template<TypeKind TK>
+std::map<MemberId, std::shared_ptr<void>>::iterator DynamicDataImpl::add_value(
+        MemberId id) noexcept
+{
+    if (MEMBER_ID_INVALID == id && TK_NONE == inline_value_kind_)
+    {
+        TypeForKind<TK>* value = new (&inline_value_) TypeForKind<TK>();
+        inline_value_kind_ = TK;
+        // The value is owned by this object, so the pointer doesn't need a control block.
+        return value_.emplace(id, std::shared_ptr<void>(std::shared_ptr<void>(), value)).first;
+    }
+
+    return value_.emplace(id, std::make_shared<TypeForKind<TK>>()).first;
+}
+
 uint32_t DynamicDataImpl::calculate_array_max_elements(
         TypeKind type_kind) noexcept
 {
@@ -16,6 +16,7 @@
 #define FASTDDS_XTYPES_DYNAMIC_TYPES_DYNAMICDATAIMPL_HPP
 
 #include <map>
+#include <type_traits>
 #include <vector>
 
 #include <fastdds/dds/core/Types.hpp>
@@ -59,6 +60,13 @@ class DynamicDataImpl : public traits<DynamicData>::base_type
     //! Points to the current selected member in the union.
     MemberId selected_union_member_ {MEMBER_ID_INVALID};
 
+    //! Storage for the value of a primitive or string sample, which avoids allocating it separately.
+    std::aligned_union<0, TypeForKind<TK_FLOAT128>, TypeForKind<TK_STRING8>, TypeForKind<TK_STRING16>>::type
+    inline_value_;
+
+    //! Kind of the value constructed in `inline_value_`. TK_NONE if not used.
+    TypeKind inline_value_kind_ {TK_NONE};
+
     //}}}
 
 public:
@@ -70,6 +78,14 @@ public:
     DynamicDataImpl(
             traits<DynamicType>::ref_type type) noexcept;
 
+    DynamicDataImpl(
+            const DynamicDataImpl&) = delete;
+
+    DynamicDataImpl& operator =(
+            const DynamicDataImpl&) = delete;
+
+    ~DynamicDataImpl() noexcept;
+
     ReturnCode_t clear_all_values() noexcept override;
 
     ReturnCode_t clear_nonkey_values() noexcept override;
@@ -458,6 +474,14 @@ private:
             TypeKind kind,
             MemberId id) noexcept;
 
+    /*!
+     * Auxiliary function to add a value of kind TK.
+     * The value of a primitive or string sample (@p id equal to MEMBER_ID_INVALID) is constructed in `inline_value_`.
+     */
+    template<TypeKind TK>
+    std::map<MemberId, std::shared_ptr<void>>::iterator add_value(
+            MemberId id) noexcept;
+
     /*!
      * Auxiliary function for getting the initial number of elements for TK_ARRAY.
      */
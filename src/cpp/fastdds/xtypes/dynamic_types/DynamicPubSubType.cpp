@@ -27,6 +27,7 @@
 #include "DynamicDataImpl.hpp"
 #include "DynamicTypeImpl.hpp"
 #include <rtps/RTPSDomainImpl.hpp>
+#include <utils/KeyHashCache.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -34,6 +35,10 @@ namespace dds {
 
 //{{{ Public functions
 
+DynamicPubSubType::DynamicPubSubType()
+{
+}
+
 DynamicPubSubType::DynamicPubSubType(
         traits<DynamicType>::ref_type type)
     : dynamic_type_(type)
@@ -117,10 +122,14 @@ bool DynamicPubSubType::getKey(
     size_t keyBufferSize =
             static_cast<uint32_t>((*data_ptr)->calculate_key_serialized_size(calculator, current_alignment));
 
-    if (nullptr == key_buffer_)
+    // Keys of different lengths (e.g. strings) may need a bigger buffer than the one allocated for a previous key.
+    size_t required_size {keyBufferSize > 16 ? keyBufferSize : 16};
+    if (key_buffer_size_ < required_size)
     {
-        key_buffer_ = reinterpret_cast<unsigned char*>(malloc(keyBufferSize > 16 ? keyBufferSize : 16));
-        memset(key_buffer_, 0, keyBufferSize > 16 ? keyBufferSize : 16);
+        free(key_buffer_);
+        key_buffer_ = reinterpret_cast<unsigned char*>(malloc(required_size));
+        memset(key_buffer_, 0, required_size);
+        key_buffer_size_ = required_size;
     }
 
     eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(key_buffer_), keyBufferSize);
@@ -130,19 +139,32 @@ bool DynamicPubSubType::getKey(
     (*data_ptr)->serialize_key(ser);
     if (force_md5 || keyBufferSize > 16)
     {
+        size_t key_length {ser.get_serialized_data_length()};
+        if (key_hash_cache_ && key_hash_cache_->find(key_buffer_, key_length, *handle))
+        {
+            return true;
+        }
+
         md5_.init();
-        md5_.update(key_buffer_, (unsigned int)ser.get_serialized_data_length());
+        md5_.update(key_buffer_, (unsigned int)key_length);
         md5_.finalize();
         for (uint8_t i = 0; i < 16; ++i)
         {
             handle->value[i] = md5_.digest[i];
         }
+
+        if (key_hash_cache_)
+        {
+            key_hash_cache_->insert(key_buffer_, key_length, *handle);
+        }
     }
     else
     {
+        // The buffer may keep bytes of a previous longer key after the current one.
+        size_t key_length {ser.get_serialized_data_length()};
         for (uint8_t i = 0; i < 16; ++i)
         {
-            handle->value[i] = key_buffer_[i];
+            handle->value[i] = i < key_length ? key_buffer_[i] : 0;
         }
     }
     return true;
@@ -234,6 +256,19 @@ ReturnCode_t DynamicPubSubType::set_dynamic_type(
     return RETCODE_BAD_PARAMETER;
 }
 
+void DynamicPubSubType::set_key_hash_cache_size(
+        uint32_t max_entries)
+{
+    if (0 == max_entries)
+    {
+        key_hash_cache_.reset();
+    }
+    else
+    {
+        key_hash_cache_.reset(new fastdds::rtps::KeyHashCache(max_entries));
+    }
+}
+
 void DynamicPubSubType::register_type_object_representation()
 {
     if (dynamic_type_)
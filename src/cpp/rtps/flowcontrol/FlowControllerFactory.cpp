@@ -1,5 +1,10 @@
 #include "FlowControllerFactory.hpp"
 #include "FlowControllerImpl.hpp"
+#include "ShardedFlowController.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include <fastdds/dds/log/Log.hpp>
 
@@ -58,6 +63,39 @@ void FlowControllerFactory::register_flow_controller (
         return;
     }
 
+    std::unique_ptr<FlowController> flow_controller;
+
+    if (1 < flow_controller_descr.num_sender_threads)
+    {
+        // Each shard sends on its own thread, but all of them share the configured bandwidth.
+        std::shared_ptr<FlowControllerSharedBandwidth> shared_bandwidth;
+        if (0 < flow_controller_descr.max_bytes_per_period)
+        {
+            shared_bandwidth = std::make_shared<FlowControllerSharedBandwidth>(
+                flow_controller_descr, flow_controller_descr.num_sender_threads);
+        }
+
+        std::vector<std::unique_ptr<FlowController>> shards;
+        shards.reserve(flow_controller_descr.num_sender_threads);
+        for (uint32_t i = 0; i < flow_controller_descr.num_sender_threads; ++i)
+        {
+            shards.push_back(create_flow_controller(flow_controller_descr, shared_bandwidth));
+        }
+        flow_controller.reset(new ShardedFlowController(std::move(shards)));
+    }
+    else
+    {
+        flow_controller = create_flow_controller(flow_controller_descr);
+    }
+
+    flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                flow_controller_descr.name, std::move(flow_controller)));
+}
+
+std::unique_ptr<FlowController> FlowControllerFactory::create_flow_controller(
+        const FlowControllerDescriptor& flow_controller_descr,
+        const std::shared_ptr<FlowControllerSharedBandwidth>& shared_bandwidth)
+{
     const ThreadSettings& sender_thread_settings = flow_controller_descr.sender_thread;
 
     if (0 < flow_controller_descr.max_bytes_per_period)
@@ -65,39 +103,32 @@ void FlowControllerFactory::register_flow_controller (
         switch (flow_controller_descr.scheduler)
         {
             case FlowControllerSchedulerPolicy::FIFO:
-                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
-                            flow_controller_descr.name,
-                            std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
-                                FlowControllerFifoSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
-                break;
+                return std::unique_ptr<FlowController>(
+                    new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                    FlowControllerFifoSchedule>(participant_,
+                    &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                    shared_bandwidth));
             case FlowControllerSchedulerPolicy::ROUND_ROBIN:
-                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
-                            flow_controller_descr.name,
-                            std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
-                                FlowControllerRoundRobinSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
-                break;
+                return std::unique_ptr<FlowController>(
+                    new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                    FlowControllerRoundRobinSchedule>(participant_,
+                    &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                    shared_bandwidth));
             case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
-                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
-                            flow_controller_descr.name,
-                            std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
-                                FlowControllerHighPrioritySchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
-                break;
+                return std::unique_ptr<FlowController>(
+                    new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                    FlowControllerHighPrioritySchedule>(participant_,
+                    &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                    shared_bandwidth));
             case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
-                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
-                            flow_controller_descr.name,
-                            std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
-                                FlowControllerPriorityWithReservationSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
-                break;
+                return std::unique_ptr<FlowController>(
+                    new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                    FlowControllerPriorityWithReservationSchedule>(participant_,
+                    &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                    shared_bandwidth));
             default:
                 assert(false);
+                break;
         }
     }
     else
@@ -105,41 +136,32 @@ void FlowControllerFactory::register_flow_controller (
         switch (flow_controller_descr.scheduler)
         {
             case FlowControllerSchedulerPolicy::FIFO:
-                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
-                            flow_controller_descr.name,
-                            std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                FlowControllerFifoSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
-                break;
+                return std::unique_ptr<FlowController>(
+                    new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                    FlowControllerFifoSchedule>(participant_,
+                    &flow_controller_descr, async_controller_index_++, sender_thread_settings));
             case FlowControllerSchedulerPolicy::ROUND_ROBIN:
-                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
-                            flow_controller_descr.name,
-                            std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                FlowControllerRoundRobinSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
-                break;
+                return std::unique_ptr<FlowController>(
+                    new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                    FlowControllerRoundRobinSchedule>(participant_,
+                    &flow_controller_descr, async_controller_index_++, sender_thread_settings));
             case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
-                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
-                            flow_controller_descr.name,
-                            std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                FlowControllerHighPrioritySchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
-                break;
+                return std::unique_ptr<FlowController>(
+                    new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                    FlowControllerHighPrioritySchedule>(participant_,
+                    &flow_controller_descr, async_controller_index_++, sender_thread_settings));
             case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
-                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
-                            flow_controller_descr.name,
-                            std::unique_ptr<FlowController>(
-                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                FlowControllerPriorityWithReservationSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
-                break;
+                return std::unique_ptr<FlowController>(
+                    new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                    FlowControllerPriorityWithReservationSchedule>(participant_,
+                    &flow_controller_descr, async_controller_index_++, sender_thread_settings));
             default:
                 assert(false);
+                break;
         }
     }
+
+    return nullptr;
 }
 
 /*!
@@ -5,8 +5,9 @@
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include "FlowController.hpp"
 
-#include <string>
 #include <map>
+#include <memory>
+#include <string>
 
 namespace eprosima {
 
@@ -14,6 +15,7 @@ namespace fastdds {
 namespace rtps {
 class RTPSParticipantImpl;
 class FlowController;
+class FlowControllerSharedBandwidth;
 
 const char* const pure_sync_flow_controller_name = "PureSyncFlowController";
 const char* const sync_flow_controller_name = "SyncFlowController";
@@ -62,6 +64,17 @@ public:
 
 private:
 
+    /*!
+     * Create a single flow controller, with its own sender thread, given its descriptor.
+     *
+     * @param flow_controller_descr FlowController descriptor.
+     * @param shared_bandwidth Bandwidth shared with other flow controllers. nullptr to use its own bandwidth.
+     * @return The created FlowController.
+     */
+    std::unique_ptr<FlowController> create_flow_controller(
+            const FlowControllerDescriptor& flow_controller_descr,
+            const std::shared_ptr<FlowControllerSharedBandwidth>& shared_bandwidth = nullptr);
+
     fastdds::rtps::RTPSParticipantImpl* participant_ = nullptr;
 
     //! Stores the created flow controllers.
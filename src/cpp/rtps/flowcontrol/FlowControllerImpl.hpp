@@ -1,10 +1,13 @@
 #ifndef _RTPS_FLOWCONTROL_FLOWCONTROLLERIMPL_HPP_
 #define _RTPS_FLOWCONTROL_FLOWCONTROLLERIMPL_HPP_
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "FlowController.hpp"
@@ -272,7 +275,146 @@ struct FlowControllerSyncPublishMode : public FlowControllerPureSyncPublishMode,
 
 };
 
+/*!
+ * Bandwidth shared by the flow controllers (shards) of a ShardedFlowController.
+ *
+ * Each shard takes bytes from it before sending them, and gives back the ones it did not use, so the limitation
+ * configured on the descriptor applies to the data sent by all the shards together.
+ */
+class FlowControllerSharedBandwidth
+{
+public:
+
+    /*!
+     * Constructor.
+     *
+     * @param descriptor Descriptor of the flow controller. Its max_bytes_per_period should be greater than 0.
+     * @param num_shards Number of shards sharing the bandwidth.
+     */
+    FlowControllerSharedBandwidth(
+            const FlowControllerDescriptor& descriptor,
+            uint32_t num_shards)
+        : bytes_per_period_(descriptor.max_bytes_per_period)
+        , period_ms_(descriptor.period_ms)
+        , token_bucket_(0 < descriptor.max_burst_bytes && 0 < descriptor.period_ms)
+    {
+        assert(0 < descriptor.max_bytes_per_period);
+        assert(0 < num_shards);
+
+        capacity_ = static_cast<uint32_t>(token_bucket_ ?
+                (std::min)(descriptor.max_burst_bytes, descriptor.max_bytes_per_period) :
+                descriptor.max_bytes_per_period);
+        available_ = capacity_;
+        chunk_ = (std::max)(1u, capacity_ / num_shards);
+    }
+
+    //! Number of bytes a shard takes at once, so a single shard does not take the whole bandwidth.
+    uint32_t chunk() const
+    {
+        return chunk_;
+    }
+
+    /*!
+     * Take up to a number of bytes from the available ones.
+     *
+     * @param bytes Number of bytes to take.
+     * @return Number of bytes taken.
+     */
+    uint32_t take(
+            uint32_t bytes)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        update_nts();
+        uint32_t taken = (std::min)(bytes, available_);
+        available_ -= taken;
+        return taken;
+    }
+
+    /*!
+     * Give back bytes that were taken and not sent.
+     *
+     * @param bytes Number of bytes to give back.
+     */
+    void give_back(
+            uint32_t bytes)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        update_nts();
+        available_ = (std::min)(capacity_, available_ + bytes);
+    }
+
+    /*!
+     * Time until a number of bytes are available.
+     *
+     * @param bytes Number of bytes.
+     * @return Time to wait, zero if they are already available.
+     */
+    std::chrono::steady_clock::duration time_to_get(
+            uint32_t bytes)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        update_nts();
+        uint32_t needed = (std::min)(bytes, capacity_);
+        if (needed <= available_)
+        {
+            return std::chrono::steady_clock::duration::zero();
+        }
+
+        if (token_bucket_)
+        {
+            std::chrono::duration<double, std::milli> time(
+                static_cast<double>(needed - available_) * period_ms_ / bytes_per_period_);
+            // Round up, so the wake up is not before the bytes are available.
+            return std::chrono::duration_cast<std::chrono::steady_clock::duration>(time) +
+                   std::chrono::steady_clock::duration(1);
+        }
+
+        return last_update_ + std::chrono::milliseconds(period_ms_) - std::chrono::steady_clock::now();
+    }
+
+private:
+
+    //! Add the bytes generated since the last update.
+    void update_nts()
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (token_bucket_)
+        {
+            std::chrono::duration<double, std::milli> elapsed = now - last_update_;
+            double generated = elapsed.count() * bytes_per_period_ / period_ms_;
+            if (1.0 <= generated)
+            {
+                available_ = static_cast<uint32_t>((std::min)(static_cast<double>(capacity_),
+                        available_ + generated));
+                last_update_ = now;
+            }
+        }
+        else if (std::chrono::milliseconds(period_ms_) <= now - last_update_)
+        {
+            available_ = capacity_;
+            last_update_ = now;
+        }
+    }
+
+    std::mutex mutex_;
+
+    int32_t bytes_per_period_;
+
+    uint64_t period_ms_;
+
+    bool token_bucket_;
+
+    uint32_t capacity_ = 0;
+
+    uint32_t chunk_ = 0;
+
+    uint32_t available_ = 0;
+
+    std::chrono::steady_clock::time_point last_update_ = std::chrono::steady_clock::now();
+};
+
 //! Sends all samples asynchronously but with bandwidth limitation.
+//! When a maximum burst is configured, the bandwidth is enforced with a token bucket instead of a budget per period.
 struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublishMode
 {
     FlowControllerLimitedAsyncPublishMode(
@@ -285,7 +427,35 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
         max_bytes_per_period = descriptor->max_bytes_per_period;
         period_ms = std::chrono::milliseconds(descriptor->period_ms);
-        group.set_sent_bytes_limitation(static_cast<uint32_t>(max_bytes_per_period));
+
+        if (0 < descriptor->max_burst_bytes && 0 < descriptor->period_ms)
+        {
+            max_burst_bytes = (std::min)(descriptor->max_burst_bytes, max_bytes_per_period);
+            tokens_ = max_burst_bytes;
+            sent_bytes_limitation_ = static_cast<uint32_t>(max_burst_bytes);
+        }
+        else
+        {
+            sent_bytes_limitation_ = static_cast<uint32_t>(max_bytes_per_period);
+        }
+
+        group.set_sent_bytes_limitation(sent_bytes_limitation_);
+    }
+
+    /*!
+     * Make this flow controller take its bandwidth from one shared with other flow controllers.
+     *
+     * @param shared_bandwidth Shared bandwidth.
+     */
+    void set_shared_bandwidth(
+            const std::shared_ptr<FlowControllerSharedBandwidth>& shared_bandwidth)
+    {
+        shared_bandwidth_ = shared_bandwidth;
+
+        if (shared_bandwidth_)
+        {
+            take_shared_bandwidth();
+        }
     }
 
     bool fast_check_is_there_slot_for_change(
@@ -307,11 +477,13 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
         }
 
-        bool ret = (max_bytes_per_period - group.get_current_bytes_processed()) > size_to_check;
+        uint32_t current_bytes = group.get_current_bytes_processed();
+        bool ret = sent_bytes_limitation_ > current_bytes && (sent_bytes_limitation_ - current_bytes) > size_to_check;
 
         if (!ret)
         {
             force_wait_ = true;
+            pending_bytes_ = size_to_check;
         }
 
         return ret;
@@ -321,6 +493,12 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
      * Wait until there is a new change added (notified by other thread) or there is a timeout (period was excedded and
      * the bandwidth limitation has to be reset.
      *
+     * When pacing with a token bucket, the wait also finishes as soon as there are enough tokens to send the pending
+     * data, and the bucket is refilled on every wake up.
+     *
+     * When the bandwidth is shared with other flow controllers, the bytes not sent are given back before waiting, and
+     * new ones are taken on every wake up.
+     *
      * @return false if the condition_variable was awaken because a new change was added. true if the condition_variable was awaken because the bandwidth limitation has to be reset.
      */
     bool wait(
@@ -329,6 +507,73 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
         auto lapse = std::chrono::steady_clock::now() - last_period_;
         bool reset_limit = true;
 
+        if (shared_bandwidth_)
+        {
+            uint32_t current_bytes = group.get_current_bytes_processed();
+            if (sent_bytes_limitation_ > current_bytes)
+            {
+                shared_bandwidth_->give_back(sent_bytes_limitation_ - current_bytes);
+            }
+            sent_bytes_limitation_ = 0;
+
+            std::chrono::steady_clock::duration timeout = std::chrono::steady_clock::duration::zero();
+            if (lapse < period_ms)
+            {
+                timeout = period_ms - lapse;
+            }
+            if (force_wait_)
+            {
+                timeout = (std::min)(timeout, shared_bandwidth_->time_to_get(pending_bytes_ + 1));
+            }
+
+            if (std::chrono::steady_clock::duration::zero() < timeout)
+            {
+                cv.wait_for(lock, timeout);
+            }
+
+            take_shared_bandwidth();
+
+            // Writers' bandwidth reservations are still renewed on each period.
+            auto now = std::chrono::steady_clock::now();
+            reset_limit = period_ms <= (now - last_period_);
+            if (reset_limit)
+            {
+                last_period_ = now;
+            }
+
+            return reset_limit;
+        }
+
+        if (0 < max_burst_bytes)
+        {
+            std::chrono::steady_clock::duration timeout = std::chrono::steady_clock::duration::zero();
+            if (lapse < period_ms)
+            {
+                timeout = period_ms - lapse;
+            }
+            if (force_wait_)
+            {
+                timeout = (std::min)(timeout, time_to_get_tokens(pending_bytes_));
+            }
+
+            if (std::chrono::steady_clock::duration::zero() < timeout)
+            {
+                cv.wait_for(lock, timeout);
+            }
+
+            refill_tokens();
+
+            // Writers' bandwidth reservations are still renewed on each period.
+            auto now = std::chrono::steady_clock::now();
+            reset_limit = period_ms <= (now - last_period_);
+            if (reset_limit)
+            {
+                last_period_ = now;
+            }
+
+            return reset_limit;
+        }
+
         if (lapse < period_ms)
         {
             if (std::cv_status::no_timeout == cv.wait_for(lock, period_ms - lapse))
@@ -358,18 +603,96 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
         if (DeliveryRetCode::EXCEEDED_LIMIT == ret_value)
         {
             force_wait_ = true;
+            // Wait only until the data which didn't fit can be sent.
+            pending_bytes_ = (std::min)(group.get_size_exceeding_limitation(), max_payload());
         }
     }
 
+    //! Maximum number of bytes a writer can send on a single datagram through this flow controller.
+    uint32_t max_payload() const
+    {
+        return static_cast<uint32_t>(0 < max_burst_bytes ? max_burst_bytes : max_bytes_per_period);
+    }
+
     int32_t max_bytes_per_period = 0;
 
     std::chrono::milliseconds period_ms;
 
+    //! Size of the token bucket. 0 when the bandwidth is limited per period.
+    int32_t max_burst_bytes = 0;
+
 private:
 
+    /*!
+     * Take bytes from the shared bandwidth, enough to send the pending data if possible.
+     */
+    void take_shared_bandwidth()
+    {
+        uint32_t wanted = (std::max)(shared_bandwidth_->chunk(), pending_bytes_ + 1);
+        sent_bytes_limitation_ = shared_bandwidth_->take(wanted);
+
+        // A limitation of 0 bytes would mean no limitation on the group.
+        group.reset_current_bytes_processed();
+        group.set_sent_bytes_limitation((std::max)(1u, sent_bytes_limitation_));
+        force_wait_ = false;
+    }
+
+    /*!
+     * Time until the token bucket has enough tokens to send a number of bytes.
+     */
+    std::chrono::steady_clock::duration time_to_get_tokens(
+            uint32_t bytes)
+    {
+        double available = tokens_ - static_cast<double>(group.get_current_bytes_processed());
+        double needed = static_cast<double>((std::min)(bytes + 1, static_cast<uint32_t>(max_burst_bytes))) - available;
+        if (0 >= needed)
+        {
+            return std::chrono::steady_clock::duration::zero();
+        }
+
+        std::chrono::duration<double, std::milli> time(needed * period_ms.count() / max_bytes_per_period);
+        // Round up, so the wake up is not before the tokens are available.
+        return std::chrono::duration_cast<std::chrono::steady_clock::duration>(time) +
+               std::chrono::steady_clock::duration(1);
+    }
+
+    /*!
+     * Add the tokens generated since the last refill, and take the ones consumed by the sent datagrams.
+     */
+    void refill_tokens()
+    {
+        auto now = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::milli> elapsed = now - last_refill_;
+        last_refill_ = now;
+
+        tokens_ -= static_cast<double>(group.get_current_bytes_processed());
+        tokens_ += elapsed.count() * max_bytes_per_period / period_ms.count();
+        tokens_ = (std::min)(tokens_, static_cast<double>(max_burst_bytes));
+
+        // A limitation of 0 bytes would mean no limitation on the group.
+        sent_bytes_limitation_ = (std::max)(1u, static_cast<uint32_t>((std::max)(tokens_, 0.0)));
+        group.reset_current_bytes_processed();
+        group.set_sent_bytes_limitation(sent_bytes_limitation_);
+        force_wait_ = false;
+    }
+
     bool force_wait_ = false;
 
     std::chrono::steady_clock::time_point last_period_ = std::chrono::steady_clock::now();
+
+    //! Bytes allowed to be sent until the next reset or refill.
+    uint32_t sent_bytes_limitation_ = 0;
+
+    //! Size of the data which didn't fit on the last attempt.
+    uint32_t pending_bytes_ = 0;
+
+    //! Tokens on the bucket on the last refill.
+    double tokens_ = 0;
+
+    std::chrono::steady_clock::time_point last_refill_ = std::chrono::steady_clock::now();
+
+    //! Bandwidth shared with other flow controllers. nullptr when this flow controller has its own bandwidth.
+    std::shared_ptr<FlowControllerSharedBandwidth> shared_bandwidth_;
 };
 
 
@@ -933,7 +1256,8 @@ public:
             RTPSParticipantImpl* participant,
             const FlowControllerDescriptor* descriptor,
             uint32_t async_index,
-            ThreadSettings thread_settings)
+            ThreadSettings thread_settings,
+            const std::shared_ptr<FlowControllerSharedBandwidth>& shared_bandwidth = nullptr)
         : participant_(participant)
         , async_mode(participant, descriptor)
         , participant_id_(0)
@@ -945,7 +1269,9 @@ public:
             participant_id_ = static_cast<uint32_t>(participant->getRTPSParticipantAttributes().participantID);
         }
 
-        uint32_t limitation = get_max_payload();
+        set_shared_bandwidth_impl(shared_bandwidth);
+
+        uint32_t limitation = get_bandwidth_limitation_impl();
 
         if ((std::numeric_limits<uint32_t>::max)() != limitation)
         {
@@ -1467,7 +1793,7 @@ private:
     typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
     get_max_payload_impl()
     {
-        return static_cast<uint32_t>(async_mode.max_bytes_per_period);
+        return async_mode.max_payload();
     }
 
     template<typename PubMode = PublishMode>
@@ -1477,6 +1803,38 @@ private:
         return (std::numeric_limits<uint32_t>::max)();
     }
 
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, void>::type
+    set_shared_bandwidth_impl(
+            const std::shared_ptr<FlowControllerSharedBandwidth>& shared_bandwidth)
+    {
+        async_mode.set_shared_bandwidth(shared_bandwidth);
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, void>::type
+    set_shared_bandwidth_impl(
+            const std::shared_ptr<FlowControllerSharedBandwidth>& shared_bandwidth)
+    {
+        // Only flow controllers limiting the bandwidth can share it.
+        assert(!shared_bandwidth);
+        static_cast<void>(shared_bandwidth);
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
+    get_bandwidth_limitation_impl()
+    {
+        return static_cast<uint32_t>(async_mode.max_bytes_per_period);
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
+    constexpr get_bandwidth_limitation_impl() const
+    {
+        return (std::numeric_limits<uint32_t>::max)();
+    }
+
     fastdds::TimedMutex mutex_;
 
     RTPSParticipantImpl* participant_ = nullptr;
@@ -0,0 +1,154 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _RTPS_FLOWCONTROL_SHARDEDFLOWCONTROLLER_HPP_
+#define _RTPS_FLOWCONTROL_SHARDEDFLOWCONTROLLER_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "FlowController.hpp"
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Flow controller which distributes the writers among several flow controllers (shards), each one with its own
+ * sender thread, queue and scheduler.
+ *
+ * A writer is always managed by the same shard, chosen from its GUID, so its samples keep being sent in order and the
+ * scheduling policy applies among the writers of each shard.
+ */
+class ShardedFlowController : public FlowController
+{
+public:
+
+    /*!
+     * Constructor.
+     *
+     * @param shards Flow controllers among which the writers are distributed. Cannot be empty.
+     */
+    explicit ShardedFlowController(
+            std::vector<std::unique_ptr<FlowController>>&& shards)
+        : shards_(std::move(shards))
+    {
+        assert(!shards_.empty());
+    }
+
+    virtual ~ShardedFlowController() noexcept
+    {
+    }
+
+    void init() override
+    {
+        for (auto& shard : shards_)
+        {
+            shard->init();
+        }
+    }
+
+    void register_writer(
+            RTPSWriter* writer) override
+    {
+        shard_for(writer->getGuid()).register_writer(writer);
+    }
+
+    void unregister_writer(
+            RTPSWriter* writer) override
+    {
+        shard_for(writer->getGuid()).unregister_writer(writer);
+    }
+
+    bool add_new_sample(
+            RTPSWriter* writer,
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        return shard_for(writer->getGuid()).add_new_sample(writer, change, max_blocking_time);
+    }
+
+    bool add_old_sample(
+            RTPSWriter* writer,
+            CacheChange_t* change) override
+    {
+        return shard_for(writer->getGuid()).add_old_sample(writer, change);
+    }
+
+    bool remove_change(
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        assert(nullptr != change);
+        return shard_for(change->writerGUID).remove_change(change, max_blocking_time);
+    }
+
+    uint32_t get_max_payload() override
+    {
+        // All the shards are created with the same configuration, and share the same bandwidth.
+        return shards_.front()->get_max_payload();
+    }
+
+    //! Number of shards
+    size_t size() const
+    {
+        return shards_.size();
+    }
+
+    /*!
+     * Get the index of the shard managing a writer.
+     *
+     * @param writer_guid GUID of the writer.
+     * @return Index of the shard.
+     */
+    size_t shard_index(
+            const GUID_t& writer_guid) const
+    {
+        // FNV-1a hash of the whole GUID but the entity key, which is added afterwards. Entity keys are assigned
+        // consecutively on a participant, so consecutive writers still go to different shards.
+        uint32_t hash = 2166136261u;
+        for (octet byte : writer_guid.guidPrefix.value)
+        {
+            hash = (hash ^ byte) * 16777619u;
+        }
+        const octet* value = writer_guid.entityId.value;
+        hash = (hash ^ value[3]) * 16777619u;
+        uint32_t key = (static_cast<uint32_t>(value[0]) << 16) | (static_cast<uint32_t>(value[1]) << 8) |
+                static_cast<uint32_t>(value[2]);
+        return static_cast<size_t>(hash + key) % shards_.size();
+    }
+
+private:
+
+    FlowController& shard_for(
+            const GUID_t& writer_guid)
+    {
+        return *shards_[shard_index(writer_guid)];
+    }
+
+    std::vector<std::unique_ptr<FlowController>> shards_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _RTPS_FLOWCONTROL_SHARDEDFLOWCONTROLLER_HPP_
@@ -283,7 +283,7 @@ namespace rtps {
 void History::print_changes_seqNum2()
 {
     std::stringstream ss;
-    for (std::vector<CacheChange_t*>::iterator it = m_changes.begin();
+    for (iterator it = m_changes.begin();
             it != m_changes.end(); ++it)
     {
         ss << (*it)->sequenceNumber << "-";
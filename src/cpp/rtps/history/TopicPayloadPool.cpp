@@ -24,12 +24,26 @@
 #include "./TopicPayloadPool_impl/Dynamic.hpp"
 #include "./TopicPayloadPool_impl/DynamicReusable.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <memory>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+/**
+ * Index identifying the calling thread, used to choose its stash of free payloads.
+ * Indexes are given consecutively, so threads only share a stash when there are more threads than stashes.
+ */
+static size_t thread_stash_index()
+{
+    static std::atomic<size_t> next_index{0};
+    static thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
 bool TopicPayloadPool::get_payload(
         uint32_t size,
         SerializedPayload_t& payload)
@@ -42,48 +56,61 @@ bool TopicPayloadPool::do_get_payload(
         SerializedPayload_t& payload,
         bool resizeable)
 {
-    PayloadNode* payload_node = nullptr;
+    octet* data = pop_from_stash();
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (free_payloads_.empty())
+    if (nullptr == data || (resizeable && size > PayloadNode::data_size(data)))
     {
-        payload_node = allocate(size); //Allocates a single payload
-        if (payload_node == nullptr)
+        PayloadNode* payload_node = nullptr;
+        std::array<octet*, stash_capacity_ / 2> refill;
+        size_t refill_count = 0;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (nullptr != data)
         {
-            lock.unlock();
-            payload.data = nullptr;
-            payload.max_size = 0;
-            payload.payload_owner = nullptr;
-            return false;
+            payload_node = all_payloads_.at(PayloadNode::data_index(data));
+        }
+        else
+        {
+            payload_node = get_free_payload_nts(size, refill, refill_count);
+            if (payload_node == nullptr)
+            {
+                lock.unlock();
+                payload.data = nullptr;
+                payload.max_size = 0;
+                payload.payload_owner = nullptr;
+                return false;
+            }
         }
-    }
-    else
-    {
-        payload_node = free_payloads_.back();
-        free_payloads_.pop_back();
-    }
 
-    // Resize if needed
-    if (resizeable && size > payload_node->data_size())
-    {
-        if (!payload_node->resize(size))
+        // Resize if needed
+        if (resizeable && size > payload_node->data_size())
         {
-            // Failed to resize, but we can still keep it for later.
-            free_payloads_.push_back(payload_node);
-            lock.unlock();
-            EPROSIMA_LOG_ERROR(RTPS_HISTORY, "Failed to resize the payload");
-
-            payload.data = nullptr;
-            payload.max_size = 0;
-            payload.payload_owner = nullptr;
-            return false;
+            if (!payload_node->resize(size))
+            {
+                // Failed to resize, but we can still keep it for later.
+                free_payloads_.push_back(payload_node);
+                lock.unlock();
+                EPROSIMA_LOG_ERROR(RTPS_HISTORY, "Failed to resize the payload");
+
+                payload.data = nullptr;
+                payload.max_size = 0;
+                payload.payload_owner = nullptr;
+                return false;
+            }
+        }
+
+        lock.unlock();
+        data = payload_node->data();
+
+        for (size_t i = 0; i < refill_count; ++i)
+        {
+            push_to_stash(refill[i]);
         }
     }
 
-    lock.unlock();
-    payload_node->reference();
-    payload.data = payload_node->data();
-    payload.max_size = payload_node->data_size();
+    PayloadNode::reference(data);
+    payload.data = data;
+    payload.max_size = PayloadNode::data_size(data);
     payload.payload_owner = this;
 
     return true;
@@ -127,9 +154,7 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(payload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload_node = all_payloads_.at(PayloadNode::data_index(payload.data));
-        free_payloads_.push_back(payload_node);
+        push_to_stash(payload.data);
     }
 
     payload.length = 0;
@@ -159,10 +184,96 @@ bool TopicPayloadPool::release_history(
 
     std::lock_guard<std::mutex> lock(mutex_);
     update_maximum_size(config, false);
+    drain_stashes_nts();
 
     return shrink(max_pool_size_);
 }
 
+octet* TopicPayloadPool::pop_from_stash()
+{
+    PayloadStash& stash = stashes_[thread_stash_index() % num_stashes_];
+    std::lock_guard<std::mutex> lock(stash.mutex);
+    if (0 == stash.count)
+    {
+        return nullptr;
+    }
+
+    return stash.payloads[--stash.count];
+}
+
+void TopicPayloadPool::push_to_stash(
+        octet* data)
+{
+    PayloadStash& stash = stashes_[thread_stash_index() % num_stashes_];
+    std::array<octet*, stash_capacity_ / 2> overflow;
+    size_t overflow_count = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(stash.mutex);
+        if (stash_capacity_ == stash.count)
+        {
+            // Keep the most recently used payloads, which are the ones at the end.
+            overflow_count = overflow.size();
+            std::copy(stash.payloads.begin(), stash.payloads.begin() + overflow_count, overflow.begin());
+            std::copy(stash.payloads.begin() + overflow_count, stash.payloads.end(), stash.payloads.begin());
+            stash.count -= overflow_count;
+        }
+        stash.payloads[stash.count++] = data;
+    }
+
+    if (0 < overflow_count)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < overflow_count; ++i)
+        {
+            free_payloads_.push_back(all_payloads_.at(PayloadNode::data_index(overflow[i])));
+        }
+    }
+}
+
+TopicPayloadPool::PayloadNode* TopicPayloadPool::get_free_payload_nts(
+        uint32_t size,
+        std::array<octet*, stash_capacity_ / 2>& refill,
+        size_t& refill_count)
+{
+    refill_count = 0;
+
+    if (free_payloads_.empty() && all_payloads_.size() >= max_pool_size_)
+    {
+        // No more payloads can be allocated, but other threads may have some free ones stashed.
+        drain_stashes_nts();
+    }
+
+    if (free_payloads_.empty())
+    {
+        return allocate(size); //Allocates a single payload
+    }
+
+    PayloadNode* payload_node = free_payloads_.back();
+    free_payloads_.pop_back();
+
+    while (!free_payloads_.empty() && refill_count < refill.size())
+    {
+        refill[refill_count++] = free_payloads_.back()->data();
+        free_payloads_.pop_back();
+    }
+
+    return payload_node;
+}
+
+void TopicPayloadPool::drain_stashes_nts()
+{
+    for (PayloadStash& stash : stashes_)
+    {
+        std::lock_guard<std::mutex> lock(stash.mutex);
+        for (size_t i = 0; i < stash.count; ++i)
+        {
+            free_payloads_.push_back(all_payloads_.at(PayloadNode::data_index(stash.payloads[i])));
+        }
+        stash.count = 0;
+    }
+}
+
 TopicPayloadPool::PayloadNode* TopicPayloadPool::allocate(
         uint32_t size)
 {
@@ -26,6 +26,7 @@
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <memory>
@@ -124,7 +125,13 @@ public:
 
     size_t payload_pool_available_size() const override
     {
-        return free_payloads_.size();
+        size_t available = free_payloads_.size();
+        for (PayloadStash& stash : stashes_)
+        {
+            std::lock_guard<std::mutex> lock(stash.mutex);
+            available += stash.count;
+        }
+        return available;
     }
 
     static std::unique_ptr<ITopicPayloadPool> get(
@@ -351,6 +358,13 @@ protected:
 
     virtual MemoryManagementPolicy_t memory_policy() const = 0;
 
+    /**
+     * Moves all the payloads kept on the stashes to the list of free payloads.
+     *
+     * @pre @c mutex_ is locked
+     */
+    void drain_stashes_nts();
+
     uint32_t max_pool_size_             = 0;  //< Maximum size of the pool
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
@@ -360,6 +374,60 @@ protected:
 
     std::mutex mutex_;
 
+private:
+
+    //! Number of stashes of free payloads. Each thread always uses the same stash.
+    static constexpr size_t num_stashes_ = 16;
+    //! Maximum number of free payloads kept on each stash.
+    static constexpr size_t stash_capacity_ = 32;
+
+    /**
+     * Bounded stash of free payloads, kept in front of the list of free payloads so threads getting and releasing
+     * payloads don't contend on @c mutex_.
+     * Every get and release still locks the mutex of a stash, which is shared by all the threads using it.
+     */
+    struct PayloadStash
+    {
+        std::mutex mutex;
+        size_t count = 0;
+        std::array<octet*, stash_capacity_> payloads; //< Data of the free payloads
+    };
+
+    /**
+     * Takes a free payload from the stash of the calling thread.
+     *
+     * @return Data of the payload, nullptr if the stash is empty.
+     */
+    octet* pop_from_stash();
+
+    /**
+     * Returns a free payload to the stash of the calling thread.
+     * When the stash is full, half of it is moved to the list of free payloads.
+     *
+     * @param [IN] data  Data of the payload.
+     */
+    void push_to_stash(
+            octet* data);
+
+    /**
+     * Takes a free payload from the list of free payloads, allocating a new one if there is none.
+     * Some other free payloads are moved to the stash of the calling thread for later calls.
+     *
+     * @param [IN]  size          Minimum size required for the payload data, in case it needs to be allocated
+     * @param [OUT] refill        Payloads to be moved to the stash of the calling thread
+     * @param [OUT] refill_count  Number of payloads on @c refill
+     *
+     * @return The node of the payload, nullptr if it could not be allocated.
+     *
+     * @pre @c mutex_ is locked
+     */
+    PayloadNode* get_free_payload_nts(
+            uint32_t size,
+            std::array<octet*, stash_capacity_ / 2>& refill,
+            size_t& refill_count);
+
+    mutable std::array<PayloadStash, num_stashes_> stashes_;
+
 };
 
 
@@ -0,0 +1,422 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AssociatedEndpoints.hpp
+ */
+
+#ifndef FASTDDS_RTPS_MESSAGES__ASSOCIATEDENDPOINTS_HPP
+#define FASTDDS_RTPS_MESSAGES__ASSOCIATEDENDPOINTS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/EntityId_t.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Immutable collection of endpoints indexed by their entity id.
+ *
+ * Entity ids are kept on an open-addressing hash table (linear probing), where each slot points to a range of a
+ * dense vector of endpoints. Endpoints with the same entity id are kept in the order they were added.
+ *
+ * @tparam Endpoint Type of the indexed endpoints.
+ */
+template<typename Endpoint>
+class EndpointSnapshot final
+{
+public:
+
+    using Entry = std::pair<EntityId_t, Endpoint*>;
+
+    EndpointSnapshot()
+        : EndpointSnapshot(std::vector<Entry>())
+    {
+    }
+
+    /**
+     * Build the index for a collection of endpoints.
+     *
+     * @param entries  Endpoints to index, with their entity id, in the order they were added.
+     */
+    explicit EndpointSnapshot(
+            std::vector<Entry>&& entries)
+        : entries_(std::move(entries))
+    {
+        // Keep the load factor at or below 1/2
+        size_t table_size = MIN_TABLE_SIZE;
+        uint32_t bits = MIN_TABLE_BITS;
+        while (table_size < entries_.size() * 2)
+        {
+            table_size <<= 1;
+            ++bits;
+        }
+        slots_.assign(table_size, Slot());
+        shift_ = 32u - bits;
+
+        for (const Entry& entry : entries_)
+        {
+            Slot& slot = probe(key_of(entry.first));
+            if (0 == slot.count)
+            {
+                ++entities_;
+            }
+            ++slot.count;
+        }
+
+        uint32_t first = 0;
+        for (Slot& slot : slots_)
+        {
+            slot.first = first;
+            first += slot.count;
+        }
+
+        std::vector<uint32_t> filled(slots_.size(), 0);
+        endpoints_.resize(entries_.size());
+        for (const Entry& entry : entries_)
+        {
+            const Slot* slot = find(entry.first);
+            size_t index = static_cast<size_t>(slot - slots_.data());
+            endpoints_[slot->first + filled[index]] = entry.second;
+            ++filled[index];
+        }
+    }
+
+    //! Whether the collection has no endpoints
+    bool empty() const noexcept
+    {
+        return endpoints_.empty();
+    }
+
+    //! Number of different entity ids on the collection
+    size_t size() const noexcept
+    {
+        return entities_;
+    }
+
+    //! Endpoints on the collection, with their entity id, in the order they were added
+    const std::vector<Entry>& entries() const noexcept
+    {
+        return entries_;
+    }
+
+    /**
+     * Find the first endpoint with a given entity id.
+     *
+     * @param entity_id  Entity id to look for. When @c c_EntityId_Unknown, any endpoint matches.
+     *
+     * @return The first matching endpoint, or nullptr if there is none.
+     */
+    Endpoint* find_first(
+            const EntityId_t& entity_id) const
+    {
+        if (c_EntityId_Unknown == entity_id)
+        {
+            return endpoints_.empty() ? nullptr : endpoints_.front();
+        }
+
+        const Slot* slot = find(entity_id);
+        return (nullptr == slot) ? nullptr : endpoints_[slot->first];
+    }
+
+    /**
+     * Call a functor for each endpoint with a given entity id.
+     *
+     * @param entity_id  Entity id to look for. When @c c_EntityId_Unknown, the functor is called for all the
+     *                   endpoints on the collection.
+     * @param callback   Functor to call, receiving an @c Endpoint* as argument.
+     */
+    template<typename Functor>
+    void for_each(
+            const EntityId_t& entity_id,
+            const Functor& callback) const
+    {
+        if (c_EntityId_Unknown == entity_id)
+        {
+            for (Endpoint* endpoint : endpoints_)
+            {
+                callback(endpoint);
+            }
+        }
+        else
+        {
+            const Slot* slot = find(entity_id);
+            if (nullptr != slot)
+            {
+                for (uint32_t i = slot->first, end = slot->first + slot->count; i < end; ++i)
+                {
+                    callback(endpoints_[i]);
+                }
+            }
+        }
+    }
+
+private:
+
+    static constexpr size_t MIN_TABLE_SIZE = 8;
+    static constexpr uint32_t MIN_TABLE_BITS = 3;
+
+    struct Slot
+    {
+        //! Entity id, as stored on memory
+        uint32_t key = 0;
+        //! Position of the first endpoint on endpoints_
+        uint32_t first = 0;
+        //! Number of endpoints. Empty slots have none.
+        uint32_t count = 0;
+    };
+
+    static uint32_t key_of(
+            const EntityId_t& entity_id)
+    {
+        uint32_t key;
+        memcpy(&key, entity_id.value, sizeof(key));
+        return key;
+    }
+
+    size_t index_of(
+            uint32_t key) const
+    {
+        // Fibonacci hashing, as entity ids differ both on the key bytes and the kind byte
+        return static_cast<size_t>((key * 2654435769u) >> shift_);
+    }
+
+    Slot& probe(
+            uint32_t key)
+    {
+        size_t mask = slots_.size() - 1;
+        size_t i = index_of(key);
+        while (0 != slots_[i].count && key != slots_[i].key)
+        {
+            i = (i + 1) & mask;
+        }
+        slots_[i].key = key;
+        return slots_[i];
+    }
+
+    const Slot* find(
+            const EntityId_t& entity_id) const
+    {
+        uint32_t key = key_of(entity_id);
+        size_t mask = slots_.size() - 1;
+        for (size_t i = index_of(key); 0 != slots_[i].count; i = (i + 1) & mask)
+        {
+            if (key == slots_[i].key)
+            {
+                return &slots_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<Slot> slots_;
+    uint32_t shift_ = 0;
+    size_t entities_ = 0;
+    std::vector<Endpoint*> endpoints_;
+    std::vector<Entry> entries_;
+};
+
+/**
+ * Read-mostly collection of endpoints indexed by their entity id.
+ *
+ * Lookups are done on an immutable EndpointSnapshot, and take no lock. Modifications build and publish a new
+ * snapshot, and then wait for a grace period (every lookup started before the publication has finished) before
+ * returning. This means that, once @c remove returns, no thread is using the removed endpoint anymore.
+ *
+ * Lookups should not modify the collection, as waiting for the grace period from inside a lookup would never end.
+ *
+ * @tparam Endpoint Type of the stored endpoints.
+ */
+template<typename Endpoint>
+class AssociatedEndpoints final
+{
+public:
+
+    using Snapshot = EndpointSnapshot<Endpoint>;
+
+    /**
+     * Read-side critical section. The snapshot it gives access to, and the endpoints on it, are kept alive while
+     * this object exists.
+     */
+    class ReadGuard final
+    {
+    public:
+
+        explicit ReadGuard(
+                const AssociatedEndpoints& endpoints)
+            : endpoints_(endpoints)
+        {
+            for (;;)
+            {
+                uint32_t epoch = endpoints_.epoch_.load();
+                phase_ = epoch & 1u;
+                endpoints_.active_readers_[phase_].fetch_add(1);
+                // Check the epoch has not changed, otherwise the writer may not be waiting for this phase
+                if (endpoints_.epoch_.load() == epoch)
+                {
+                    break;
+                }
+                endpoints_.active_readers_[phase_].fetch_sub(1);
+            }
+
+            snapshot_ = endpoints_.current_.load();
+        }
+
+        ~ReadGuard()
+        {
+            endpoints_.active_readers_[phase_].fetch_sub(1, std::memory_order_release);
+        }
+
+        ReadGuard(
+                const ReadGuard&) = delete;
+
+        ReadGuard& operator =(
+                const ReadGuard&) = delete;
+
+        const Snapshot& operator *() const noexcept
+        {
+            return *snapshot_;
+        }
+
+        const Snapshot* operator ->() const noexcept
+        {
+            return snapshot_;
+        }
+
+    private:
+
+        const AssociatedEndpoints& endpoints_;
+        const Snapshot* snapshot_ = nullptr;
+        uint32_t phase_ = 0;
+    };
+
+    AssociatedEndpoints()
+        : current_(new Snapshot())
+    {
+    }
+
+    ~AssociatedEndpoints()
+    {
+        delete current_.load();
+    }
+
+    AssociatedEndpoints(
+            const AssociatedEndpoints&) = delete;
+
+    AssociatedEndpoints& operator =(
+            const AssociatedEndpoints&) = delete;
+
+    /**
+     * Add an endpoint to the collection.
+     *
+     * @param entity_id  Entity id of the endpoint.
+     * @param endpoint   Endpoint to add.
+     *
+     * @return false if the endpoint was already on the collection.
+     */
+    bool add(
+            const EntityId_t& entity_id,
+            Endpoint* endpoint)
+    {
+        std::lock_guard<std::mutex> guard(update_mutex_);
+
+        std::vector<typename Snapshot::Entry> entries = current_.load(std::memory_order_relaxed)->entries();
+        for (const auto& entry : entries)
+        {
+            if (entry.second == endpoint)
+            {
+                return false;
+            }
+        }
+
+        entries.emplace_back(entity_id, endpoint);
+        publish(new Snapshot(std::move(entries)));
+        return true;
+    }
+
+    /**
+     * Remove an endpoint from the collection.
+     * When this method returns, no lookup is using the endpoint anymore.
+     *
+     * @param endpoint   Endpoint to remove.
+     *
+     * @return false if the endpoint was not on the collection.
+     */
+    bool remove(
+            Endpoint* endpoint)
+    {
+        std::lock_guard<std::mutex> guard(update_mutex_);
+
+        std::vector<typename Snapshot::Entry> entries = current_.load(std::memory_order_relaxed)->entries();
+        for (auto it = entries.begin(); it != entries.end(); ++it)
+        {
+            if (it->second == endpoint)
+            {
+                entries.erase(it);
+                publish(new Snapshot(std::move(entries)));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool empty() const
+    {
+        ReadGuard guard(*this);
+        return guard->empty();
+    }
+
+private:
+
+    void publish(
+            Snapshot* next)
+    {
+        Snapshot* previous = current_.exchange(next);
+
+        // Start a new phase and wait for the readers of the previous one, which may be using the previous snapshot
+        uint32_t epoch = epoch_.load(std::memory_order_relaxed);
+        epoch_.store(epoch + 1);
+        while (0 != active_readers_[epoch & 1u].load())
+        {
+            std::this_thread::yield();
+        }
+
+        delete previous;
+    }
+
+    //! Serializes modifications
+    std::mutex update_mutex_;
+    //! Snapshot used by new lookups
+    std::atomic<Snapshot*> current_;
+    //! Incremented on each publication
+    std::atomic<uint32_t> epoch_{0};
+    //! Number of lookups in progress, for each parity of the epoch
+    mutable std::atomic<uint32_t> active_readers_[2] = {{0}, {0}};
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif  // FASTDDS_RTPS_MESSAGES__ASSOCIATEDENDPOINTS_HPP
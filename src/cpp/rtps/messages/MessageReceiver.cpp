@@ -75,7 +75,8 @@ MessageReceiver::MessageReceiver(
             this,
             std::placeholders::_1,
             std::placeholders::_2,
-            std::placeholders::_3);
+            std::placeholders::_3,
+            std::placeholders::_4);
 
         process_data_fragment_message_function_ = std::bind(
             &MessageReceiver::process_data_fragment_message_with_security,
@@ -85,7 +86,8 @@ MessageReceiver::MessageReceiver(
             std::placeholders::_3,
             std::placeholders::_4,
             std::placeholders::_5,
-            std::placeholders::_6);
+            std::placeholders::_6,
+            std::placeholders::_7);
     }
     else
     {
@@ -95,7 +97,8 @@ MessageReceiver::MessageReceiver(
         this,
         std::placeholders::_1,
         std::placeholders::_2,
-        std::placeholders::_3);
+        std::placeholders::_3,
+        std::placeholders::_4);
 
     process_data_fragment_message_function_ = std::bind(
         &MessageReceiver::process_data_fragment_message_without_security,
@@ -105,7 +108,8 @@ MessageReceiver::MessageReceiver(
         std::placeholders::_3,
         std::placeholders::_4,
         std::placeholders::_5,
-        std::placeholders::_6);
+        std::placeholders::_6,
+        std::placeholders::_7);
 #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 }
 
@@ -121,6 +125,7 @@ MessageReceiver::~MessageReceiver()
 
  #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 void MessageReceiver::process_data_message_with_security(
+        const ReaderSnapshot& readers,
         const EntityId_t& reader_id,
         CacheChange_t& change,
         bool was_decoded)
@@ -166,10 +171,11 @@ void MessageReceiver::process_data_message_with_security(
                 std::swap(change.serializedPayload.length, crypto_payload_.length);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(readers, reader_id, process_message);
 }
 
 void MessageReceiver::process_data_fragment_message_with_security(
+        const ReaderSnapshot& readers,
         const EntityId_t& reader_id,
         CacheChange_t& change,
         uint32_t sample_size,
@@ -209,12 +215,13 @@ void MessageReceiver::process_data_fragment_message_with_security(
                 std::swap(change.serializedPayload.length, crypto_payload_.length);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(readers, reader_id, process_message);
 }
 
 #endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
 void MessageReceiver::process_data_message_without_security(
+        const ReaderSnapshot& readers,
         const EntityId_t& reader_id,
         CacheChange_t& change,
         bool /*was_decoded*/)
@@ -224,10 +231,11 @@ void MessageReceiver::process_data_message_without_security(
                 reader->process_data_msg(&change);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(readers, reader_id, process_message);
 }
 
 void MessageReceiver::process_data_fragment_message_without_security(
+        const ReaderSnapshot& readers,
         const EntityId_t& reader_id,
         CacheChange_t& change,
         uint32_t sample_size,
@@ -241,15 +249,15 @@ void MessageReceiver::process_data_fragment_message_without_security(
                 reader->process_data_frag_msg(&change, sample_size, fragment_starting_num, fragments_in_submessage);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(readers, reader_id, process_message);
 }
 
 void MessageReceiver::associateEndpoint(
         Endpoint* to_add)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
     if (to_add->getAttributes().endpointKind == WRITER)
     {
+        std::lock_guard<eprosima::shared_mutex> guard(mtx_);
         const auto writer = dynamic_cast<RTPSWriter*>(to_add);
         for (const auto& it : associated_writers_)
         {
@@ -264,37 +272,16 @@ void MessageReceiver::associateEndpoint(
     else
     {
         const auto reader = BaseReader::downcast(to_add);
-        const auto entityId = reader->getGuid().entityId;
-        // search for set of readers by entity ID
-        const auto readers = associated_readers_.find(entityId);
-        if (readers == associated_readers_.end())
-        {
-            auto vec = std::vector<BaseReader*>();
-            vec.push_back(reader);
-            associated_readers_.emplace(entityId, vec);
-        }
-        else
-        {
-            for (const auto& it : readers->second)
-            {
-                if (it == reader)
-                {
-                    return;
-                }
-            }
-
-            readers->second.push_back(reader);
-        }
+        associated_readers_.add(reader->getGuid().entityId, reader);
     }
 }
 
 void MessageReceiver::removeEndpoint(
         Endpoint* to_remove)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     if (to_remove->getAttributes().endpointKind == WRITER)
     {
+        std::lock_guard<eprosima::shared_mutex> guard(mtx_);
         auto* var = dynamic_cast<RTPSWriter*>(to_remove);
         for (auto it = associated_writers_.begin(); it != associated_writers_.end(); ++it)
         {
@@ -307,23 +294,8 @@ void MessageReceiver::removeEndpoint(
     }
     else
     {
-        auto readers = associated_readers_.find(to_remove->getGuid().entityId);
-        if (readers != associated_readers_.end())
-        {
-            auto* var = BaseReader::downcast(to_remove);
-            for (auto it = readers->second.begin(); it != readers->second.end(); ++it)
-            {
-                if (*it == var)
-                {
-                    readers->second.erase(it);
-                    if (readers->second.empty())
-                    {
-                        associated_readers_.erase(readers);
-                    }
-                    break;
-                }
-            }
-        }
+        // Waits until no submessage is being processed with a snapshot including the reader
+        associated_readers_.remove(BaseReader::downcast(to_remove));
     }
 }
 
@@ -672,35 +644,21 @@ bool MessageReceiver::readSubmessageHeader(
 }
 
 bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
+        const ReaderSnapshot& readers,
         const EntityId_t& readerID,
         BaseReader*& first_reader) const
 {
     first_reader = nullptr;
-    if (associated_readers_.empty())
+    if (readers.empty())
     {
         EPROSIMA_LOG_WARNING(RTPS_MSG_IN, IDSTRING "Data received when NO readers are listening");
         return false;
     }
 
-    if (readerID != c_EntityId_Unknown)
+    first_reader = readers.find_first(readerID);
+    if (nullptr != first_reader)
     {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
-        {
-            first_reader = readers->second.front();
-            return true;
-        }
-    }
-    else
-    {
-        for (const auto& readers : associated_readers_)
-        {
-            for (const auto& it : readers.second)
-            {
-                first_reader = it;
-                return true;
-            }
-        }
+        return true;
     }
 
     EPROSIMA_LOG_WARNING(RTPS_MSG_IN, IDSTRING "No Reader accepts this message (directed to: " << readerID << ")");
@@ -709,30 +667,11 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
 
 template<typename Functor>
 void MessageReceiver::findAllReaders(
+        const ReaderSnapshot& readers,
         const EntityId_t& readerID,
         const Functor& callback) const
 {
-    if (readerID != c_EntityId_Unknown)
-    {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
-        {
-            for (const auto& it : readers->second)
-            {
-                callback(it);
-            }
-        }
-    }
-    else
-    {
-        for (const auto& readers : associated_readers_)
-        {
-            for (const auto& it : readers.second)
-            {
-                callback(it);
-            }
-        }
-    }
+    readers.for_each(readerID, callback);
 }
 
 bool MessageReceiver::proc_Submsg_Data(
@@ -741,7 +680,7 @@ bool MessageReceiver::proc_Submsg_Data(
         EntityId_t& writerID,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    AssociatedReaders::ReadGuard readers(associated_readers_);
 
     //READ and PROCESS
     if (smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
@@ -783,7 +722,7 @@ bool MessageReceiver::proc_Submsg_Data(
     valid &= CDRMessage::readEntityId(msg, &readerID);
 
     //WE KNOW THE READER THAT THE MESSAGE IS DIRECTED TO SO WE LOOK FOR IT:
-    if (!willAReaderAcceptMsgDirectedTo(readerID, first_reader))
+    if (!willAReaderAcceptMsgDirectedTo(*readers, readerID, first_reader))
     {
         return false;
     }
@@ -906,10 +845,10 @@ bool MessageReceiver::proc_Submsg_Data(
     }
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible Reader entities: " <<
-            associated_readers_.size());
+            readers->size());
 
     //Look for the correct reader to add the change
-    process_data_message_function_(readerID, ch, was_decoded);
+    process_data_message_function_(*readers, readerID, ch, was_decoded);
 
     IPayloadPool* payload_pool = ch.serializedPayload.payload_owner;
     if (payload_pool)
@@ -930,7 +869,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
         SubmessageHeader_t* smh,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    AssociatedReaders::ReadGuard readers(associated_readers_);
 
     //READ and PROCESS
     if (smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
@@ -967,7 +906,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     valid &= CDRMessage::readEntityId(msg, &readerID);
 
     //WE KNOW THE READER THAT THE MESSAGE IS DIRECTED TO SO WE LOOK FOR IT:
-    if (!willAReaderAcceptMsgDirectedTo(readerID, first_reader))
+    if (!willAReaderAcceptMsgDirectedTo(*readers, readerID, first_reader))
     {
         return false;
     }
@@ -1093,9 +1032,9 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     }
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible Reader entities: " <<
-            associated_readers_.size());
-    process_data_fragment_message_function_(readerID, ch, sampleSize, fragmentStartingNum, fragmentsInSubmessage,
-            was_decoded);
+            readers->size());
+    process_data_fragment_message_function_(*readers, readerID, ch, sampleSize, fragmentStartingNum,
+            fragmentsInSubmessage, was_decoded);
     ch.serializedPayload.data = nullptr;
     ch.inline_qos.data = nullptr;
 
@@ -1109,7 +1048,7 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
         SubmessageHeader_t* smh,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    AssociatedReaders::ReadGuard readers(associated_readers_);
 
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     bool finalFlag = (smh->flags & BIT(1)) != 0;
@@ -1155,7 +1094,7 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
     }
 
     //Look for the correct reader and writers:
-    findAllReaders(readerGUID.entityId,
+    findAllReaders(*readers, readerGUID.entityId,
             [was_decoded, &writerGUID, &HBCount, &firstSN, &lastSN, finalFlag, livelinessFlag, this](
                 BaseReader* reader)
             {
@@ -1237,7 +1176,7 @@ bool MessageReceiver::proc_Submsg_Gap(
         SubmessageHeader_t* smh,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+    AssociatedReaders::ReadGuard readers(associated_readers_);
 
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //Assign message endianness
@@ -1264,7 +1203,7 @@ bool MessageReceiver::proc_Submsg_Gap(
         return false;
     }
 
-    findAllReaders(readerGUID.entityId,
+    findAllReaders(*readers, readerGUID.entityId,
             [was_decoded, &writerGUID, &gapStart, &gapList, this](BaseReader* reader)
             {
                 // Only used when HAVE_SECURITY is defined
@@ -21,7 +21,6 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <functional>
-#include <unordered_map>
 
 #include <fastdds/rtps/common/CDRMessage_t.h>
 #include <fastdds/rtps/common/Guid.h>
@@ -31,6 +30,7 @@
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 
+#include <rtps/messages/AssociatedEndpoints.hpp>
 #include <utils/shared_mutex.hpp>
 
 namespace eprosima {
@@ -59,6 +59,8 @@ class MessageReceiver
 {
 
     using BaseReader = fastdds::rtps::BaseReader;
+    using AssociatedReaders = AssociatedEndpoints<BaseReader>;
+    using ReaderSnapshot = AssociatedReaders::Snapshot;
 
 public:
 
@@ -91,9 +93,11 @@ public:
 
 private:
 
+    //! Protects the state of the message being processed and associated_writers_
     mutable eprosima::shared_mutex mtx_;
     std::vector<RTPSWriter*> associated_writers_;
-    std::unordered_map<EntityId_t, std::vector<BaseReader*>> associated_readers_;
+    //! Lookups of associated readers take no lock, and readers are kept alive until the lookup finishes
+    AssociatedReaders associated_readers_;
 
     RTPSParticipantImpl* participant_;
     //!Protocol version of the message
@@ -120,11 +124,13 @@ private:
 
     //! Function used to process a received message
     std::function<void(
+                const ReaderSnapshot&,
                 const EntityId_t&,
                 CacheChange_t&,
                 bool)> process_data_message_function_;
     //! Function used to process a received fragment message
     std::function<void(
+                const ReaderSnapshot&,
                 const EntityId_t&,
                 CacheChange_t&,
                 uint32_t,
@@ -153,19 +159,21 @@ private:
             SubmessageHeader_t* smh) const;
 
     /**
-     * Find if there is a reader (in associated_readers_) that will accept a msg directed
+     * Find if there is a reader (in a snapshot of associated_readers_) that will accept a msg directed
      * to the given entity ID.
      */
     bool willAReaderAcceptMsgDirectedTo(
+            const ReaderSnapshot& readers,
             const EntityId_t& readerID,
             BaseReader*& first_reader) const;
 
     /**
-     * Find all readers (in associated_readers_), with the given entity ID, and call the
+     * Find all readers (in a snapshot of associated_readers_), with the given entity ID, and call the
      * callback provided.
      */
     template<typename Functor>
     void findAllReaders(
+            const ReaderSnapshot& readers,
             const EntityId_t& readerID,
             const Functor& callback) const;
 
@@ -235,6 +243,7 @@ private:
     /**
      * @name Variants of received data message processing functions.
      *
+     * @param[in] readers      Snapshot of the associated readers
      * @param[in] reader_id    The ID of the reader to which the changes is addressed
      * @param[in] change       The CacheChange with the received data to process
      * @param[in] was_decoded  Whether the submessage being processed came from decoding a secured submessage
@@ -242,12 +251,14 @@ private:
     ///@{
  #if HAVE_SECURITY
     void process_data_message_with_security(
+            const ReaderSnapshot& readers,
             const EntityId_t& reader_id,
             CacheChange_t& change,
             bool was_decoded);
 #endif // HAVE_SECURITY
 
     void process_data_message_without_security(
+            const ReaderSnapshot& readers,
             const EntityId_t& reader_id,
             CacheChange_t& change,
             bool was_decoded);
@@ -256,6 +267,7 @@ private:
     /**
      * @name Variants of received data fragment message processing functions.
      *
+     * @param[in] readers   Snapshot of the associated readers
      * @param[in] reader_id The ID of the reader to which the changes is addressed
      * @param[in] change    The CacheChange with the received data to process
      *
@@ -268,6 +280,7 @@ private:
     ///@{
  #if HAVE_SECURITY
     void process_data_fragment_message_with_security(
+            const ReaderSnapshot& readers,
             const EntityId_t& reader_id,
             CacheChange_t& change,
             uint32_t sample_size,
@@ -277,6 +290,7 @@ private:
 #endif // HAVE_SECURITY
 
     void process_data_fragment_message_without_security(
+            const ReaderSnapshot& readers,
             const EntityId_t& reader_id,
             CacheChange_t& change,
             uint32_t sample_size,
@@ -563,6 +563,7 @@ bool RTPSMessageGroup::add_data(
     if (data_exceeds_limitation(data_size, sent_bytes_limitation_, current_sent_bytes_,
             buffers_bytes_))
     {
+        size_exceeding_limitation_ = data_size;
         flush_and_reset();
         throw limit_exceeded();
     }
@@ -682,6 +683,7 @@ bool RTPSMessageGroup::add_data_frag(
     if (data_exceeds_limitation(fragment_size, sent_bytes_limitation_, current_sent_bytes_,
             buffers_bytes_))
     {
+        size_exceeding_limitation_ = fragment_size;
         flush_and_reset();
         throw limit_exceeded();
     }
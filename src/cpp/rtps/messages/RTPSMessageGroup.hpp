@@ -248,6 +248,12 @@ public:
         return current_sent_bytes_ + buffers_bytes_;
     }
 
+    //! Size of the data which did not fit on the last operation throwing limit_exceeded.
+    inline uint32_t get_size_exceeding_limitation() const
+    {
+        return size_exceeding_limitation_;
+    }
+
 private:
 
     static constexpr uint32_t data_frag_header_size_ = 28;
@@ -354,6 +360,8 @@ private:
 
     uint32_t current_sent_bytes_ = 0;
 
+    uint32_t size_exceeding_limitation_ = 0;
+
     // Next buffer that will be sent
     eprosima::fastdds::rtps::NetworkBuffer pending_buffer_;
 
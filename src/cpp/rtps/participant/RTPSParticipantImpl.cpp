@@ -2511,10 +2511,10 @@ IPersistenceService* RTPSParticipantImpl::get_persistence_service(
 {
     IPersistenceService* ret_val;
 
-    ret_val = PersistenceFactory::create_persistence_service(param.properties);
+    ret_val = PersistenceFactory::create_persistence_service(param.properties, m_att.persistence_commit_thread);
     return ret_val != nullptr ?
            ret_val :
-           PersistenceFactory::create_persistence_service(m_att.properties);
+           PersistenceFactory::create_persistence_service(m_att.properties, m_att.persistence_commit_thread);
 }
 
 bool RTPSParticipantImpl::get_persistence_service(
@@ -0,0 +1,273 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AsyncPersistenceService.cpp
+ *
+ */
+
+#include <rtps/persistence/AsyncPersistenceService.h>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+AsyncPersistenceService::AsyncPersistenceService(
+        IPersistenceService* service,
+        std::chrono::milliseconds max_delay,
+        size_t max_pending,
+        const ThreadSettings& thread_settings)
+    : service_(service)
+    , max_delay_(max_delay)
+    , max_pending_(0 < max_pending ? max_pending : 1)
+{
+    pending_.reserve(max_pending_);
+    thread_ = create_thread([this]()
+                    {
+                        run();
+                    }, thread_settings, "dds.persist");
+}
+
+AsyncPersistenceService::~AsyncPersistenceService()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    pending_cv_.notify_one();
+
+    // The background thread stores the queued operations before finishing
+    thread_.join();
+}
+
+bool AsyncPersistenceService::load_writer_from_storage(
+        const std::string& persistence_guid,
+        const GUID_t& writer_guid,
+        WriterHistory* history,
+        const std::shared_ptr<IChangePool>& change_pool,
+        const std::shared_ptr<IPayloadPool>& payload_pool,
+        SequenceNumber_t& next_sequence)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wait_for_queued_operations(lock);
+    }
+
+    std::lock_guard<std::mutex> lock(service_mutex_);
+    return service_->load_writer_from_storage(persistence_guid, writer_guid, history, change_pool, payload_pool,
+                   next_sequence);
+}
+
+bool AsyncPersistenceService::add_writer_change_to_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    Operation operation;
+    operation.kind = Operation::ADD_WRITER_CHANGE;
+    operation.guid = persistence_guid;
+    operation.change.reset(new CacheChange_t(change.serializedPayload.length));
+    operation.change->copy(&change);
+    enqueue(std::move(operation));
+    return true;
+}
+
+bool AsyncPersistenceService::remove_writer_change_from_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    Operation operation;
+    operation.kind = Operation::REMOVE_WRITER_CHANGE;
+    operation.guid = persistence_guid;
+    operation.change.reset(new CacheChange_t());
+    operation.change->copy_not_memcpy(&change);
+    enqueue(std::move(operation));
+    return true;
+}
+
+bool AsyncPersistenceService::load_reader_from_storage(
+        const std::string& reader_guid,
+        foonathan::memory::map<GUID_t, SequenceNumber_t, map_allocator_t>& seq_map)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wait_for_queued_operations(lock);
+    }
+
+    std::lock_guard<std::mutex> lock(service_mutex_);
+    return service_->load_reader_from_storage(reader_guid, seq_map);
+}
+
+bool AsyncPersistenceService::update_writer_seq_on_storage(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
+    Operation operation;
+    operation.kind = Operation::UPDATE_WRITER_SEQ;
+    operation.guid = reader_guid;
+    operation.writer_guid = writer_guid;
+    operation.seq_number = seq_number;
+    enqueue(std::move(operation));
+    return true;
+}
+
+bool AsyncPersistenceService::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_for_queued_operations(lock);
+
+    bool ret = !failed_;
+    failed_ = false;
+    return ret;
+}
+
+void AsyncPersistenceService::wait_for_queued_operations(
+        std::unique_lock<std::mutex>& lock)
+{
+    uint64_t target = queued_count_;
+    if (stored_count_ < target)
+    {
+        ++flush_requests_;
+        pending_cv_.notify_one();
+        stored_cv_.wait(lock, [this, target]()
+                {
+                    return target <= stored_count_;
+                });
+        --flush_requests_;
+    }
+}
+
+void AsyncPersistenceService::enqueue(
+        Operation&& operation)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    stored_cv_.wait(lock, [this]()
+            {
+                return pending_.size() < max_pending_;
+            });
+
+    if (pending_.empty())
+    {
+        first_pending_time_ = std::chrono::steady_clock::now();
+        pending_cv_.notify_one();
+    }
+    pending_.push_back(std::move(operation));
+    ++queued_count_;
+
+    if (pending_.size() == max_pending_)
+    {
+        pending_cv_.notify_one();
+    }
+}
+
+void AsyncPersistenceService::run()
+{
+    std::vector<Operation> operations;
+    operations.reserve(max_pending_);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        pending_cv_.wait(lock, [this]()
+                {
+                    return !running_ || !pending_.empty();
+                });
+        if (pending_.empty())
+        {
+            break;
+        }
+
+        // Give time to other operations to be queued, so they are stored on the same transaction
+        pending_cv_.wait_until(lock, first_pending_time_ + max_delay_, [this]()
+                {
+                    return !running_ || 0 < flush_requests_ || max_pending_ <= pending_.size();
+                });
+
+        operations.swap(pending_);
+        lock.unlock();
+        // Let the operations waiting for room on the queue to continue
+        stored_cv_.notify_all();
+
+        bool success = store(operations);
+        size_t num_stored = operations.size();
+        operations.clear();
+
+        lock.lock();
+        stored_count_ += num_stored;
+        failed_ = failed_ || !success;
+        stored_cv_.notify_all();
+    }
+}
+
+bool AsyncPersistenceService::store(
+        std::vector<Operation>& operations)
+{
+    std::lock_guard<std::mutex> lock(service_mutex_);
+
+    // When the transaction cannot be started, the operations are stored one by one
+    bool in_transaction = service_->begin_transaction();
+    bool success = true;
+
+    for (Operation& operation : operations)
+    {
+        switch (operation.kind)
+        {
+            case Operation::ADD_WRITER_CHANGE:
+                if (!service_->add_writer_change_to_storage(operation.guid, *operation.change))
+                {
+                    EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Writer " << operation.change->writerGUID
+                                                                     << " could not store change for seq "
+                                                                     << operation.change->sequenceNumber);
+                    success = false;
+                }
+                break;
+
+            case Operation::REMOVE_WRITER_CHANGE:
+                if (!service_->remove_writer_change_from_storage(operation.guid, *operation.change))
+                {
+                    EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Writer " << operation.change->writerGUID
+                                                                     << " could not remove change for seq "
+                                                                     << operation.change->sequenceNumber);
+                    success = false;
+                }
+                break;
+
+            case Operation::UPDATE_WRITER_SEQ:
+                if (!service_->update_writer_seq_on_storage(operation.guid, operation.writer_guid,
+                        operation.seq_number))
+                {
+                    EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Reader " << operation.guid
+                                                                     << " could not store seq for writer "
+                                                                     << operation.writer_guid);
+                    success = false;
+                }
+                break;
+        }
+    }
+
+    if (in_transaction && !service_->commit_transaction())
+    {
+        success = false;
+    }
+
+    return success;
+}
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,176 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AsyncPersistenceService.h
+ */
+
+#ifndef ASYNCPERSISTENCESERVICE_H_
+#define ASYNCPERSISTENCESERVICE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+#include <rtps/persistence/PersistenceService.h>
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Persistence service which stores the changes of another persistence service from a background thread.
+ *
+ * The operations modifying the storage are queued and return immediately. The background thread stores all the
+ * queued operations in a single transaction of the underlying service, waiting up to a maximum delay since the
+ * first queued operation to group more of them.
+ * Loading operations, and the flush method, wait for the queued operations to be stored.
+ *
+ * As the modifying operations return before being stored, their errors are reported by the next call to flush.
+ * Each queued change keeps a copy of its payload, so up to max_pending payloads may be held in memory.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+class AsyncPersistenceService : public IPersistenceService
+{
+public:
+
+    /**
+     * Construct an asynchronous persistence service.
+     * @param service            Persistence service where the changes are stored. Ownership is taken.
+     * @param max_delay          Maximum time an operation waits in the queue before being stored.
+     * @param max_pending        Maximum number of queued operations. Queuing more operations blocks until
+     *                           some of them are stored.
+     * @param thread_settings    Settings of the thread storing the operations.
+     */
+    AsyncPersistenceService(
+            IPersistenceService* service,
+            std::chrono::milliseconds max_delay,
+            size_t max_pending,
+            const ThreadSettings& thread_settings);
+
+    virtual ~AsyncPersistenceService() override;
+
+    bool load_writer_from_storage(
+            const std::string& persistence_guid,
+            const GUID_t& writer_guid,
+            WriterHistory* history,
+            const std::shared_ptr<IChangePool>& change_pool,
+            const std::shared_ptr<IPayloadPool>& payload_pool,
+            SequenceNumber_t& next_sequence) final;
+
+    bool add_writer_change_to_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool remove_writer_change_from_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool load_reader_from_storage(
+            const std::string& reader_guid,
+            foonathan::memory::map<GUID_t, SequenceNumber_t, map_allocator_t>& seq_map) final;
+
+    bool update_writer_seq_on_storage(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number) final;
+
+    /**
+     * Wait until all the operations previously queued are stored.
+     * @return True if all the operations queued since the previous call were successfully stored.
+     */
+    bool flush() final;
+
+private:
+
+    struct Operation
+    {
+        enum Kind
+        {
+            ADD_WRITER_CHANGE,
+            REMOVE_WRITER_CHANGE,
+            UPDATE_WRITER_SEQ
+        };
+
+        Kind kind;
+
+        //! Persistence GUID of the writer, or GUID of the reader
+        std::string guid;
+
+        //! Copy of the change to add or remove
+        std::unique_ptr<CacheChange_t> change;
+
+        GUID_t writer_guid;
+
+        SequenceNumber_t seq_number;
+    };
+
+    void enqueue(
+            Operation&& operation);
+
+    //! Wait until the operations queued before this call are stored. @pre mutex_ is locked by lock
+    void wait_for_queued_operations(
+            std::unique_lock<std::mutex>& lock);
+
+    void run();
+
+    bool store(
+            std::vector<Operation>& operations);
+
+    std::unique_ptr<IPersistenceService> service_;
+
+    //! Serializes the accesses to service_
+    std::mutex service_mutex_;
+
+    std::chrono::milliseconds max_delay_;
+
+    size_t max_pending_;
+
+    std::mutex mutex_;
+
+    //! Notifies the background thread
+    std::condition_variable pending_cv_;
+
+    //! Notifies the threads waiting for operations to be stored
+    std::condition_variable stored_cv_;
+
+    std::vector<Operation> pending_;
+
+    std::chrono::steady_clock::time_point first_pending_time_;
+
+    uint64_t queued_count_ = 0;
+
+    uint64_t stored_count_ = 0;
+
+    uint32_t flush_requests_ = 0;
+
+    bool failed_ = false;
+
+    bool running_ = true;
+
+    eprosima::thread thread_;
+};
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* ASYNCPERSISTENCESERVICE_H_ */
@@ -0,0 +1,1022 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogPersistenceService.cpp
+ *
+ */
+
+#include <rtps/persistence/LogPersistenceService.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <limits>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <boostconfig.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/history/WriterHistory.h>
+
+#include <utils/SystemInfo.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+//! Identifies the segment files, and the version of their format
+static const char s_segment_magic[8] = {'F', 'D', 'D', 'S', 'L', 'O', 'G', '1'};
+
+static const size_t s_record_alignment = 8;
+
+struct SegmentHeader
+{
+    char magic[8];
+    uint64_t index;
+};
+
+enum RecordKind : uint32_t
+{
+    //! A change added to the history of a writer
+    WRITER_CHANGE_ADDED = 1,
+    //! A change removed from the history of a writer
+    WRITER_CHANGE_REMOVED = 2,
+    //! The last sequence number of a writer, kept when its changes are compacted
+    WRITER_LAST_SEQUENCE = 3,
+    //! The sequence number of a writer stored by a reader
+    READER_WRITER_SEQUENCE = 4
+};
+
+struct RecordHeader
+{
+    //! Size of the record, including this header and the padding. Zero after the last record of a segment.
+    uint32_t size;
+    uint32_t kind;
+    //! Checksum of the rest of the record, to detect the records partially written
+    uint64_t checksum;
+};
+
+//! Body of a WRITER_CHANGE_ADDED record, followed by the payload
+struct ChangeAddedRecord
+{
+    int64_t sequence_number;
+    octet instance_handle[16];
+    octet related_writer_guid[16];
+    int64_t related_sequence_number;
+    int64_t source_timestamp;
+    uint32_t payload_length;
+    uint32_t reserved;
+};
+
+//! Body of the WRITER_CHANGE_REMOVED and WRITER_LAST_SEQUENCE records
+struct SequenceRecord
+{
+    int64_t sequence_number;
+};
+
+//! Body of a READER_WRITER_SEQUENCE record
+struct ReaderWriterSequenceRecord
+{
+    octet writer_guid[16];
+    int64_t sequence_number;
+};
+
+static size_t aligned_size(
+        size_t size)
+{
+    return (size + s_record_alignment - 1) & ~(s_record_alignment - 1);
+}
+
+static uint64_t record_checksum(
+        const octet* data,
+        size_t size)
+{
+    constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+    uint64_t ret = size * multiplier;
+    uint64_t word;
+
+    // Records are padded to a multiple of 8 bytes
+    for (; size >= sizeof(word); data += sizeof(word), size -= sizeof(word))
+    {
+        memcpy(&word, data, sizeof(word));
+        ret = (ret ^ word) * multiplier;
+        ret ^= ret >> 32;
+    }
+
+    return ret;
+}
+
+static void guid_to_bytes(
+        const GUID_t& guid,
+        octet* bytes)
+{
+    memcpy(bytes, guid.guidPrefix.value, GuidPrefix_t::size);
+    memcpy(bytes + GuidPrefix_t::size, guid.entityId.value, EntityId_t::size);
+}
+
+static GUID_t guid_from_bytes(
+        const octet* bytes)
+{
+    GUID_t guid;
+    memcpy(guid.guidPrefix.value, bytes, GuidPrefix_t::size);
+    memcpy(guid.entityId.value, bytes + GuidPrefix_t::size, EntityId_t::size);
+    return guid;
+}
+
+//! Characters of a persistence GUID which can be used on a file name
+static std::string file_name_part(
+        const std::string& guid)
+{
+    std::string ret(guid);
+    for (char& c : ret)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)))
+        {
+            c = '_';
+        }
+    }
+    return ret;
+}
+
+//! Write to disk the contents of a file
+static bool sync_file(
+        const std::string& filename)
+{
+#if defined(_WIN32)
+    HANDLE handle = CreateFileA(filename.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (INVALID_HANDLE_VALUE == handle)
+    {
+        return false;
+    }
+    bool ret = FALSE != FlushFileBuffers(handle);
+    CloseHandle(handle);
+    return ret;
+#else
+    int fd = open(filename.c_str(), O_RDWR);
+    if (fd < 0)
+    {
+        return false;
+    }
+    bool ret = 0 == fsync(fd);
+    close(fd);
+    return ret;
+#endif // if defined(_WIN32)
+}
+
+//! Write to disk the entries of the directory containing a file, so its creation or renaming is not lost
+static bool sync_directory(
+        const std::string& filename)
+{
+#if defined(_WIN32)
+    // Directories cannot be synchronized, the files are renamed with MOVEFILE_WRITE_THROUGH instead
+    static_cast<void>(filename);
+    return true;
+#else
+    size_t separator = filename.find_last_of('/');
+    std::string directory = std::string::npos == separator ? "." : filename.substr(0, std::max<size_t>(separator, 1));
+    int fd = open(directory.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    bool ret = 0 == fsync(fd);
+    close(fd);
+    return ret;
+#endif // if defined(_WIN32)
+}
+
+//! Replace a file with another one, so there is always one of them with the complete contents
+static bool replace_file(
+        const std::string& source,
+        const std::string& destination)
+{
+#if defined(_WIN32)
+    return FALSE != MoveFileExA(source.c_str(), destination.c_str(),
+                   MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+    return 0 == std::rename(source.c_str(), destination.c_str());
+#endif // if defined(_WIN32)
+}
+
+struct LogPersistenceService::Segment
+{
+    /**
+     * Map a segment file.
+     * @param segment_index Number of the segment on its log.
+     * @param name          Name of the file.
+     * @param create_size   Size of the file to create, or zero to open an existing file.
+     * @return True if operation was successful.
+     */
+    bool open(
+            uint64_t segment_index,
+            const std::string& name,
+            size_t create_size)
+    {
+        index = segment_index;
+        filename = name;
+
+        try
+        {
+            if (0 < create_size)
+            {
+                // The file is created with its final size, filled with zeros
+                std::filebuf file;
+                if (nullptr == file.open(filename.c_str(),
+                        std::ios_base::in | std::ios_base::out | std::ios_base::trunc | std::ios_base::binary))
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Unable to create log segment " << filename);
+                    return false;
+                }
+                file.pubseekoff(static_cast<std::streamoff>(create_size - 1), std::ios_base::beg);
+                file.sputc(0);
+            }
+
+            boost::interprocess::file_mapping mapping(filename.c_str(), boost::interprocess::read_write);
+            boost::interprocess::mapped_region mapped_region(mapping, boost::interprocess::read_write);
+            region.swap(mapped_region);
+        }
+        catch (const boost::interprocess::interprocess_exception& e)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Unable to map log segment " << filename << ": " << e.what());
+            return false;
+        }
+
+        data = static_cast<octet*>(region.get_address());
+        size = region.get_size();
+        end = sizeof(SegmentHeader);
+        synced = end;
+
+        SegmentHeader header;
+        if (0 < create_size)
+        {
+            memcpy(header.magic, s_segment_magic, sizeof(header.magic));
+            header.index = index;
+            memcpy(data, &header, sizeof(header));
+        }
+        else
+        {
+            if (size < sizeof(header))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Invalid log segment " << filename);
+                return false;
+            }
+            memcpy(&header, data, sizeof(header));
+            if (0 != memcmp(header.magic, s_segment_magic, sizeof(header.magic)) || header.index != index)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Invalid log segment " << filename);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    uint64_t index = 0;
+
+    std::string filename;
+
+    boost::interprocess::mapped_region region;
+
+    octet* data = nullptr;
+
+    size_t size = 0;
+
+    //! Offset after the last record
+    size_t end = 0;
+
+    //! Offset up to which the records have been written to disk
+    size_t synced = 0;
+
+    //! Size of the records which are still needed
+    size_t live_bytes = 0;
+};
+
+struct LogPersistenceService::Log
+{
+    std::string segment_name(
+            uint64_t index) const
+    {
+        return base_name + "_" + std::to_string(index) + ".log";
+    }
+
+    //! Name of the file keeping the number of the first segment
+    std::string head_name() const
+    {
+        return base_name + ".head";
+    }
+
+    std::string base_name;
+
+    std::deque<std::unique_ptr<Segment>> segments;
+
+    //! Number of the next segment to create
+    uint64_t next_index = 0;
+
+    //! Records of the changes on the history of a writer, by sequence number
+    std::map<int64_t, RecordLocation> changes;
+
+    //! Records of the last sequence number of each writer stored by a reader
+    std::map<GUID_t, RecordLocation> writer_sequences;
+
+    int64_t last_sequence = 0;
+
+    bool has_last_sequence = false;
+
+    bool compacting = false;
+};
+
+IPersistenceService* create_log_persistence_service(
+        const char* filename,
+        size_t segment_size)
+{
+    return new LogPersistenceService(filename, segment_size);
+}
+
+LogPersistenceService::LogPersistenceService(
+        const char* filename,
+        size_t segment_size)
+    : filename_(filename)
+    , segment_size_(std::max(segment_size, aligned_size(sizeof(SegmentHeader) + sizeof(RecordHeader))))
+{
+}
+
+LogPersistenceService::~LogPersistenceService()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& log : logs_)
+    {
+        sync(*log.second);
+    }
+}
+
+bool LogPersistenceService::load_writer_from_storage(
+        const std::string& persistence_guid,
+        const GUID_t& writer_guid,
+        WriterHistory* history,
+        const std::shared_ptr<IChangePool>& change_pool,
+        const std::shared_ptr<IPayloadPool>& payload_pool,
+        SequenceNumber_t& next_sequence)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Log* log = get_log(persistence_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    WriterHistory::ChangeCollection& changes = get_changes(history);
+
+    for (const auto& entry : log->changes)
+    {
+        const octet* body = entry.second.segment->data + entry.second.offset + sizeof(RecordHeader);
+        ChangeAddedRecord record;
+        memcpy(&record, body, sizeof(record));
+
+        CacheChange_t* change = nullptr;
+        if (!change_pool->reserve_cache(change))
+        {
+            continue;
+        }
+
+        if (!payload_pool->get_payload(record.payload_length, change->serializedPayload))
+        {
+            change_pool->release_cache(change);
+            continue;
+        }
+
+        change->kind = ALIVE;
+        change->writerGUID = writer_guid;
+        memcpy(change->instanceHandle.value, record.instance_handle, sizeof(record.instance_handle));
+        change->sequenceNumber = SequenceNumber_t(static_cast<uint64_t>(record.sequence_number));
+        change->serializedPayload.length = record.payload_length;
+        if (0 < record.payload_length)
+        {
+            memcpy(change->serializedPayload.data, body + sizeof(record), record.payload_length);
+        }
+        change->writer_info.previous = nullptr;
+        change->writer_info.next = nullptr;
+        change->writer_info.num_sent_submessages = 0;
+        change->vendor_id = c_VendorId_eProsima;
+
+        auto& si = change->write_params.related_sample_identity();
+        si.writer_guid(guid_from_bytes(record.related_writer_guid));
+        si.sequence_number(SequenceNumber_t(static_cast<uint64_t>(record.related_sequence_number)));
+
+        change->sourceTimestamp.from_ns(record.source_timestamp);
+
+        set_fragments(history, change);
+
+        changes.push_back(change);
+    }
+
+    if (log->has_last_sequence)
+    {
+        next_sequence = SequenceNumber_t(static_cast<uint64_t>(log->last_sequence));
+    }
+
+    return true;
+}
+
+bool LogPersistenceService::add_writer_change_to_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Log* log = get_log(persistence_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    int64_t sequence_number = change.sequenceNumber.to64long();
+    if (log->changes.find(sequence_number) != log->changes.end())
+    {
+        return false;
+    }
+
+    ChangeAddedRecord record;
+    record.sequence_number = sequence_number;
+    memcpy(record.instance_handle, change.instanceHandle.value, sizeof(record.instance_handle));
+    const SampleIdentity& si = change.write_params.related_sample_identity();
+    guid_to_bytes(si.writer_guid(), record.related_writer_guid);
+    record.related_sequence_number = si.sequence_number().to64long();
+    record.source_timestamp = change.sourceTimestamp.to_ns();
+    record.payload_length = change.serializedPayload.length;
+    record.reserved = 0;
+
+    RecordLocation location = append_record(*log, WRITER_CHANGE_ADDED, &record, sizeof(record),
+                    change.serializedPayload.data, change.serializedPayload.length);
+    if (nullptr == location.segment)
+    {
+        return false;
+    }
+
+    location.segment->live_bytes += record_size(location);
+    log->changes[sequence_number] = location;
+    log->last_sequence = std::max(log->last_sequence, sequence_number);
+    log->has_last_sequence = true;
+    return true;
+}
+
+bool LogPersistenceService::remove_writer_change_from_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Log* log = get_log(persistence_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    auto it = log->changes.find(change.sequenceNumber.to64long());
+    if (it == log->changes.end())
+    {
+        return true;
+    }
+
+    SequenceRecord record;
+    record.sequence_number = it->first;
+    if (nullptr == append_record(*log, WRITER_CHANGE_REMOVED, &record, sizeof(record)).segment)
+    {
+        return false;
+    }
+
+    // The record may have been moved by a compaction
+    it = log->changes.find(record.sequence_number);
+    it->second.segment->live_bytes -= record_size(it->second);
+    log->changes.erase(it);
+    return true;
+}
+
+bool LogPersistenceService::load_reader_from_storage(
+        const std::string& reader_guid,
+        foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t>& seq_map)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Log* log = get_log(reader_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    for (const auto& entry : log->writer_sequences)
+    {
+        ReaderWriterSequenceRecord record;
+        memcpy(&record, entry.second.segment->data + entry.second.offset + sizeof(RecordHeader), sizeof(record));
+        seq_map[entry.first] = SequenceNumber_t(static_cast<uint64_t>(record.sequence_number));
+    }
+
+    return true;
+}
+
+bool LogPersistenceService::update_writer_seq_on_storage(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Log* log = get_log(reader_guid);
+    if (nullptr == log)
+    {
+        return false;
+    }
+
+    ReaderWriterSequenceRecord record;
+    guid_to_bytes(writer_guid, record.writer_guid);
+    record.sequence_number = seq_number.to64long();
+
+    RecordLocation location = append_record(*log, READER_WRITER_SEQUENCE, &record, sizeof(record));
+    if (nullptr == location.segment)
+    {
+        return false;
+    }
+
+    location.segment->live_bytes += record_size(location);
+    auto it = log->writer_sequences.find(writer_guid);
+    if (it != log->writer_sequences.end())
+    {
+        it->second.segment->live_bytes -= record_size(it->second);
+        it->second = location;
+    }
+    else
+    {
+        log->writer_sequences[writer_guid] = location;
+    }
+    return true;
+}
+
+bool LogPersistenceService::commit_transaction()
+{
+    return flush();
+}
+
+bool LogPersistenceService::flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool ret = true;
+    for (auto& log : logs_)
+    {
+        ret = sync(*log.second) && ret;
+    }
+    return ret;
+}
+
+LogPersistenceService::Log* LogPersistenceService::get_log(
+        const std::string& guid)
+{
+    auto it = logs_.find(guid);
+    if (it != logs_.end())
+    {
+        return it->second.get();
+    }
+
+    std::unique_ptr<Log> log(new Log());
+    log->base_name = filename_ + "_" + file_name_part(guid);
+    if (!recover(*log))
+    {
+        return nullptr;
+    }
+
+    Log* ret = log.get();
+    logs_[guid] = std::move(log);
+    return ret;
+}
+
+bool LogPersistenceService::recover(
+        Log& log)
+{
+    // The previous segments are removed by the compaction, so the number of the first one is kept on the head file.
+    // When the first compaction of a log is interrupted before renaming its head file, it is kept as a temporary
+    // file, which is only written after the records it needs.
+    uint64_t first_index = 0;
+    for (const std::string& name : {log.head_name(), log.head_name() + ".tmp"})
+    {
+        std::ifstream head(name);
+        if (head >> first_index)
+        {
+            break;
+        }
+        first_index = 0;
+    }
+
+    // Remove the segments left by a compaction interrupted after updating the head file
+    for (uint64_t index = first_index; 0 < index && SystemInfo::file_exists(log.segment_name(index - 1)); --index)
+    {
+        boost::interprocess::file_mapping::remove(log.segment_name(index - 1).c_str());
+    }
+
+    log.next_index = first_index;
+    while (SystemInfo::file_exists(log.segment_name(log.next_index)))
+    {
+        std::unique_ptr<Segment> segment(new Segment());
+        if (!segment->open(log.next_index, log.segment_name(log.next_index), 0))
+        {
+            return false;
+        }
+        ++log.next_index;
+
+        // Only the headers of the records are read
+        size_t offset = segment->end;
+        while (sizeof(RecordHeader) <= segment->size - offset)
+        {
+            RecordHeader header;
+            memcpy(&header, segment->data + offset, sizeof(header));
+            if (0 == header.size)
+            {
+                break;
+            }
+
+            if (header.size < sizeof(RecordHeader) || 0 != header.size % s_record_alignment ||
+                    segment->size - offset < header.size ||
+                    header.checksum !=
+                    record_checksum(segment->data + offset + sizeof(RecordHeader), header.size - sizeof(RecordHeader)))
+            {
+                // A record partially written. The rest of the segment is cleared so the records appended after the
+                // valid ones are not mixed with the remains of this one.
+                EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Discarding incomplete records of log segment "
+                        << segment->filename);
+                memset(segment->data + offset, 0, segment->size - offset);
+                break;
+            }
+
+            apply_record(log, *segment, offset);
+            offset += header.size;
+        }
+        segment->end = offset;
+        segment->synced = offset;
+
+        log.segments.push_back(std::move(segment));
+    }
+
+    return !log.segments.empty() || add_segment(log, 0);
+}
+
+void LogPersistenceService::apply_record(
+        Log& log,
+        Segment& segment,
+        size_t offset)
+{
+    RecordHeader header;
+    memcpy(&header, segment.data + offset, sizeof(header));
+    const octet* body = segment.data + offset + sizeof(RecordHeader);
+    size_t body_size = header.size - sizeof(RecordHeader);
+
+    RecordLocation location;
+    location.segment = &segment;
+    location.offset = offset;
+
+    switch (header.kind)
+    {
+        case WRITER_CHANGE_ADDED:
+        {
+            ChangeAddedRecord record;
+            if (sizeof(record) > body_size)
+            {
+                break;
+            }
+            memcpy(&record, body, sizeof(record));
+            if (record.payload_length > body_size - sizeof(record))
+            {
+                break;
+            }
+
+            // A compaction may have appended again a change found on a previous segment
+            RecordLocation& entry = log.changes[record.sequence_number];
+            if (nullptr != entry.segment)
+            {
+                entry.segment->live_bytes -= record_size(entry);
+            }
+            entry = location;
+            segment.live_bytes += header.size;
+            log.last_sequence = std::max(log.last_sequence, record.sequence_number);
+            log.has_last_sequence = true;
+            break;
+        }
+
+        case WRITER_CHANGE_REMOVED:
+        {
+            SequenceRecord record;
+            if (sizeof(record) > body_size)
+            {
+                break;
+            }
+            memcpy(&record, body, sizeof(record));
+
+            auto it = log.changes.find(record.sequence_number);
+            if (it != log.changes.end())
+            {
+                it->second.segment->live_bytes -= record_size(it->second);
+                log.changes.erase(it);
+            }
+            break;
+        }
+
+        case WRITER_LAST_SEQUENCE:
+        {
+            SequenceRecord record;
+            if (sizeof(record) > body_size)
+            {
+                break;
+            }
+            memcpy(&record, body, sizeof(record));
+            log.last_sequence = std::max(log.last_sequence, record.sequence_number);
+            log.has_last_sequence = true;
+            break;
+        }
+
+        case READER_WRITER_SEQUENCE:
+        {
+            ReaderWriterSequenceRecord record;
+            if (sizeof(record) > body_size)
+            {
+                break;
+            }
+            memcpy(&record, body, sizeof(record));
+
+            RecordLocation& entry = log.writer_sequences[guid_from_bytes(record.writer_guid)];
+            if (nullptr != entry.segment)
+            {
+                entry.segment->live_bytes -= record_size(entry);
+            }
+            entry = location;
+            segment.live_bytes += header.size;
+            break;
+        }
+
+        default:
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Unknown record kind " << header.kind << " on log segment "
+                                                                          << segment.filename);
+            break;
+    }
+}
+
+size_t LogPersistenceService::record_size(
+        const RecordLocation& location)
+{
+    RecordHeader header;
+    memcpy(&header, location.segment->data + location.offset, sizeof(header));
+    return header.size;
+}
+
+octet* LogPersistenceService::reserve_record(
+        Log& log,
+        size_t size,
+        RecordLocation& location)
+{
+    // Adding a segment may compact the log, using part of the new segment
+    while (log.segments.back()->size - log.segments.back()->end < size)
+    {
+        if (!add_segment(log, size))
+        {
+            return nullptr;
+        }
+    }
+
+    Segment* segment = log.segments.back().get();
+    location.segment = segment;
+    location.offset = segment->end;
+    segment->end += size;
+    return segment->data + location.offset;
+}
+
+LogPersistenceService::RecordLocation LogPersistenceService::append_record(
+        Log& log,
+        uint32_t kind,
+        const void* body,
+        size_t body_size,
+        const octet* payload,
+        size_t payload_size)
+{
+    RecordLocation location;
+    size_t size = aligned_size(sizeof(RecordHeader) + body_size + payload_size);
+    if (size > std::numeric_limits<uint32_t>::max())
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Record of " << size << " bytes is too big");
+        return location;
+    }
+
+    octet* record = reserve_record(log, size, location);
+    if (nullptr == record)
+    {
+        return location;
+    }
+
+    octet* data = record + sizeof(RecordHeader);
+    size_t data_size = size - sizeof(RecordHeader);
+    memcpy(data, body, body_size);
+    if (0 < payload_size)
+    {
+        memcpy(data + body_size, payload, payload_size);
+    }
+    memset(data + body_size + payload_size, 0, data_size - body_size - payload_size);
+
+    // The header is written after the rest of the record
+    RecordHeader header;
+    header.size = static_cast<uint32_t>(size);
+    header.kind = kind;
+    header.checksum = record_checksum(data, data_size);
+    memcpy(record, &header, sizeof(header));
+
+    return location;
+}
+
+LogPersistenceService::RecordLocation LogPersistenceService::append_copy(
+        Log& log,
+        const RecordLocation& record)
+{
+    RecordLocation location;
+    size_t size = record_size(record);
+    octet* data = reserve_record(log, size, location);
+    if (nullptr != data)
+    {
+        memcpy(data, record.segment->data + record.offset, size);
+        location.segment->live_bytes += size;
+    }
+    return location;
+}
+
+bool LogPersistenceService::add_segment(
+        Log& log,
+        size_t min_size)
+{
+    if (!log.segments.empty())
+    {
+        // The current segment is not going to be modified anymore
+        sync(log);
+    }
+
+    std::unique_ptr<Segment> segment(new Segment());
+    if (!segment->open(log.next_index, log.segment_name(log.next_index),
+            std::max(segment_size_, sizeof(SegmentHeader) + min_size)))
+    {
+        return false;
+    }
+    ++log.next_index;
+    log.segments.push_back(std::move(segment));
+
+    if (!log.compacting && 1 < log.segments.size())
+    {
+        size_t used_bytes = 0;
+        size_t live_bytes = 0;
+        for (size_t i = 0; i + 1 < log.segments.size(); ++i)
+        {
+            used_bytes += log.segments[i]->end - sizeof(SegmentHeader);
+            live_bytes += log.segments[i]->live_bytes;
+        }
+
+        if (live_bytes * 2 < used_bytes)
+        {
+            compact(log);
+        }
+    }
+
+    return true;
+}
+
+void LogPersistenceService::compact(
+        Log& log)
+{
+    log.compacting = true;
+
+    // The records still needed from the previous segments are appended again
+    uint64_t first_kept = log.segments.back()->index;
+    bool success = true;
+
+    for (auto& entry : log.changes)
+    {
+        if (success && entry.second.segment->index < first_kept)
+        {
+            RecordLocation location = append_copy(log, entry.second);
+            success = nullptr != location.segment;
+            if (success)
+            {
+                entry.second.segment->live_bytes -= record_size(entry.second);
+                entry.second = location;
+            }
+        }
+    }
+
+    for (auto& entry : log.writer_sequences)
+    {
+        if (success && entry.second.segment->index < first_kept)
+        {
+            RecordLocation location = append_copy(log, entry.second);
+            success = nullptr != location.segment;
+            if (success)
+            {
+                entry.second.segment->live_bytes -= record_size(entry.second);
+                entry.second = location;
+            }
+        }
+    }
+
+    if (success && log.has_last_sequence)
+    {
+        SequenceRecord record;
+        record.sequence_number = log.last_sequence;
+        success = nullptr != append_record(log, WRITER_LAST_SEQUENCE, &record, sizeof(record)).segment;
+    }
+
+    // The copies are written to disk before the head file stops pointing to the previous segments
+    success = success && sync(log);
+
+    if (success)
+    {
+        std::string head_name = log.head_name();
+        std::string tmp_name = head_name + ".tmp";
+        {
+            std::ofstream head(tmp_name, std::ios_base::trunc);
+            head << first_kept;
+            head.flush();
+            success = !head.fail();
+        }
+
+        // The new head file, and the entries of the segments created by the compaction, are written to disk before
+        // replacing the previous head file, which is atomic. Its new entry is written to disk before removing the
+        // previous segments, so a crash always leaves a head file pointing to segments with all the records.
+        success = success && sync_file(tmp_name) && sync_directory(tmp_name) &&
+                replace_file(tmp_name, head_name) && sync_directory(head_name);
+    }
+
+    if (success)
+    {
+        while (log.segments.front()->index < first_kept)
+        {
+            std::string filename = log.segments.front()->filename;
+            log.segments.pop_front();
+            boost::interprocess::file_mapping::remove(filename.c_str());
+        }
+    }
+    else
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Unable to compact log " << log.base_name);
+    }
+
+    log.compacting = false;
+}
+
+bool LogPersistenceService::sync(
+        Log& log)
+{
+    bool ret = true;
+    for (auto& segment : log.segments)
+    {
+        if (segment->synced < segment->end)
+        {
+            // The flushed range has to start on a page boundary
+            size_t offset = segment->synced - segment->synced % boost::interprocess::mapped_region::get_page_size();
+            if (segment->region.flush(offset, segment->end - offset, false))
+            {
+                segment->synced = segment->end;
+            }
+            else
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Unable to write log segment " << segment->filename);
+                ret = false;
+            }
+        }
+    }
+    return ret;
+}
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,179 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogPersistenceService.h
+ */
+
+#ifndef LOGPERSISTENCESERVICE_H_
+#define LOGPERSISTENCESERVICE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <rtps/persistence/PersistenceService.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Create a new append-only log implementation of persistence service
+ * @param filename     Prefix of the name of the files where the data is stored.
+ * @param segment_size Size of each of the files of a log.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+IPersistenceService* create_log_persistence_service(
+        const char* filename,
+        size_t segment_size);
+
+/**
+ * Persistence service implementation over memory-mapped append-only logs.
+ *
+ * The data of each persistence GUID is appended to its own log, made of segment files of a fixed size named
+ * <filename>_<guid>_<segment number>.log.
+ * The location of the records of the live changes is kept on an index which is rebuilt on startup by scanning the
+ * headers of the records, so the data of the changes is only read when loaded into the history.
+ * When a segment is full and less than half of the data on the previous segments is still needed, the needed
+ * records are appended again and the previous segments are removed.
+ *
+ * The compaction runs synchronously on the operation which fills a segment, so that operation also copies the
+ * needed records, which are less than half of the removed data, and waits for them and the new head file to be
+ * written to disk. With asynchronous commits it runs on the background thread instead, so writers are only blocked
+ * when the queue becomes full. Smaller segments make each compaction shorter but more frequent.
+ *
+ * The appended data is written to disk by the operating system, or when commit_transaction or flush are called.
+ * The files use the byte order of the host.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+class LogPersistenceService : public IPersistenceService
+{
+public:
+
+    LogPersistenceService(
+            const char* filename,
+            size_t segment_size);
+
+    virtual ~LogPersistenceService() override;
+
+    bool load_writer_from_storage(
+            const std::string& persistence_guid,
+            const GUID_t& writer_guid,
+            WriterHistory* history,
+            const std::shared_ptr<IChangePool>& change_pool,
+            const std::shared_ptr<IPayloadPool>& payload_pool,
+            SequenceNumber_t& next_sequence) final;
+
+    bool add_writer_change_to_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool remove_writer_change_from_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool load_reader_from_storage(
+            const std::string& reader_guid,
+            foonathan::memory::map<GUID_t, SequenceNumber_t, map_allocator_t>& seq_map) final;
+
+    bool update_writer_seq_on_storage(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number) final;
+
+    /**
+     * Write to disk the data appended to the logs.
+     * @return True if operation was successful.
+     */
+    bool commit_transaction() final;
+
+    /**
+     * Write to disk the data appended to the logs.
+     * @return True if operation was successful.
+     */
+    bool flush() final;
+
+private:
+
+    struct Segment;
+
+    struct Log;
+
+    //! Position of a record on a log
+    struct RecordLocation
+    {
+        Segment* segment = nullptr;
+        size_t offset = 0;
+    };
+
+    Log* get_log(
+            const std::string& guid);
+
+    bool recover(
+            Log& log);
+
+    void apply_record(
+            Log& log,
+            Segment& segment,
+            size_t offset);
+
+    //! Size of a record, including its header and padding
+    static size_t record_size(
+            const RecordLocation& location);
+
+    octet* reserve_record(
+            Log& log,
+            size_t size,
+            RecordLocation& location);
+
+    RecordLocation append_record(
+            Log& log,
+            uint32_t kind,
+            const void* body,
+            size_t body_size,
+            const octet* payload = nullptr,
+            size_t payload_size = 0);
+
+    RecordLocation append_copy(
+            Log& log,
+            const RecordLocation& record);
+
+    bool add_segment(
+            Log& log,
+            size_t min_size);
+
+    void compact(
+            Log& log);
+
+    bool sync(
+            Log& log);
+
+    std::string filename_;
+
+    size_t segment_size_;
+
+    std::mutex mutex_;
+
+    std::map<std::string, std::unique_ptr<Log>> logs_;
+};
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* LOGPERSISTENCESERVICE_H_ */
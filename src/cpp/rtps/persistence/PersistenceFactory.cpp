@@ -19,6 +19,12 @@
 
 #include <rtps/persistence/PersistenceService.h>
 
+#include <chrono>
+#include <cstdlib>
+
+#include <rtps/persistence/AsyncPersistenceService.h>
+#include <rtps/persistence/LogPersistenceService.h>
+
 #if HAVE_SQLITE3
 #include <rtps/persistence/SQLite3PersistenceService.h>
 #endif // if HAVE_SQLITE3
@@ -30,7 +36,24 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
-std::vector<CacheChange_t*>& IPersistenceService::get_changes(
+static bool is_property_true(
+        const PropertyPolicy& property_policy,
+        const std::string& name)
+{
+    const std::string* value = PropertyPolicyHelper::find_property(property_policy, name);
+    return value != nullptr && ((value->compare("TRUE") == 0) || (value->compare("true") == 0));
+}
+
+static uint32_t get_uint_property(
+        const PropertyPolicy& property_policy,
+        const std::string& name,
+        uint32_t default_value)
+{
+    const std::string* value = PropertyPolicyHelper::find_property(property_policy, name);
+    return value == nullptr ? default_value : static_cast<uint32_t>(std::strtoul(value->c_str(), nullptr, 10));
+}
+
+WriterHistory::ChangeCollection& IPersistenceService::get_changes(
         WriterHistory* history)
 {
     return history->m_changes;
@@ -44,10 +67,12 @@ void IPersistenceService::set_fragments(
 }
 
 IPersistenceService* PersistenceFactory::create_persistence_service(
-        const PropertyPolicy& property_policy)
+        const PropertyPolicy& property_policy,
+        const ThreadSettings& thread_settings)
 {
     IPersistenceService* ret_val = nullptr;
     const std::string* plugin_property = PropertyPolicyHelper::find_property(property_policy, "dds.persistence.plugin");
+    bool async_commit = is_property_true(property_policy, "dds.persistence.async_commit");
 
     if (plugin_property != nullptr)
     {
@@ -63,18 +88,34 @@ IPersistenceService* PersistenceFactory::create_persistence_service(
             const char* filename = (filename_property == nullptr) ?
                     "persistence.db" : filename_property->c_str();
 #endif // if ANDROID
-            bool update_schema = false;
-            const std::string* update_schema_value = PropertyPolicyHelper::find_property(property_policy,
-                            "dds.persistence.update_schema");
-            if (update_schema_value != nullptr &&
-                    ((update_schema_value->compare("TRUE") == 0) ||
-                    (update_schema_value->compare("true") == 0)))
-            {
-                update_schema = true;
-            }
-            ret_val = create_SQLite3_persistence_service(filename, update_schema);
+            bool update_schema = is_property_true(property_policy, "dds.persistence.update_schema");
+            // Transactions are committed from a background thread, so WAL journaling does not block the readers
+            ret_val = create_SQLite3_persistence_service(filename, update_schema, async_commit);
         }
 #endif // if HAVE_SQLITE3
+        if (plugin_property->compare("builtin.LOG") == 0)
+        {
+            const std::string* filename_property = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.log.filename");
+#ifdef ANDROID
+            const char* filename = (filename_property == nullptr) ?
+                    "/data/local/tmp/persistence_log" : filename_property->c_str();
+#else
+            const char* filename = (filename_property == nullptr) ?
+                    "persistence_log" : filename_property->c_str();
+#endif // if ANDROID
+            uint32_t segment_size = get_uint_property(property_policy, "dds.persistence.log.segment_size",
+                            64 * 1024 * 1024);
+            ret_val = create_log_persistence_service(filename, segment_size);
+        }
+    }
+
+    if (ret_val != nullptr && async_commit)
+    {
+        uint32_t max_delay_ms = get_uint_property(property_policy, "dds.persistence.async_commit.max_delay_ms", 10);
+        uint32_t max_pending = get_uint_property(property_policy, "dds.persistence.async_commit.max_pending", 4096);
+        ret_val = new AsyncPersistenceService(ret_val, std::chrono::milliseconds(max_delay_ms), max_pending,
+                        thread_settings);
     }
 
     return ret_val;
@@ -22,8 +22,10 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastdds/rtps/history/WriterHistory.h>
 
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
@@ -34,8 +36,6 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
-class WriterHistory;
-
 /**
  * Abstract interface representing a persistence service implementaion
  * @ingroup RTPS_PERSISTENCE_MODULE
@@ -109,7 +109,35 @@ public:
             const GUID_t& writer_guid,
             const SequenceNumber_t& seq_number) = 0;
 
-    static std::vector<CacheChange_t*>& get_changes(
+    /**
+     * Start a group of operations which will be stored together.
+     * Implementations able to store several operations atomically should override this method.
+     * @return True if operation was successful.
+     */
+    virtual bool begin_transaction()
+    {
+        return true;
+    }
+
+    /**
+     * Store the operations performed since the last call to begin_transaction.
+     * @return True if operation was successful.
+     */
+    virtual bool commit_transaction()
+    {
+        return true;
+    }
+
+    /**
+     * Wait until all the operations previously requested to this service are stored.
+     * @return True if all those operations were successfully stored.
+     */
+    virtual bool flush()
+    {
+        return true;
+    }
+
+    static WriterHistory::ChangeCollection& get_changes(
             WriterHistory* history);
 
     static void set_fragments(
@@ -127,12 +155,24 @@ class PersistenceFactory
 public:
 
     /**
-     * Create a persistence service implementation
+     * Create a persistence service implementation.
+     * Plugin builtin.SQLITE3 stores the data on the SQLite database dds.persistence.sqlite3.filename.
+     * Plugin builtin.LOG stores the data on memory-mapped append-only logs, on files prefixed with
+     * dds.persistence.log.filename and dds.persistence.log.segment_size bytes long (64 MiB by default).
+     * When property dds.persistence.async_commit is true, the changes are stored from a background thread, grouped
+     * on transactions, waiting at most dds.persistence.async_commit.max_delay_ms milliseconds (10 by default) and
+     * queuing at most dds.persistence.async_commit.max_pending operations (4096 by default).
+     * Each queued change keeps a copy of its payload, so up to max_pending payloads may be held in memory.
+     * Writes return before their changes are stored. DataWriter::flush_persistent_changes waits until they are;
+     * otherwise the changes of the last max_delay_ms milliseconds may be lost if the process ends abruptly. The queue
+     * is drained when the service is destroyed.
      * @param property_policy PropertyPolicy where the persistence configuration will be searched
+     * @param thread_settings Settings of the thread storing the changes when dds.persistence.async_commit is true
      * @return A pointer to a persistence service implementation. nullptr when policy does not contain the necessary properties or if persistence service could not be created
      */
     static IPersistenceService* create_persistence_service(
-            const PropertyPolicy& property_policy);
+            const PropertyPolicy& property_policy,
+            const ThreadSettings& thread_settings = {});
 };
 
 
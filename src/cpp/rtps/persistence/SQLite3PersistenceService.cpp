@@ -95,15 +95,20 @@ static int upgrade(
 
 static sqlite3* open_or_create_database(
         const char* filename,
-        bool update_schema)
+        bool update_schema,
+        bool use_wal)
 {
     sqlite3* db = NULL;
     int rc;
     int version = 3;
 
+    // With WAL journaling each connection has its own cache, so the transactions of different connections only
+    // block each other on commit
+    int cache_flag = use_wal ? SQLITE_OPEN_PRIVATECACHE : SQLITE_OPEN_SHAREDCACHE;
+
     // Open database
     int flags = SQLITE_OPEN_READWRITE |
-            SQLITE_OPEN_FULLMUTEX | SQLITE_OPEN_SHAREDCACHE;
+            SQLITE_OPEN_FULLMUTEX | cache_flag;
     rc = sqlite3_open_v2(filename, &db, flags, 0); // malloc that is not erased
     if (rc != SQLITE_OK)
     {
@@ -115,7 +120,7 @@ static sqlite3* open_or_create_database(
 
         //probably the database does not exists. Create new and no need to upgrade schema
         flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE |
-                SQLITE_OPEN_FULLMUTEX | SQLITE_OPEN_SHAREDCACHE;
+                SQLITE_OPEN_FULLMUTEX | cache_flag;
         rc = sqlite3_open_v2(filename, &db, flags, 0);
         if (rc != SQLITE_OK)
         {
@@ -156,6 +161,17 @@ static sqlite3* open_or_create_database(
         }
     }
 
+    if (use_wal)
+    {
+        // Wait for the transactions of other connections instead of failing
+        sqlite3_busy_timeout(db, 5000);
+        rc = sqlite3_exec(db, "PRAGMA journal_mode=WAL;", 0, 0, 0);
+        if (rc != SQLITE_OK)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Unable to enable WAL journaling on database " << filename);
+        }
+    }
+
     // Create tables if they don't exist
     rc = sqlite3_exec(db, SQLite3PersistenceServiceSchemaV3::database_create_statement().c_str(), 0, 0, 0);
     if (rc != SQLITE_OK)
@@ -183,9 +199,10 @@ static void finalize_statement(
 
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema)
+        bool update_schema,
+        bool use_wal)
 {
-    sqlite3* db = open_or_create_database(filename, update_schema);
+    sqlite3* db = open_or_create_database(filename, update_schema, use_wal);
     return (db == NULL) ? nullptr : new SQLite3PersistenceService(db);
 }
 
@@ -270,7 +287,7 @@ bool SQLite3PersistenceService::load_writer_from_storage(
         sqlite3_reset(load_writer_stmt_);
         sqlite3_bind_text(load_writer_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
 
-        std::vector<CacheChange_t*>& changes = get_changes(history);
+        WriterHistory::ChangeCollection& changes = get_changes(history);
 
         while (SQLITE_ROW == sqlite3_step(load_writer_stmt_))
         {
@@ -476,6 +493,31 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     return false;
 }
 
+bool SQLite3PersistenceService::begin_transaction()
+{
+    int rc = sqlite3_exec(db_, "BEGIN IMMEDIATE;", 0, 0, 0);
+    if (rc != SQLITE_OK)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Transaction could not be started. sqlite3_exec code: " << rc);
+        return false;
+    }
+
+    return true;
+}
+
+bool SQLite3PersistenceService::commit_transaction()
+{
+    int rc = sqlite3_exec(db_, "COMMIT;", 0, 0, 0);
+    if (rc != SQLITE_OK)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Transaction could not be committed. sqlite3_exec code: " << rc);
+        sqlite3_exec(db_, "ROLLBACK;", 0, 0, 0);
+        return false;
+    }
+
+    return true;
+}
+
 bool SQLite3PersistenceServiceSchemaV3::database_create_temporary_defaults_table(
         sqlite3* db)
 {
@@ -32,7 +32,8 @@ namespace rtps {
  */
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema);
+        bool update_schema,
+        bool use_wal = false);
 
 
 /**
@@ -99,6 +100,18 @@ public:
             const GUID_t& writer_guid,
             const SequenceNumber_t& seq_number) final;
 
+    /**
+     * Start a transaction on the database.
+     * @return True if operation was successful.
+     */
+    bool begin_transaction() final;
+
+    /**
+     * Commit the transaction started with begin_transaction.
+     * @return True if operation was successful.
+     */
+    bool commit_transaction() final;
+
 private:
 
     sqlite3* db_;
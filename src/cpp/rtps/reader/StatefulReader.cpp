@@ -59,7 +59,7 @@ static void send_datasharing_ack(
 {
     // This may not be the change read with highest SN,
     // need to find largest SN to ACK
-    for (std::vector<CacheChange_t*>::iterator it = history->changesBegin(); it != history->changesEnd(); ++it)
+    for (ReaderHistory::iterator it = history->changesBegin(); it != history->changesEnd(); ++it)
     {
         if (!(*it)->isRead)
         {
@@ -1283,7 +1283,7 @@ void StatefulReader::remove_changes_from(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     std::vector<CacheChange_t*> toremove;
-    for (std::vector<CacheChange_t*>::iterator it = history_->changesBegin();
+    for (ReaderHistory::iterator it = history_->changesBegin();
             it != history_->changesEnd(); ++it)
     {
         if ((*it)->writerGUID == writerGUID)
@@ -1321,7 +1321,7 @@ CacheChange_t* StatefulReader::next_untaken_cache()
 
     bool takeok = false;
     WriterProxy* wp;
-    std::vector<CacheChange_t*>::iterator it = history_->changesBegin();
+    ReaderHistory::iterator it = history_->changesBegin();
     while (it != history_->changesEnd())
     {
         if (this->matched_writer_lookup((*it)->writerGUID, &wp))
@@ -1365,7 +1365,7 @@ CacheChange_t* StatefulReader::next_unread_cache()
     std::vector<CacheChange_t*> toremove;
     bool readok = false;
     WriterProxy* wp = nullptr;
-    std::vector<CacheChange_t*>::iterator it = history_->changesBegin();
+    ReaderHistory::iterator it = history_->changesBegin();
     while (it != history_->changesEnd())
     {
         if ((*it)->isRead)
@@ -410,7 +410,7 @@ void StatelessReader::remove_changes_from(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     std::vector<CacheChange_t*> toremove;
-    for (std::vector<CacheChange_t*>::iterator it = history_->changesBegin();
+    for (ReaderHistory::iterator it = history_->changesBegin();
             it != history_->changesEnd(); ++it)
     {
         if ((*it)->writerGUID == writerGUID)
@@ -449,7 +449,7 @@ CacheChange_t* StatelessReader::next_unread_cache()
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     bool found = false;
-    std::vector<CacheChange_t*>::iterator it = history_->changesBegin();
+    ReaderHistory::iterator it = history_->changesBegin();
     while (it != history_->changesEnd())
     {
         if ((*it)->isRead)
@@ -18,6 +18,7 @@
 
 #include <rtps/resources/ResourceEvent.h>
 
+#include <algorithm>
 #include <cassert>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -46,6 +47,7 @@ ResourceEvent::~ResourceEvent()
 {
     // All timer should be unregistered before destroying this object.
     assert(pending_timers_.empty());
+    assert(queued_timers_.load() == nullptr);
     assert(timers_count_ == 0);
 
     stop_thread();
@@ -97,6 +99,7 @@ void ResourceEvent::unregister_timer(
     std::vector<TimedEventImpl*>::iterator it;
 
     // Remove from pending
+    dequeue_timers_nts();
     it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
     if (it != pending_timers_.end())
     {
@@ -105,21 +108,22 @@ void ResourceEvent::unregister_timer(
     }
 
     // Remove from active
-    it = std::find(active_timers_.begin(), active_timers_.end(), event);
-    if (it != active_timers_.end())
+    if (TimedEventImpl::INVALID_HEAP_INDEX != event->heap_index_)
     {
-        active_timers_.erase(it);
-
-        if (is_service_thread)
-        {
-            //! Warn the do_timer_actions loop to skip checking the rest of active_timers
-            //! in this iteration to prevent iterator invalidation
-            skip_checking_active_timers_.store(true);
-        }
-
+        remove_active_timer(event);
         should_notify = true;
     }
 
+    // Remove from the ones being triggered, so it is not added back to active
+    it = std::find(triggered_timers_.begin(), triggered_timers_.end(), event);
+    if (it != triggered_timers_.end())
+    {
+        triggered_timers_.erase(it);
+    }
+
+    // Other events may have been moved to pending
+    should_notify = should_notify || !pending_timers_.empty();
+
     // Decrement counter of created timers
     --timers_count_;
 
@@ -133,11 +137,10 @@ void ResourceEvent::unregister_timer(
 void ResourceEvent::notify(
         TimedEventImpl* event)
 {
-    std::lock_guard<TimedMutex> lock(mutex_);
-
-    if (register_timer_nts(event))
+    if (enqueue_timer(event))
     {
         // Notify the execution thread that something changed
+        std::lock_guard<TimedMutex> lock(mutex_);
         cv_.notify_one();
     }
 }
@@ -146,32 +149,55 @@ void ResourceEvent::notify(
         TimedEventImpl* event,
         const std::chrono::steady_clock::time_point& timeout)
 {
+    if (enqueue_timer(event))
+    {
 #if HAVE_STRICT_REALTIME
-    std::unique_lock<TimedMutex> lock(mutex_, std::defer_lock);
-    if (lock.try_lock_until(timeout))
+        // Taking the mutex avoids missing the wake up of an execution thread about to wait, but a late wake up
+        // is preferred to blocking beyond the timeout.
+        std::unique_lock<TimedMutex> lock(mutex_, std::defer_lock);
+        static_cast<void>(lock.try_lock_until(timeout));
 #else
-    static_cast<void>(timeout);
-    std::lock_guard<TimedMutex> _(mutex_);
+        static_cast<void>(timeout);
+        std::lock_guard<TimedMutex> lock(mutex_);
 #endif  // HAVE_STRICT_REALTIME
-    {
-        if (register_timer_nts(event))
-        {
-            // Notify the execution thread that something changed
-            cv_.notify_one();
-        }
+
+        // Notify the execution thread that something changed
+        cv_.notify_one();
     }
 }
 
-bool ResourceEvent::register_timer_nts(
+bool ResourceEvent::enqueue_timer(
         TimedEventImpl* event)
 {
-    if (std::find(pending_timers_.begin(), pending_timers_.end(), event) == pending_timers_.end())
+    if (event->queued_.exchange(true))
     {
-        pending_timers_.push_back(event);
-        return true;
+        // Already waiting to be processed
+        return false;
     }
 
-    return false;
+    TimedEventImpl* head = queued_timers_.load(std::memory_order_relaxed);
+    do
+    {
+        event->next_queued_ = head;
+    } while (!queued_timers_.compare_exchange_weak(head, event, std::memory_order_release,
+            std::memory_order_relaxed));
+
+    return nullptr == head;
+}
+
+void ResourceEvent::dequeue_timers_nts()
+{
+    TimedEventImpl* head = queued_timers_.exchange(nullptr, std::memory_order_acquire);
+    if (nullptr != head)
+    {
+        // The stack holds the events in reverse notification order
+        size_t first = pending_timers_.size();
+        for (; nullptr != head; head = head->next_queued_)
+        {
+            pending_timers_.push_back(head);
+        }
+        std::reverse(pending_timers_.begin() + first, pending_timers_.end());
+    }
 }
 
 void ResourceEvent::event_service()
@@ -191,7 +217,7 @@ void ResourceEvent::event_service()
         }
 
         // If pending timers exist, there is some work to be done, so no need to wait.
-        if (!pending_timers_.empty())
+        if (!pending_timers_.empty() || nullptr != queued_timers_.load())
         {
             continue;
         }
@@ -227,11 +253,6 @@ void ResourceEvent::event_service()
     cv_manipulation_.notify_all();
 }
 
-void ResourceEvent::sort_timers()
-{
-    std::sort(active_timers_.begin(), active_timers_.end(), event_compare);
-}
-
 void ResourceEvent::update_current_time()
 {
     current_time_ = std::chrono::steady_clock::now();
@@ -242,72 +263,131 @@ void ResourceEvent::do_timer_actions()
     std::chrono::steady_clock::time_point cancel_time =
             current_time_ + std::chrono::hours(24);
 
-    bool did_something = false;
-
     // Process pending orders
     {
         std::lock_guard<TimedMutex> lock(mutex_);
+        dequeue_timers_nts();
         for (TimedEventImpl* tp : pending_timers_)
         {
+            // From now on, a new notification should enqueue the event again
+            tp->queued_.store(false);
+
             // Remove item from active timers
-            auto current_pos = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-            current_pos = std::find(current_pos, active_timers_.end(), tp);
-            if (current_pos != active_timers_.end())
-            {
-                active_timers_.erase(current_pos);
-            }
+            remove_active_timer(tp);
 
             // Update timer info
             if (tp->update(current_time_, cancel_time))
             {
                 // Timer has to be activated: add to active timers
-                std::vector<TimedEventImpl*>::iterator low_bound;
-
-                // Insert on correct position
-                low_bound = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-                active_timers_.emplace(low_bound, tp);
+                push_active_timer(tp);
             }
         }
         pending_timers_.clear();
     }
 
-    // Trigger active timers
-    skip_checking_active_timers_.store(false);
-    for (TimedEventImpl* tp : active_timers_)
+    // Trigger active timers.
+    // Each one is taken out of the heap before calling its callback, which may unregister any event.
+    triggered_timers_.clear();
+    while (!active_timers_.empty() && active_timers_[0]->next_trigger_time() <= current_time_)
     {
-        if (tp->next_trigger_time() <= current_time_)
-        {
-            did_something = true;
-            tp->trigger(current_time_, cancel_time);
+        TimedEventImpl* tp = active_timers_[0];
+        remove_active_timer(tp);
+        triggered_timers_.push_back(tp);
+        tp->trigger(current_time_, cancel_time);
+    }
 
-            //! skip this iteration as active_timers has been manipulated
-            if (skip_checking_active_timers_.load())
-            {
-                break;
-            }
+    // Add back the restarted ones
+    for (TimedEventImpl* tp : triggered_timers_)
+    {
+        if (tp->next_trigger_time() < cancel_time)
+        {
+            push_active_timer(tp);
         }
-        else
+    }
+    triggered_timers_.clear();
+}
+
+void ResourceEvent::push_active_timer(
+        TimedEventImpl* event)
+{
+    event->heap_index_ = active_timers_.size();
+    active_timers_.push_back(event);
+    sift_up(event->heap_index_);
+}
+
+void ResourceEvent::remove_active_timer(
+        TimedEventImpl* event)
+{
+    size_t index = event->heap_index_;
+    if (TimedEventImpl::INVALID_HEAP_INDEX == index)
+    {
+        return;
+    }
+
+    event->heap_index_ = TimedEventImpl::INVALID_HEAP_INDEX;
+    TimedEventImpl* last = active_timers_.back();
+    active_timers_.pop_back();
+    if (last != event)
+    {
+        // Fill the hole with the last element, and restore the heap order from there
+        active_timers_[index] = last;
+        last->heap_index_ = index;
+        sift_down(index);
+        sift_up(last->heap_index_);
+    }
+}
+
+void ResourceEvent::sift_up(
+        size_t index)
+{
+    TimedEventImpl* event = active_timers_[index];
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!event_compare(event, active_timers_[parent]))
         {
             break;
         }
+
+        active_timers_[index] = active_timers_[parent];
+        active_timers_[index]->heap_index_ = index;
+        index = parent;
     }
 
-    // If an action was made, keep active_timers_ sorted
-    if (did_something)
+    active_timers_[index] = event;
+    event->heap_index_ = index;
+}
+
+void ResourceEvent::sift_down(
+        size_t index)
+{
+    TimedEventImpl* event = active_timers_[index];
+    size_t size = active_timers_.size();
+    while (true)
     {
-        sort_timers();
-        active_timers_.erase(
-            std::lower_bound(active_timers_.begin(), active_timers_.end(), nullptr,
-            [cancel_time](
-                TimedEventImpl* a,
-                TimedEventImpl* b)
-            {
-                (void)b;
-                return a->next_trigger_time() < cancel_time;
-            }),
-            active_timers_.end()
-            );
+        size_t child = 2 * index + 1;
+        if (child >= size)
+        {
+            break;
+        }
+
+        if (child + 1 < size && event_compare(active_timers_[child + 1], active_timers_[child]))
+        {
+            ++child;
+        }
+
+        if (!event_compare(active_timers_[child], event))
+        {
+            break;
+        }
+
+        active_timers_[index] = active_timers_[child];
+        active_timers_[index]->heap_index_ = index;
+        index = child;
     }
+
+    active_timers_[index] = event;
+    event->heap_index_ = index;
 }
 
 void ResourceEvent::init_thread(
@@ -130,14 +130,17 @@ private:
     //! The total number of created timers.
     size_t timers_count_ = 0;
 
+    //! Lock-free stack of events notified since the last time it was moved to pending_timers_.
+    std::atomic<TimedEventImpl*> queued_timers_{ nullptr };
+
     //! Collection of events pending update action.
     std::vector<TimedEventImpl*> pending_timers_;
 
-    //! Collection of registered events waiting completion.
+    //! Binary min-heap of registered events waiting completion, ordered by trigger time.
     std::vector<TimedEventImpl*> active_timers_;
 
-    //! Prevents iterator invalidation when active_timers are manipulated inside loops
-    std::atomic<bool> skip_checking_active_timers_;
+    //! Events being triggered by the execution thread, to be added back to active_timers_ if restarted.
+    std::vector<TimedEventImpl*> triggered_timers_;
 
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
@@ -146,19 +149,38 @@ private:
     std::unique_ptr<eprosima::thread> thread_;
 
     /*!
-     * @brief Registers a new TimedEventImpl object in the internal queue to be processed.
-     * Non thread safe.
+     * @brief Adds a TimedEventImpl object to the queue of events to be processed.
+     * Thread safe and lock-free.
      * @param event Event to be added in the queue.
-     * @return True value if the insertion was successful. In other case, it return False.
+     * @return True value if the queue was empty, so the execution thread should be woken up.
      */
-    bool register_timer_nts(
+    bool enqueue_timer(
             TimedEventImpl* event);
 
+    /*!
+     * @brief Moves the queued events to pending_timers_.
+     * Non thread safe.
+     */
+    void dequeue_timers_nts();
+
     //! Method called by the internal thread.
     void event_service();
 
-    //! Sorts waiting timers in ascending order of trigger time.
-    void sort_timers();
+    //! Adds an event to the heap of active timers.
+    void push_active_timer(
+            TimedEventImpl* event);
+
+    //! Removes an event from the heap of active timers, if present.
+    void remove_active_timer(
+            TimedEventImpl* event);
+
+    //! Moves an event on the heap of active timers towards the root, until the heap order is restored.
+    void sift_up(
+            size_t index);
+
+    //! Moves an event on the heap of active timers towards the leaves, until the heap order is restored.
+    void sift_down(
+            size_t index);
 
     //! Updates internal register of current time.
     void update_current_time();
@@ -171,6 +193,7 @@ private:
     {
         pending_timers_.reserve(timers_count_);
         active_timers_.reserve(timers_count_);
+        triggered_timers_.reserve(timers_count_);
     }
 
 };
@@ -26,12 +26,16 @@
 #include <rtps/resources/TimedEvent.h>
 
 #include <atomic>
+#include <cstddef>
 #include <functional>
+#include <limits>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+class ResourceEvent;
+
 /*!
  * This class encapsulates a timer.
  * It also manages the state of the event (INACTIVE, READY, WAITING..).
@@ -145,6 +149,10 @@ public:
 
 private:
 
+    friend class ResourceEvent;
+
+    static constexpr size_t INVALID_HEAP_INDEX = (std::numeric_limits<size_t>::max)();
+
     //! Expiration time in microseconds of the event.
     std::atomic<std::chrono::microseconds> interval_microsec_;
 
@@ -156,6 +164,15 @@ private:
 
     //! Current state of this event
     std::atomic<StateCode> state_;
+
+    //! Position of this event on the ResourceEvent's heap of active timers. Owned by ResourceEvent.
+    size_t heap_index_ = INVALID_HEAP_INDEX;
+
+    //! Whether this event is on the ResourceEvent's queue of pending events. Owned by ResourceEvent.
+    std::atomic<bool> queued_{false};
+
+    //! Next event on the ResourceEvent's queue of pending events. Owned by ResourceEvent.
+    TimedEventImpl* next_queued_ = nullptr;
 };
 
 } // namespace rtps
@@ -25,20 +25,22 @@ using IPLocator = fastdds::rtps::IPLocator;
 
 TCPAcceptorBasic::TCPAcceptorBasic(
         asio::io_service& io_service,
+        asio::io_service& socket_service,
         TCPTransportInterface* parent,
         const Locator& locator)
     : TCPAcceptor(io_service, parent, locator)
-    , socket_(*io_service_)
+    , socket_(socket_service)
 {
     endpoint_ = asio::ip::tcp::endpoint(parent->generate_protocol(), IPLocator::getPhysicalPort(locator_));
 }
 
 TCPAcceptorBasic::TCPAcceptorBasic(
         asio::io_service& io_service,
+        asio::io_service& socket_service,
         const std::string& iface,
         const Locator& locator)
     : TCPAcceptor(io_service, iface, locator)
-    , socket_(*io_service_)
+    , socket_(socket_service)
 {
     endpoint_ = asio::ip::tcp::endpoint(asio::ip::address::from_string(iface),
                     IPLocator::getPhysicalPort(locator_));
@@ -32,22 +32,26 @@ public:
     /**
      * Constructor
      * @param io_service Reference to the ASIO service.
+     * @param socket_service Reference to the ASIO service where the accepted sockets are created.
      * @param parent Pointer to the transport that is going to manage the acceptor.
      * @param locator Locator with the information about where to accept connections.
      */
     TCPAcceptorBasic(
             asio::io_service& io_service,
+            asio::io_service& socket_service,
             TCPTransportInterface* parent,
             const Locator& locator);
 
     /**
      * Constructor
      * @param io_service Reference to the ASIO service.
+     * @param socket_service Reference to the ASIO service where the accepted sockets are created.
      * @param iface Network interface to bind the socket
      * @param locator Locator with the information about where to accept connections.
      */
     TCPAcceptorBasic(
             asio::io_service& io_service,
+            asio::io_service& socket_service,
             const std::string& iface,
             const Locator& locator);
 
@@ -74,6 +74,8 @@ protected:
     std::mutex read_mutex_;
     std::recursive_mutex pending_logical_mutex_;
     std::atomic<eConnectionStatus> connection_status_;
+    // Identifies the current asynchronous reception of the channel, so a previous one stops when a new one starts.
+    std::atomic<uint32_t> reception_id_{0};
 
 public:
 
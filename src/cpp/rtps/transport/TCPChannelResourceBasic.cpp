@@ -32,20 +32,24 @@ using Log = fastdds::dds::Log;
 TCPChannelResourceBasic::TCPChannelResourceBasic(
         TCPTransportInterface* parent,
         asio::io_service& service,
+        asio::io_service& socket_service,
         const Locator& locator,
         uint32_t maxMsgSize)
     : TCPChannelResource(parent, locator, maxMsgSize)
     , service_(service)
+    , socket_service_(socket_service)
 {
 }
 
 TCPChannelResourceBasic::TCPChannelResourceBasic(
         TCPTransportInterface* parent,
         asio::io_service& service,
+        asio::io_service& socket_service,
         std::shared_ptr<asio::ip::tcp::socket> socket,
         uint32_t maxMsgSize)
     : TCPChannelResource(parent, maxMsgSize)
     , service_(service)
+    , socket_service_(socket_service)
     , socket_(socket)
 {
 }
@@ -71,7 +75,7 @@ void TCPChannelResourceBasic::connect(
                                 locator_),
                             std::to_string(IPLocator::getPhysicalPort(locator_))});
 
-            socket_ = std::make_shared<asio::ip::tcp::socket>(service_);
+            socket_ = std::make_shared<asio::ip::tcp::socket>(socket_service_);
             std::weak_ptr<TCPChannelResource> channel_weak_ptr = myself;
 
             asio::async_connect(
@@ -85,9 +89,24 @@ void TCPChannelResourceBasic::connect(
 #endif // if ASIO_VERSION >= 101200
                 )
                 {
-                    if (!channel_weak_ptr.expired())
+                    if (&socket_service_ == &service_)
                     {
-                        parent_->SocketConnected(channel_weak_ptr, ec);
+                        if (!channel_weak_ptr.expired())
+                        {
+                            parent_->SocketConnected(channel_weak_ptr, ec);
+                        }
+                    }
+                    else
+                    {
+                        // Connections are completed on the thread of the transport, never on the reactor threads
+                        TCPTransportInterface* parent = parent_;
+                        service_.post([parent, channel_weak_ptr, ec]()
+                        {
+                            if (!channel_weak_ptr.expired())
+                            {
+                                parent->SocketConnected(channel_weak_ptr, ec);
+                            }
+                        });
                     }
                 }
                 );
@@ -109,7 +128,7 @@ void TCPChannelResourceBasic::disconnect()
         std::error_code ec;
         socket->shutdown(asio::ip::tcp::socket::shutdown_both, ec);
 
-        service_.post([&, socket]()
+        socket_service_.post([&, socket]()
                 {
                     try
                     {
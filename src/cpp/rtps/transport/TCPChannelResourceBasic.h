@@ -16,6 +16,8 @@
 #define _FASTDDS_TCP_CHANNEL_RESOURCE_BASIC_
 
 #include <mutex>
+#include <utility>
+
 #include <asio.hpp>
 #include <rtps/transport/TCPChannelResource.h>
 
@@ -26,6 +28,8 @@ namespace rtps {
 class TCPChannelResourceBasic : public TCPChannelResource
 {
     asio::io_service& service_;
+    // Service running the operations on the socket, which is the reactor one when reactor threads are enabled
+    asio::io_service& socket_service_;
 
     std::mutex send_mutex_;
     std::shared_ptr<asio::ip::tcp::socket> socket_;
@@ -36,6 +40,7 @@ public:
     TCPChannelResourceBasic(
             TCPTransportInterface* parent,
             asio::io_service& service,
+            asio::io_service& socket_service,
             const Locator& locator,
             uint32_t maxMsgSize);
 
@@ -43,6 +48,7 @@ public:
     TCPChannelResourceBasic(
             TCPTransportInterface* parent,
             asio::io_service& service,
+            asio::io_service& socket_service,
             std::shared_ptr<asio::ip::tcp::socket> socket,
             uint32_t maxMsgSize);
 
@@ -58,6 +64,32 @@ public:
             std::size_t size,
             asio::error_code& ec) override;
 
+    /**
+     * Start reading asynchronously some bytes from the socket.
+     *
+     * @param buffer Pointer to the buffer where the bytes will be stored. It must be valid until the handler is called.
+     * @param size Maximum number of bytes to read.
+     * @param handler Function called with the error code and the number of bytes read.
+     *
+     * @return false when the channel is not connected, so the read was not started.
+     */
+    template<typename ReadHandler>
+    bool async_read_some(
+            octet* buffer,
+            std::size_t size,
+            ReadHandler&& handler)
+    {
+        std::unique_lock<std::mutex> read_lock(read_mutex_);
+
+        if (eConnecting < connection_status_)
+        {
+            socket_->async_read_some(asio::buffer(buffer, size), std::forward<ReadHandler>(handler));
+            return true;
+        }
+
+        return false;
+    }
+
     size_t send(
             const octet* header,
             size_t header_size,
@@ -80,6 +80,7 @@ using Log = fastdds::dds::Log;
 
 static const int s_default_keep_alive_frequency = 5000; // 5 SECONDS
 static const int s_default_keep_alive_timeout = 15000; // 15 SECONDS
+static const size_t s_initial_async_buffer_size = 8192; // Initial size of the buffer of an asynchronous reception
 //static const int s_clean_deleted_sockets_pool_timeout = 100; // 100 MILLISECONDS
 
 TCPTransportDescriptor::TCPTransportDescriptor()
@@ -95,6 +96,7 @@ TCPTransportDescriptor::TCPTransportDescriptor()
     , check_crc(true)
     , apply_security(false)
     , non_blocking_send(false)
+    , reactor_threads(0)
 {
 }
 
@@ -116,6 +118,7 @@ TCPTransportDescriptor::TCPTransportDescriptor(
     , keep_alive_thread(t.keep_alive_thread)
     , accept_thread(t.accept_thread)
     , non_blocking_send(t.non_blocking_send)
+    , reactor_threads(t.reactor_threads)
 {
 }
 
@@ -138,6 +141,7 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator =(
     keep_alive_thread = t.keep_alive_thread;
     accept_thread = t.accept_thread;
     non_blocking_send = t.non_blocking_send;
+    reactor_threads = t.reactor_threads;
     return *this;
 }
 
@@ -159,6 +163,7 @@ bool TCPTransportDescriptor::operator ==(
            this->keep_alive_thread == t.keep_alive_thread &&
            this->accept_thread == t.accept_thread &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->reactor_threads == t.reactor_threads &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -243,6 +248,13 @@ void TCPTransportInterface::clean()
         io_service_.stop();
         io_service_thread_.join();
     }
+
+    io_service_reactor_.stop();
+    for (eprosima::thread& reactor_thread : reactor_threads_)
+    {
+        reactor_thread.join();
+    }
+    reactor_threads_.clear();
 }
 
 Locator TCPTransportInterface::remote_endpoint_to_locator(
@@ -296,11 +308,7 @@ bool TCPTransportInterface::check_crc(
         const octet* data,
         uint32_t size) const
 {
-    uint32_t crc(0);
-    for (uint32_t i = 0; i < size; ++i)
-    {
-        crc = RTCPMessageManager::addToCRC(crc, data[i]);
-    }
+    uint32_t crc = RTCPMessageManager::addToCRC(0, data, size);
     return crc == header.crc;
 }
 
@@ -311,12 +319,7 @@ void TCPTransportInterface::calculate_crc(
     uint32_t crc(0);
     for (const NetworkBuffer& buffer : buffers)
     {
-        size_t size = buffer.size;
-        const octet* data = static_cast<const octet*>(buffer.buffer);
-        for (size_t i = 0; i < size; ++i)
-        {
-            crc = RTCPMessageManager::addToCRC(crc, data[i]);
-        }
+        crc = RTCPMessageManager::addToCRC(crc, static_cast<const octet*>(buffer.buffer), buffer.size);
     }
     header.crc = crc;
 }
@@ -342,7 +345,8 @@ uint16_t TCPTransportInterface::create_acceptor_socket(
 #endif // if TLS_FOUND
             {
                 std::shared_ptr<TCPAcceptorBasic> acceptor =
-                        std::make_shared<TCPAcceptorBasic>(io_service_, this, locator);
+                        std::make_shared<TCPAcceptorBasic>(io_service_, reception_io_service(), this,
+                        locator);
                 acceptors_[acceptor->locator()] = acceptor;
                 acceptor->accept(this);
                 final_port = static_cast<uint16_t>(acceptor->locator().port);
@@ -380,7 +384,8 @@ uint16_t TCPTransportInterface::create_acceptor_socket(
 #endif // if TLS_FOUND
                 {
                     std::shared_ptr<TCPAcceptorBasic> acceptor =
-                            std::make_shared<TCPAcceptorBasic>(io_service_, sInterface, loc);
+                            std::make_shared<TCPAcceptorBasic>(io_service_, reception_io_service(), sInterface,
+                            loc);
                     acceptors_[acceptor->locator()] = acceptor;
                     acceptor->accept(this);
                     final_port = static_cast<uint16_t>(acceptor->locator().port);
@@ -535,6 +540,21 @@ bool TCPTransportInterface::init(
             };
     io_service_thread_ = create_thread(ioServiceFunction, configuration()->accept_thread, "dds.tcp_accept");
 
+    auto ioServiceReactorFunction = [&]()
+            {
+#if ASIO_VERSION >= 101200
+                asio::executor_work_guard<asio::io_service::executor_type> work(io_service_reactor_.get_executor());
+#else
+                io_service::work work(io_service_reactor_);
+#endif // if ASIO_VERSION >= 101200
+                io_service_reactor_.run();
+            };
+    for (uint32_t i = 0; i < configuration()->reactor_threads; ++i)
+    {
+        reactor_threads_.push_back(create_thread(ioServiceReactorFunction,
+                configuration()->default_reception_threads(), "dds.tcp_io.%u", i));
+    }
+
     if (0 < configuration()->keep_alive_frequency_ms)
     {
         auto ioServiceTimersFunction = [&]()
@@ -852,7 +872,7 @@ bool TCPTransportInterface::OpenOutputChannel(
                     physical_locator, configuration()->maxMessageSize)) :
 #endif // if TLS_FOUND
                 static_cast<TCPChannelResource*>(
-                    new TCPChannelResourceBasic(this, io_service_, physical_locator,
+                    new TCPChannelResourceBasic(this, io_service_, reception_io_service(), physical_locator,
                     configuration()->maxMessageSize))
                 );
 
@@ -974,7 +994,7 @@ bool TCPTransportInterface::CreateInitialConnect(
             physical_locator, configuration()->maxMessageSize)) :
 #endif // if TLS_FOUND
         static_cast<TCPChannelResource*>(
-            new TCPChannelResourceBasic(this, io_service_, physical_locator,
+            new TCPChannelResourceBasic(this, io_service_, reception_io_service(), physical_locator,
             configuration()->maxMessageSize))
         );
 
@@ -1077,6 +1097,12 @@ void TCPTransportInterface::keep_alive()
 void TCPTransportInterface::create_listening_thread(
         const std::shared_ptr<TCPChannelResource>& channel)
 {
+    if (0 < configuration()->reactor_threads && nullptr != dynamic_cast<TCPChannelResourceBasic*>(channel.get()))
+    {
+        start_async_reception(channel);
+        return;
+    }
+
     std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
     std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
     auto fn = [this, channel_weak_ptr, rtcp_manager_weak_ptr]()
@@ -1093,40 +1119,13 @@ void TCPTransportInterface::perform_listen_operation(
         std::weak_ptr<RTCPMessageManager> rtcp_manager)
 {
     Locator remote_locator;
-    uint16_t logicalPort(0);
-    std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
     std::shared_ptr<TCPChannelResource> channel;
-    rtcp_message_manager = rtcp_manager.lock();
-
-    // RTCP Control Message
-    if (rtcp_message_manager)
-    {
-        channel = channel_weak.lock();
-
-        if (channel)
-        {
-            remote_locator = remote_endpoint_to_locator(channel);
-
-            if (channel->tcp_connection_type() == TCPChannelResource::TCPConnectionType::TCP_CONNECT_TYPE)
-            {
-                rtcp_message_manager->sendConnectionRequest(channel);
-            }
-            else
-            {
-                channel->change_status(TCPChannelResource::eConnectionStatus::eWaitingForBind);
-            }
-        }
-
-        std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-        rtcp_message_manager.reset();
-        rtcp_message_manager_cv_.notify_one();
-    }
-    else
+    if (!start_reception(channel_weak, rtcp_manager, channel, remote_locator))
     {
         return;
     }
 
-    while (channel && TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+    while (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
     {
         // Blocking receive.
         CDRMessage_t& msg = channel->message_buffer();
@@ -1139,31 +1138,77 @@ void TCPTransportInterface::perform_listen_operation(
         if (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
         {
             // Processes the data through the CDR Message interface.
-            logicalPort = IPLocator::getLogicalPort(remote_locator);
-            std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
-            auto it = receiver_resources_.find(logicalPort);
-            if (it != receiver_resources_.end())
-            {
-                TransportReceiverInterface* receiver = it->second.first;
-                ReceiverInUseCV* receiver_in_use = it->second.second;
-                receiver_in_use->in_use++;
-                scopedLock.unlock();
-                receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
-                scopedLock.lock();
-                receiver_in_use->in_use--;
-                receiver_in_use->cv.notify_one();
-            }
-            else
-            {
-                EPROSIMA_LOG_WARNING(RTCP,
-                        "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
-            }
+            deliver_message(channel, msg.buffer, msg.length, remote_locator);
         }
     }
 
     EPROSIMA_LOG_INFO(RTCP, "End PerformListenOperation " << channel->locator());
 }
 
+bool TCPTransportInterface::start_reception(
+        const std::weak_ptr<TCPChannelResource>& channel_weak,
+        const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        Locator& remote_locator)
+{
+    std::shared_ptr<RTCPMessageManager> rtcp_message_manager = rtcp_manager.lock();
+
+    // RTCP Control Message
+    if (!rtcp_message_manager)
+    {
+        return false;
+    }
+
+    channel = channel_weak.lock();
+
+    if (channel)
+    {
+        remote_locator = remote_endpoint_to_locator(channel);
+
+        if (channel->tcp_connection_type() == TCPChannelResource::TCPConnectionType::TCP_CONNECT_TYPE)
+        {
+            rtcp_message_manager->sendConnectionRequest(channel);
+        }
+        else
+        {
+            channel->change_status(TCPChannelResource::eConnectionStatus::eWaitingForBind);
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+    rtcp_message_manager.reset();
+    rtcp_message_manager_cv_.notify_one();
+
+    return nullptr != channel;
+}
+
+void TCPTransportInterface::deliver_message(
+        const std::shared_ptr<TCPChannelResource>& channel,
+        const octet* buffer,
+        uint32_t size,
+        const Locator& remote_locator)
+{
+    uint16_t logicalPort = IPLocator::getLogicalPort(remote_locator);
+    std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
+    auto it = receiver_resources_.find(logicalPort);
+    if (it != receiver_resources_.end())
+    {
+        TransportReceiverInterface* receiver = it->second.first;
+        ReceiverInUseCV* receiver_in_use = it->second.second;
+        receiver_in_use->in_use++;
+        scopedLock.unlock();
+        receiver->OnDataReceived(buffer, size, channel->locator(), remote_locator);
+        scopedLock.lock();
+        receiver_in_use->in_use--;
+        receiver_in_use->cv.notify_one();
+    }
+    else
+    {
+        EPROSIMA_LOG_WARNING(RTCP,
+                "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+    }
+}
+
 bool TCPTransportInterface::read_body(
         octet* receive_buffer,
         uint32_t,
@@ -1338,54 +1383,8 @@ bool TCPTransportInterface::Receive(
 
                 if (success)
                 {
-                    if (configuration()->check_crc
-                            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
-                    {
-                        EPROSIMA_LOG_WARNING(RTCP_MSG_IN, "Bad TCP header CRC");
-                    }
-
-                    if (tcp_header.logical_port == 0)
-                    {
-                        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-                        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
-                        {
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager = rtcp_manager.lock();
-                        }
-
-                        if (rtcp_message_manager)
-                        {
-                            // The channel is not going to be deleted because we lock it for reading.
-                            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
-                                channel, receive_buffer, body_size, msg_endian);
-
-                            if (responseCode != RETCODE_OK)
-                            {
-                                close_tcp_socket(channel);
-                            }
-                            success = false;
-
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager.reset();
-                            rtcp_message_manager_cv_.notify_one();
-                        }
-                        else
-                        {
-                            success = false;
-                            close_tcp_socket(channel);
-                        }
-
-                    }
-                    else
-                    {
-                        if (!IsLocatorValid(remote_locator))
-                        {
-                            remote_locator = remote_endpoint_to_locator(channel);
-                        }
-                        IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
-                        EPROSIMA_LOG_INFO(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
-                                                                          << " - " << receive_buffer_size << " bytes.");
-                    }
+                    success = process_message(rtcp_manager, channel, tcp_header, receive_buffer,
+                                    receive_buffer_size, msg_endian, remote_locator);
                 }
                 // Error message already shown by read_body method.
             }
@@ -1417,6 +1416,276 @@ bool TCPTransportInterface::Receive(
     return success;
 }
 
+bool TCPTransportInterface::process_message(
+        std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const TCPHeader& tcp_header,
+        octet* receive_buffer,
+        uint32_t receive_buffer_size,
+        fastdds::rtps::Endianness_t msg_endian,
+        Locator& remote_locator)
+{
+    if (configuration()->check_crc
+            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
+    {
+        EPROSIMA_LOG_WARNING(RTCP_MSG_IN, "Bad TCP header CRC");
+    }
+
+    if (tcp_header.logical_port == 0)
+    {
+        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
+        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
+        {
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager = rtcp_manager.lock();
+        }
+
+        if (rtcp_message_manager)
+        {
+            // The channel is not going to be deleted because we lock it for reading.
+            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
+                channel, receive_buffer, receive_buffer_size, msg_endian);
+
+            if (responseCode != RETCODE_OK)
+            {
+                close_tcp_socket(channel);
+            }
+
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager.reset();
+            rtcp_message_manager_cv_.notify_one();
+        }
+        else
+        {
+            close_tcp_socket(channel);
+        }
+
+        return false;
+    }
+
+    if (!IsLocatorValid(remote_locator))
+    {
+        remote_locator = remote_endpoint_to_locator(channel);
+    }
+    IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
+    EPROSIMA_LOG_INFO(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
+                                                      << " - " << receive_buffer_size << " bytes.");
+    return true;
+}
+
+struct TCPTransportInterface::AsyncReception
+{
+    std::weak_ptr<TCPChannelResource> channel;
+
+    std::weak_ptr<RTCPMessageManager> rtcp_manager;
+
+    //! Value of the reception_id_ of the channel when this reception started
+    uint32_t id = 0;
+
+    Locator remote_locator;
+
+    fastdds::rtps::Endianness_t msg_endian = DEFAULT_ENDIAN;
+
+    //! Maximum size of the body of a message
+    std::size_t max_body_size = 0;
+
+    //! Received bytes not processed yet are kept on [begin, end).
+    //! It grows up to the size of the biggest message received, so idle connections use little memory.
+    std::vector<octet> buffer;
+
+    std::size_t begin = 0;
+
+    std::size_t end = 0;
+
+    //! Remaining bytes of a message too big for the buffer, which are being dropped
+    std::size_t bytes_to_drop = 0;
+};
+
+asio::io_service& TCPTransportInterface::reception_io_service()
+{
+    return 0 < configuration()->reactor_threads ? io_service_reactor_ : io_service_;
+}
+
+void TCPTransportInterface::start_async_reception(
+        const std::shared_ptr<TCPChannelResource>& channel)
+{
+    auto reception = std::make_shared<AsyncReception>();
+    reception->channel = channel;
+    reception->rtcp_manager = rtcp_message_manager_;
+    reception->id = ++channel->reception_id_;
+    reception->msg_endian = channel->message_buffer().msg_endian;
+    reception->max_body_size = channel->message_buffer().max_size;
+    reception->buffer.resize(std::min(TCPHeader::size() + reception->max_body_size, s_initial_async_buffer_size));
+
+    // The RTCP initialization may send a request, so it is not done on the thread accepting or connecting the socket
+    io_service_reactor_.post([this, reception]()
+            {
+                std::shared_ptr<TCPChannelResource> channel_ptr;
+                if (start_reception(reception->channel, reception->rtcp_manager, channel_ptr,
+                        reception->remote_locator))
+                {
+                    async_receive(reception);
+                }
+            });
+}
+
+void TCPTransportInterface::async_receive(
+        const std::shared_ptr<AsyncReception>& reception)
+{
+    std::shared_ptr<TCPChannelResource> channel = reception->channel.lock();
+    if (!channel || reception->id != channel->reception_id_ ||
+            TCPChannelResource::eConnectionStatus::eConnecting >= channel->connection_status())
+    {
+        EPROSIMA_LOG_INFO(RTCP, "End asynchronous reception");
+        return;
+    }
+
+    // The buffer never keeps a whole message after being processed, and it is big enough for the incomplete one,
+    // so there is always room for more bytes
+    auto basic_channel = static_cast<TCPChannelResourceBasic*>(channel.get());
+    basic_channel->async_read_some(&reception->buffer[reception->end], reception->buffer.size() - reception->end,
+            [this, reception](const asio::error_code& ec, std::size_t bytes_received)
+            {
+                on_async_receive(reception, ec, bytes_received);
+            });
+}
+
+void TCPTransportInterface::on_async_receive(
+        const std::shared_ptr<AsyncReception>& reception,
+        const asio::error_code& ec,
+        std::size_t bytes_received)
+{
+    std::shared_ptr<TCPChannelResource> channel = reception->channel.lock();
+    if (!channel || reception->id != channel->reception_id_)
+    {
+        return;
+    }
+
+    if (ec)
+    {
+        if (ec != asio::error::operation_aborted)
+        {
+            if (ec != asio::error::eof)
+            {
+                EPROSIMA_LOG_WARNING(DEBUG, "Failed to read TCP message: " << ec.message());
+            }
+            close_tcp_socket(channel);
+        }
+        return;
+    }
+
+    reception->end += bytes_received;
+
+    try
+    {
+        process_async_reception(channel, *reception);
+    }
+    catch (const asio::system_error& error)
+    {
+        (void)error;
+        EPROSIMA_LOG_ERROR(RTCP_MSG_IN, "ASIO SYSTEM_ERROR [RECEIVE]: " << error.what());
+        close_tcp_socket(channel);
+        return;
+    }
+
+    async_receive(reception);
+}
+
+void TCPTransportInterface::process_async_reception(
+        std::shared_ptr<TCPChannelResource>& channel,
+        AsyncReception& reception)
+{
+    octet* data = reception.buffer.data();
+    const std::size_t header_size = TCPHeader::size();
+    std::size_t required_size = 0;
+
+    while (reception.begin < reception.end &&
+            TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+    {
+        std::size_t available = reception.end - reception.begin;
+        octet* message = &data[reception.begin];
+
+        if (0 < reception.bytes_to_drop)
+        {
+            std::size_t dropped = std::min(available, reception.bytes_to_drop);
+            reception.begin += dropped;
+            reception.bytes_to_drop -= dropped;
+            continue;
+        }
+
+        // Wait for sync, skipping any byte before the next "RTCP"
+        if (available < 4)
+        {
+            break;
+        }
+        if (0 != memcmp(message, "RTCP", 4))
+        {
+            ++reception.begin;
+            continue;
+        }
+
+        if (available < header_size)
+        {
+            break;
+        }
+
+        TCPHeader tcp_header;
+        memcpy(tcp_header.address(), message, header_size);
+        tcp_header.valid_endianness(reception.msg_endian);
+        if (tcp_header.length < header_size)
+        {
+            // Not a valid header, look for the next one
+            ++reception.begin;
+            continue;
+        }
+
+        std::size_t body_size = tcp_header.length - header_size;
+        if (body_size > reception.max_body_size)
+        {
+            EPROSIMA_LOG_ERROR(RTCP_MSG_IN, "Size of incoming TCP message is bigger than buffer capacity: "
+                    << static_cast<uint32_t>(body_size) << " vs. " << reception.max_body_size << ". "
+                    << "The full message will be dropped.");
+            reception.begin += header_size;
+            reception.bytes_to_drop = body_size;
+            continue;
+        }
+
+        if (available < header_size + body_size)
+        {
+            required_size = header_size + body_size;
+            break;
+        }
+
+        EPROSIMA_LOG_INFO(RTCP_MSG_IN, "Received RTCP MSG. Logical Port " << tcp_header.logical_port);
+        reception.begin += header_size + body_size;
+        octet* body = message + header_size;
+        uint32_t body_length = static_cast<uint32_t>(body_size);
+        if (process_message(reception.rtcp_manager, channel, tcp_header, body, body_length, reception.msg_endian,
+                reception.remote_locator) && 0 < body_length &&
+                TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+        {
+            deliver_message(channel, body, body_length, reception.remote_locator);
+        }
+    }
+
+    // Move the bytes of an incomplete message to the beginning of the buffer
+    if (reception.begin == reception.end)
+    {
+        reception.begin = reception.end = 0;
+    }
+    else if (0 < reception.begin)
+    {
+        memmove(data, &data[reception.begin], reception.end - reception.begin);
+        reception.end -= reception.begin;
+        reception.begin = 0;
+    }
+
+    if (reception.buffer.size() < required_size)
+    {
+        reception.buffer.resize(required_size);
+    }
+}
+
 bool TCPTransportInterface::send(
         const std::vector<NetworkBuffer>& buffers,
         uint32_t total_bytes,
@@ -1597,7 +1866,7 @@ void TCPTransportInterface::SocketAccepted(
         {
             // Always create a new channel, it might be replaced later in bind_socket()
             std::shared_ptr<TCPChannelResource> channel(new TCPChannelResourceBasic(this,
-                    io_service_, socket, configuration()->maxMessageSize));
+                    io_service_, reception_io_service(), socket, configuration()->maxMessageSize));
 
             {
                 std::unique_lock<std::mutex> unbound_lock(unbound_map_mutex_);
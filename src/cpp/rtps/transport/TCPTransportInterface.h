@@ -77,12 +77,17 @@ class TCPTransportInterface : public TransportInterface
 
     std::atomic<bool> alive_;
 
+    //! State of the asynchronous reception of a channel, when the reactor threads are enabled.
+    struct AsyncReception;
+
     using TransportInterface::transform_remote_locator;
 
 protected:
 
     asio::io_service io_service_;
     asio::io_service io_service_timers_;
+    // Runs the asynchronous reads of the basic channels, only when reactor threads are enabled
+    asio::io_service io_service_reactor_;
     std::unique_ptr<asio::ip::tcp::socket> initial_peer_local_locator_socket_;
     uint16_t initial_peer_local_locator_port_;
 
@@ -91,6 +96,8 @@ protected:
 #endif // if TLS_FOUND
     eprosima::thread io_service_thread_;
     eprosima::thread io_service_timers_thread_;
+    // Threads running io_service_reactor_, receiving from the channels asynchronously
+    std::vector<eprosima::thread> reactor_threads_;
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager_;
     std::mutex rtcp_message_manager_mutex_;
     std::condition_variable rtcp_message_manager_cv_;
@@ -172,6 +179,66 @@ protected:
             std::weak_ptr<TCPChannelResource> channel,
             std::weak_ptr<RTCPMessageManager> rtcp_manager);
 
+    /**
+     * Performs the RTCP initialization of a channel before starting to receive from it.
+     *
+     * @param[in] channel_weak Channel to initialize.
+     * @param[in] rtcp_manager RTCP message manager of the transport.
+     * @param[out] channel The locked channel.
+     * @param[out] remote_locator Locator of the remote endpoint of the channel.
+     *
+     * @return true when the reception from the channel should start.
+     */
+    bool start_reception(
+            const std::weak_ptr<TCPChannelResource>& channel_weak,
+            const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            Locator& remote_locator);
+
+    //! Returns the service where the sockets of the basic channels are created.
+    asio::io_service& reception_io_service();
+
+    //! Starts receiving from a channel with asynchronous reads run by the reactor threads.
+    void start_async_reception(
+            const std::shared_ptr<TCPChannelResource>& channel);
+
+    //! Starts the next asynchronous read of a channel.
+    void async_receive(
+            const std::shared_ptr<AsyncReception>& reception);
+
+    //! Called when an asynchronous read of a channel completes.
+    void on_async_receive(
+            const std::shared_ptr<AsyncReception>& reception,
+            const asio::error_code& ec,
+            std::size_t bytes_received);
+
+    //! Processes all the complete messages received asynchronously on a channel.
+    void process_async_reception(
+            std::shared_ptr<TCPChannelResource>& channel,
+            AsyncReception& reception);
+
+    /**
+     * Processes the body of a message received on a channel.
+     * RTCP control messages are processed here, while the rest should be delivered to their receiver.
+     *
+     * @return true when the message should be delivered to the receiver of its logical port.
+     */
+    bool process_message(
+            std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const TCPHeader& tcp_header,
+            octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            Endianness_t msg_endian,
+            Locator& remote_locator);
+
+    //! Delivers a message to the receiver of the logical port of @c remote_locator.
+    void deliver_message(
+            const std::shared_ptr<TCPChannelResource>& channel,
+            const octet* buffer,
+            uint32_t size,
+            const Locator& remote_locator);
+
     bool read_body(
             octet* receive_buffer,
             uint32_t receive_buffer_capacity,
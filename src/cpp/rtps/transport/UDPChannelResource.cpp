@@ -16,6 +16,14 @@
 
 #include <asio.hpp>
 
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <sys/socket.h>
+#endif // if defined(__linux__)
+
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 
 #include <rtps/messages/MessageReceiver.h>
@@ -61,6 +69,15 @@ UDPChannelResource::~UDPChannelResource()
 void UDPChannelResource::perform_listen_operation(
         Locator input_locator)
 {
+#if defined(__linux__)
+    uint32_t batch_size = transport_->configuration()->receive_batch_size;
+    if (batch_size > 1)
+    {
+        perform_batched_listen_operation(input_locator, batch_size);
+        return;
+    }
+#endif // if defined(__linux__)
+
     Locator remote_locator;
 
     while (alive())
@@ -86,6 +103,89 @@ void UDPChannelResource::perform_listen_operation(
     message_receiver(nullptr);
 }
 
+#if defined(__linux__)
+void UDPChannelResource::perform_batched_listen_operation(
+        const Locator& input_locator,
+        uint32_t batch_size)
+{
+    Locator remote_locator;
+    const size_t buffer_capacity = message_buffer().max_size;
+
+    // Ring of receive buffers, one slot per datagram of the batch.
+    std::vector<octet> buffers(buffer_capacity * batch_size);
+    std::vector<struct mmsghdr> headers(batch_size);
+    std::vector<struct iovec> iovecs(batch_size);
+    std::vector<struct sockaddr_storage> addresses(batch_size);
+
+    int fd = socket()->native_handle();
+
+    while (alive())
+    {
+        for (uint32_t i = 0; i < batch_size; ++i)
+        {
+            iovecs[i].iov_base = &buffers[i * buffer_capacity];
+            iovecs[i].iov_len = buffer_capacity;
+            memset(&headers[i], 0, sizeof(struct mmsghdr));
+            headers[i].msg_hdr.msg_name = &addresses[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // Blocking until at least one datagram is available, then take whatever else is already queued.
+        int received = recvmmsg(fd, headers.data(), batch_size, MSG_WAITFORONE, nullptr);
+        transport_->receive_system_calls_.fetch_add(1, std::memory_order_relaxed);
+        if (received < 0)
+        {
+            if (EINTR != errno && alive())
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "Error receiving data: " << strerror(errno)
+                                                                            << " (" << this << ")");
+            }
+            continue;
+        }
+        transport_->received_datagrams_.fetch_add(static_cast<uint64_t>(received), std::memory_order_relaxed);
+
+        for (int i = 0; i < received && alive(); ++i)
+        {
+            octet* data = &buffers[i * buffer_capacity];
+            uint32_t length = static_cast<uint32_t>(headers[i].msg_len);
+            if (0 == length)
+            {
+                continue;
+            }
+
+            // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
+            if (length == 13 && memcmp(data, "EPRORTPSCLOSE", 13) == 0)
+            {
+                continue;
+            }
+
+            asio::ip::udp::endpoint sender_endpoint;
+            if (headers[i].msg_hdr.msg_namelen > sender_endpoint.capacity())
+            {
+                continue;
+            }
+            memcpy(sender_endpoint.data(), &addresses[i], headers[i].msg_hdr.msg_namelen);
+            sender_endpoint.resize(headers[i].msg_hdr.msg_namelen);
+            transport_->endpoint_to_locator(sender_endpoint, remote_locator);
+
+            // Processes the data through the CDR Message interface.
+            if (message_receiver() != nullptr)
+            {
+                message_receiver()->OnDataReceived(data, length, input_locator, remote_locator);
+            }
+            else if (alive())
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Received Message, but no receiver attached");
+            }
+        }
+    }
+
+    message_receiver(nullptr);
+}
+#endif // if defined(__linux__)
+
 bool UDPChannelResource::Receive(
         octet* receive_buffer,
         uint32_t receive_buffer_capacity,
@@ -96,10 +196,12 @@ bool UDPChannelResource::Receive(
     {
         asio::ip::udp::endpoint senderEndpoint;
 
+        transport_->receive_system_calls_.fetch_add(1, std::memory_order_relaxed);
         size_t bytes = socket()->receive_from(asio::buffer(receive_buffer, receive_buffer_capacity), senderEndpoint);
         receive_buffer_size = static_cast<uint32_t>(bytes);
         if (receive_buffer_size > 0)
         {
+            transport_->received_datagrams_.fetch_add(1, std::memory_order_relaxed);
             // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
             if (receive_buffer_size == 13 && memcmp(receive_buffer, "EPRORTPSCLOSE", 13) == 0)
             {
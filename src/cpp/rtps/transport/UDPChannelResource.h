@@ -227,6 +227,19 @@ protected:
     void perform_listen_operation(
             Locator input_locator);
 
+#if defined(__linux__)
+    /**
+     * Listening loop used when the transport is configured with a receive_batch_size greater than 1.
+     * Each iteration drains up to @c batch_size datagrams from the socket with a single recvmmsg call,
+     * and then passes them one by one to the associated receiver.
+     * @param input_locator - Locator that triggered the creation of the resource
+     * @param batch_size - Maximum number of datagrams received on each system call
+     */
+    void perform_batched_listen_operation(
+            const Locator& input_locator,
+            uint32_t batch_size);
+#endif // if defined(__linux__)
+
     /**
      * Blocking Receive from the specified channel.
      * @param receive_buffer vector with enough capacity (not size) to accomodate a full receive buffer. That
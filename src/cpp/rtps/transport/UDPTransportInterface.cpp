@@ -20,6 +20,14 @@
 #include <limits>
 #include <utility>
 
+#if defined(__linux__)
+#include <cerrno>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif // if defined(__linux__)
+
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/utils/IPLocator.h>
@@ -37,6 +45,12 @@ namespace rtps {
 
 using Log = fastdds::dds::Log;
 
+//! Maximum number of datagrams received on a single recvmmsg() call. The kernel does not take more than UIO_MAXIOV.
+static constexpr uint32_t s_maximum_receive_batch_size = 1024;
+
+//! Maximum number of datagrams sent on a single sendmmsg() call. The kernel does not take more than UIO_MAXIOV.
+static constexpr uint32_t s_maximum_send_batch_size = 1024;
+
 UDPTransportDescriptor::UDPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
     , m_output_udp_socket(0)
@@ -48,6 +62,8 @@ bool UDPTransportDescriptor::operator ==(
 {
     return (this->m_output_udp_socket == t.m_output_udp_socket &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->receive_batch_size == t.receive_batch_size &&
+           this->send_batch_size == t.send_batch_size &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -152,6 +168,18 @@ bool UDPTransportInterface::init(
         return false;
     }
 
+    if (configuration()->receive_batch_size > s_maximum_receive_batch_size)
+    {
+        EPROSIMA_LOG_ERROR(TRANSPORT_UDP, "receive_batch_size cannot be greater than " << s_maximum_receive_batch_size);
+        return false;
+    }
+
+    if (configuration()->send_batch_size > s_maximum_send_batch_size)
+    {
+        EPROSIMA_LOG_ERROR(TRANSPORT_UDP, "send_batch_size cannot be greater than " << s_maximum_send_batch_size);
+        return false;
+    }
+
     asio::error_code ec;
     ip::udp::socket socket(io_service_);
     socket.open(generate_protocol(), ec);
@@ -502,6 +530,14 @@ bool UDPTransportInterface::send(
     auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
         max_blocking_time_point - std::chrono::steady_clock::now());
 
+#if defined(__linux__)
+    if (configuration()->send_batch_size > 1)
+    {
+        return send_batched(buffers, total_bytes, socket, destination_locators_begin, destination_locators_end,
+                       only_multicast_purpose, whitelisted, time_out);
+    }
+#endif // if defined(__linux__)
+
     while (it != *destination_locators_end)
     {
         if (IsLocatorSupported(*it))
@@ -567,6 +603,7 @@ bool UDPTransportInterface::send(
             // Statistics submessage is always the last buffer to be added
             statistics_info_.set_statistics_message_data(remote_locator, buffers.back(), total_bytes);
             bytesSent = getSocketPtr(socket)->send_to(buffers, destinationEndpoint, 0, ec);
+            send_system_calls_.fetch_add(1, std::memory_order_relaxed);
             if (!!ec)
             {
                 if ((ec.value() == asio::error::would_block) ||
@@ -586,6 +623,8 @@ bool UDPTransportInterface::send(
             return false;
         }
 
+        sent_datagrams_.fetch_add(1, std::memory_order_relaxed);
+
         (void)bytesSent;
         EPROSIMA_LOG_INFO(TRANSPORT_UDP,
                 "UDPTransport: " << bytesSent << " bytes TO endpoint: " << destinationEndpoint <<
@@ -596,6 +635,172 @@ bool UDPTransportInterface::send(
     return success;
 }
 
+#if defined(__linux__)
+
+namespace {
+
+/**
+ * Scratch storage for a batch of datagrams sharing the same payload buffers.
+ * It is kept per thread, so its memory is reused across send operations.
+ */
+struct UDPSendBatch
+{
+    //! Destination of each queued datagram.
+    std::vector<asio::ip::udp::endpoint> endpoints;
+    //! Gather list of each queued datagram, one slot of buffers.size() entries per datagram.
+    std::vector<struct iovec> iovecs;
+    //! Headers passed to sendmmsg.
+    std::vector<struct mmsghdr> headers;
+    //! Per-datagram copies of the last buffer, which holds the per-destination statistics submessage.
+    std::vector<octet> statistics;
+};
+
+bool flush_send_batch(
+        int fd,
+        UDPSendBatch& batch,
+        size_t num_buffers,
+        std::atomic<uint64_t>& sent_datagrams,
+        std::atomic<uint64_t>& send_system_calls)
+{
+    size_t count = batch.endpoints.size();
+    if (0 == count)
+    {
+        return true;
+    }
+
+    batch.headers.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::memset(&batch.headers[i], 0, sizeof(struct mmsghdr));
+        batch.headers[i].msg_hdr.msg_name = batch.endpoints[i].data();
+        batch.headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(batch.endpoints[i].size());
+        batch.headers[i].msg_hdr.msg_iov = &batch.iovecs[i * num_buffers];
+        batch.headers[i].msg_hdr.msg_iovlen = num_buffers;
+    }
+
+    bool ret = true;
+    size_t sent = 0;
+    while (sent < count)
+    {
+        int res = sendmmsg(fd, &batch.headers[sent], static_cast<unsigned int>(count - sent), 0);
+        send_system_calls.fetch_add(1, std::memory_order_relaxed);
+        if (res < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            if (EAGAIN == errno)
+            {
+                EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "UDP send would have blocked. Packet is dropped.");
+            }
+            else
+            {
+                EPROSIMA_LOG_WARNING(TRANSPORT_UDP, std::strerror(errno));
+                ret = false;
+            }
+
+            // Skip the failing datagram, as it would happen when sending to each destination separately.
+            ++sent;
+            continue;
+        }
+
+        sent += static_cast<size_t>(res);
+        sent_datagrams.fetch_add(static_cast<uint64_t>(res), std::memory_order_relaxed);
+    }
+
+    batch.endpoints.clear();
+    return ret;
+}
+
+} // namespace
+
+bool UDPTransportInterface::send_batched(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastdds::rtps::LocatorsIterator* destination_locators_begin,
+        fastdds::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout)
+{
+    if (total_bytes > configuration()->sendBufferSize)
+    {
+        return false;
+    }
+
+    static thread_local UDPSendBatch batch;
+
+    const size_t max_batch_size = configuration()->send_batch_size;
+    const size_t num_buffers = buffers.size();
+    batch.endpoints.clear();
+    batch.iovecs.resize(max_batch_size * num_buffers);
+#ifdef FASTDDS_STATISTICS
+    const size_t statistics_size = buffers.back().size;
+    batch.statistics.resize(max_batch_size * statistics_size);
+#endif // ifdef FASTDDS_STATISTICS
+
+    int fd = getSocketPtr(socket)->native_handle();
+    struct timeval timeStruct;
+    timeStruct.tv_sec = 0;
+    timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
+
+    bool ret = true;
+    fastdds::rtps::LocatorsIterator& it = *destination_locators_begin;
+    while (it != *destination_locators_end)
+    {
+        const Locator& remote_locator = *it;
+        if (IsLocatorSupported(remote_locator))
+        {
+            bool is_multicast_remote_address = IPLocator::isMulticast(remote_locator);
+            if (is_multicast_remote_address == only_multicast_purpose || whitelisted)
+            {
+                // Filter unicast remote locators according to socket conditions (e.g. netmask filtering)
+                if (is_multicast_remote_address || !socket.should_filter(remote_locator))
+                {
+                    size_t index = batch.endpoints.size();
+                    batch.endpoints.push_back(
+                        generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator)));
+
+                    struct iovec* iov = &batch.iovecs[index * num_buffers];
+                    for (size_t i = 0; i < num_buffers; ++i)
+                    {
+                        iov[i].iov_base = const_cast<void*>(buffers[i].buffer);
+                        iov[i].iov_len = buffers[i].size;
+                    }
+
+#ifdef FASTDDS_STATISTICS
+                    // Statistics submessage is always the last buffer to be added, and it depends on the destination.
+                    statistics_info_.set_statistics_message_data(remote_locator, buffers.back(), total_bytes);
+                    octet* statistics_copy = batch.statistics.data() + index * statistics_size;
+                    std::memcpy(statistics_copy, buffers.back().buffer, statistics_size);
+                    iov[num_buffers - 1].iov_base = statistics_copy;
+#endif // ifdef FASTDDS_STATISTICS
+
+                    if (batch.endpoints.size() == max_batch_size)
+                    {
+                        ret &= flush_send_batch(fd, batch, num_buffers, sent_datagrams_, send_system_calls_);
+                    }
+                }
+            }
+            else
+            {
+                ret = false;
+            }
+        }
+
+        ++it;
+    }
+
+    ret &= flush_send_batch(fd, batch, num_buffers, sent_datagrams_, send_system_calls_);
+    return ret;
+}
+
+#endif // if defined(__linux__)
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_UDP_TRANSPORT_INTERFACE_H_
 #define _FASTDDS_UDP_TRANSPORT_INTERFACE_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -180,6 +181,30 @@ public:
 
     NetmaskFilterInfo netmask_filter_info() const override;
 
+    //! Number of datagrams sent through this transport since its creation.
+    uint64_t sent_datagrams() const
+    {
+        return sent_datagrams_.load(std::memory_order_relaxed);
+    }
+
+    //! Number of system calls used to send those datagrams.
+    uint64_t send_system_calls() const
+    {
+        return send_system_calls_.load(std::memory_order_relaxed);
+    }
+
+    //! Number of datagrams received through this transport since its creation.
+    uint64_t received_datagrams() const
+    {
+        return received_datagrams_.load(std::memory_order_relaxed);
+    }
+
+    //! Number of system calls used to receive those datagrams.
+    uint64_t receive_system_calls() const
+    {
+        return receive_system_calls_.load(std::memory_order_relaxed);
+    }
+
 protected:
 
     friend class UDPChannelResource;
@@ -306,6 +331,29 @@ protected:
 
     std::atomic_bool rescan_interfaces_ = {true};
 
+    //! Send counters, used to check the number of datagrams per system call.
+    std::atomic<uint64_t> sent_datagrams_ = {0};
+    std::atomic<uint64_t> send_system_calls_ = {0};
+
+    //! Receive counters, used to check the number of datagrams per system call.
+    std::atomic<uint64_t> received_datagrams_ = {0};
+    std::atomic<uint64_t> receive_system_calls_ = {0};
+
+#if defined(__linux__)
+    /**
+     * Send a Vector of buffers to a list of destinations, using as few sendmmsg calls as possible.
+     */
+    bool send_batched(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::microseconds& timeout);
+#endif // if defined(__linux__)
+
 };
 
 } // namespace rtps
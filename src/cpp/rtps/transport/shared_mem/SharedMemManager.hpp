@@ -15,10 +15,17 @@
 #ifndef _FASTDDS_SHAREDMEM_MANAGER_H_
 #define _FASTDDS_SHAREDMEM_MANAGER_H_
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
 #include <list>
+#include <memory>
+#include <new>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
@@ -357,9 +364,169 @@ public:
         uint32_t original_validity_id_;
     };
 
+    /**
+     * Lock-free pool of fixed-size chunks, used to allocate the SharedMemBuffer handles (together with their
+     * shared_ptr control blocks) without going to the heap on each buffer allocation.
+     * Free chunks are kept on a stack whose head is tagged with a counter, to avoid the ABA problem.
+     * When the pool is exhausted, or the requested size does not fit in a chunk, the heap is used instead.
+     */
+    class BufferHandlePool
+    {
+    public:
+
+        explicit BufferHandlePool(
+                uint32_t num_chunks)
+            : chunks_(num_chunks)
+            , next_(num_chunks)
+            , head_(pack(num_chunks > 0 ? 0u : end_index, 0u))
+        {
+            for (uint32_t i = 0; i < num_chunks; ++i)
+            {
+                next_[i].store(i + 1 < num_chunks ? i + 1 : end_index, std::memory_order_relaxed);
+            }
+        }
+
+        void* allocate(
+                size_t size)
+        {
+            if (size <= sizeof(Chunk))
+            {
+                uint64_t head = head_.load(std::memory_order_acquire);
+                while (end_index != index(head))
+                {
+                    uint32_t idx = index(head);
+                    uint64_t new_head = pack(next_[idx].load(std::memory_order_relaxed), tag(head) + 1);
+                    if (head_.compare_exchange_weak(head, new_head, std::memory_order_acq_rel,
+                            std::memory_order_acquire))
+                    {
+                        return &chunks_[idx];
+                    }
+                }
+            }
+
+            return ::operator new(size);
+        }
+
+        void deallocate(
+                void* ptr)
+        {
+            Chunk* chunk = static_cast<Chunk*>(ptr);
+            if (chunks_.empty() || chunk < chunks_.data() || chunk >= chunks_.data() + chunks_.size())
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            uint32_t idx = static_cast<uint32_t>(chunk - chunks_.data());
+            uint64_t head = head_.load(std::memory_order_relaxed);
+            do
+            {
+                next_[idx].store(index(head), std::memory_order_relaxed);
+            } while (!head_.compare_exchange_weak(head, pack(idx, tag(head) + 1), std::memory_order_release,
+                    std::memory_order_relaxed));
+        }
+
+    private:
+
+        static constexpr uint32_t end_index = std::numeric_limits<uint32_t>::max();
+
+        // Room for a SharedMemBuffer plus the shared_ptr control block and the allocator it stores.
+        struct alignas(alignof(std::max_align_t)) Chunk
+        {
+            unsigned char data[sizeof(SharedMemBuffer) + 64];
+        };
+
+        static uint64_t pack(
+                uint32_t idx,
+                uint32_t tag)
+        {
+            return (static_cast<uint64_t>(tag) << 32) | idx;
+        }
+
+        static uint32_t index(
+                uint64_t head)
+        {
+            return static_cast<uint32_t>(head);
+        }
+
+        static uint32_t tag(
+                uint64_t head)
+        {
+            return static_cast<uint32_t>(head >> 32);
+        }
+
+        std::vector<Chunk> chunks_;
+        std::vector<std::atomic<uint32_t>> next_;
+        std::atomic<uint64_t> head_;
+    };
+
+    /**
+     * Standard allocator over a BufferHandlePool, to be used with std::allocate_shared.
+     * It keeps the pool alive until the last handle allocated from it is released.
+     */
+    template<typename T>
+    class BufferHandleAllocator
+    {
+    public:
+
+        using value_type = T;
+
+        explicit BufferHandleAllocator(
+                const std::shared_ptr<BufferHandlePool>& pool)
+            : pool_(pool)
+        {
+        }
+
+        template<typename U>
+        BufferHandleAllocator(
+                const BufferHandleAllocator<U>& other)
+            : pool_(other.pool())
+        {
+        }
+
+        T* allocate(
+                size_t n)
+        {
+            return static_cast<T*>(pool_->allocate(n * sizeof(T)));
+        }
+
+        void deallocate(
+                T* ptr,
+                size_t)
+        {
+            pool_->deallocate(ptr);
+        }
+
+        const std::shared_ptr<BufferHandlePool>& pool() const
+        {
+            return pool_;
+        }
+
+        template<typename U>
+        bool operator ==(
+                const BufferHandleAllocator<U>& other) const
+        {
+            return pool_ == other.pool();
+        }
+
+        template<typename U>
+        bool operator !=(
+                const BufferHandleAllocator<U>& other) const
+        {
+            return pool_ != other.pool();
+        }
+
+    private:
+
+        std::shared_ptr<BufferHandlePool> pool_;
+    };
+
     /**
      * Handle a shared-memory segment
      * Allows buffer allocation / deallocation
+     *
+     * Buffer nodes keep their data block when they stop being referenced, so a later allocation of the same size
+     * or smaller can reuse both without going through the interprocess allocator of the segment.
      */
     class Segment
     {
@@ -377,6 +544,10 @@ public:
             , allocated_buffers_(buffer_node_list_allocator_)
             , segment_id_()
             , overflows_count_(0)
+            , handle_pool_(std::make_shared<BufferHandlePool>(max_allocations))
+            , max_allocations_(max_allocations)
+            , node_states_(new NodeState[max_allocations])
+            , reuse_cursor_(0)
         {
             generate_segment_id_and_name(domain_name);
 
@@ -398,16 +569,18 @@ public:
             free_bytes_ = payload_size;
 
             // Alloc the buffer nodes
-            auto buffers_nodes = segment_->get().construct<BufferNode>
+            buffer_nodes_ = segment_->get().construct<BufferNode>
                         (boost::interprocess::anonymous_instance)[max_allocations]();
 
             // All buffer nodes are free
             for (uint32_t i = 0; i < max_allocations; i++)
             {
-                buffers_nodes[i].status.exchange({0, 0, 0});
-                buffers_nodes[i].data_size = 0;
-                buffers_nodes[i].data_offset = 0;
-                free_buffers_.push_back(&buffers_nodes[i]);
+                buffer_nodes_[i].status.exchange({0, 0, 0});
+                buffer_nodes_[i].data_size = 0;
+                buffer_nodes_[i].data_offset = 0;
+                node_states_[i].state.store(NODE_FREE, std::memory_order_relaxed);
+                node_states_[i].capacity.store(0, std::memory_order_relaxed);
+                free_buffers_.push_back(&buffer_nodes_[i]);
             }
         }
 
@@ -435,68 +608,84 @@ public:
             return segment_id_;
         }
 
+        /**
+         * Allocates a buffer on the segment.
+         * Unreferenced nodes whose data block is big enough are reused without locking. Otherwise, the allocation
+         * takes alloc_mutex_, which protects the node lists and the interprocess allocator of the segment.
+         */
         std::shared_ptr<Buffer> alloc_buffer(
                 uint32_t size,
                 const std::chrono::steady_clock::time_point& max_blocking_time_point)
         {
             (void)max_blocking_time_point;
 
-            std::lock_guard<std::mutex> lock(alloc_mutex_);
+            uint32_t validity_id = 0;
+            BufferNode* buffer_node = reuse_node(size, validity_id);
 
-            if (!recover_buffers(size))
+            if (nullptr == buffer_node)
             {
-                throw std::runtime_error("allocation overflow");
-            }
+                std::lock_guard<std::mutex> lock(alloc_mutex_);
 
-            void* data = nullptr;
-            BufferNode* buffer_node = nullptr;
-            std::shared_ptr<SharedMemBuffer> new_buffer;
+                if (!recover_buffers(size))
+                {
+                    throw std::runtime_error("allocation overflow");
+                }
 
-            try
-            {
-                buffer_node = pop_free_node();
+                void* data = nullptr;
 
-                data = segment_->get().allocate(size);
-                free_bytes_ -= size;
+                try
+                {
+                    buffer_node = pop_free_node();
 
-                buffer_node->data_offset = segment_->get_offset_from_address(data);
-                buffer_node->data_size = size;
+                    data = segment_->get().allocate(size);
+                    free_bytes_ -= size;
 
-                auto validity_id = buffer_node->status.load(std::memory_order_relaxed).validity_id;
+                    buffer_node->data_offset = segment_->get_offset_from_address(data);
+                    buffer_node->data_size = size;
 
-                // TODO(Adolfo) : Dynamic allocation. Use foonathan to convert it to static allocation
-                new_buffer = std::make_shared<SharedMemBuffer>(segment_, segment_id_, buffer_node,
-                                static_cast<uint32_t>(validity_id));
+                    validity_id =
+                            static_cast<uint32_t>(buffer_node->status.load(std::memory_order_relaxed).validity_id);
 
-                if (new_buffer)
-                {
-                    buffer_node->inc_processing_count(static_cast<uint32_t>(validity_id));
-                }
-                else
-                {
-                    throw std::runtime_error("alloc_buffer: out of memory");
-                }
+                    // The node is marked as being processed before it is published, so it cannot be recovered
+                    // or reused until the handle returned below is released.
+                    buffer_node->inc_processing_count(validity_id);
 
-                allocated_buffers_.push_back(buffer_node);
-            }
-            catch (const std::exception&)
-            {
-                if (buffer_node)
+                    allocated_buffers_.push_back(buffer_node);
+
+                    NodeState& node_state = state_of(buffer_node);
+                    node_state.capacity.store(size, std::memory_order_relaxed);
+                    node_state.state.store(NODE_ALLOCATED, std::memory_order_release);
+                }
+                catch (const std::exception&)
                 {
-                    if (data)
+                    if (buffer_node)
                     {
-                        release_buffer(buffer_node);
+                        if (data)
+                        {
+                            release_buffer(buffer_node);
+                        }
+
+                        free_buffers_.push_back(buffer_node);
                     }
 
-                    free_buffers_.push_back(buffer_node);
-                }
+                    overflows_count_++;
 
-                overflows_count_++;
+                    throw;
+                }
+            }
 
+            // The handle comes from a lock-free pool, so it is created outside the allocation lock.
+            try
+            {
+                return std::allocate_shared<SharedMemBuffer>(BufferHandleAllocator<SharedMemBuffer>(handle_pool_),
+                               segment_, segment_id_, buffer_node, validity_id);
+            }
+            catch (const std::exception&)
+            {
+                // The node will be recovered by a later allocation
+                buffer_node->dec_processing_count(validity_id);
                 throw;
             }
-
-            return new_buffer;
         }
 
         uint64_t mem_size()
@@ -525,8 +714,88 @@ public:
         SharedMemSegment::Id segment_id_;
         uint64_t overflows_count_;
 
+        //! Pool for the SharedMemBuffer handles returned by alloc_buffer
+        std::shared_ptr<BufferHandlePool> handle_pool_;
+
         uint32_t free_bytes_;
 
+        //! Values of NodeState::state
+        enum : uint8_t
+        {
+            //! The node has no data block, and is on free_buffers_
+            NODE_FREE,
+            //! The node has a data block, and is on allocated_buffers_
+            NODE_ALLOCATED,
+            //! The node is being reused or recovered by a thread
+            NODE_CLAIMED
+        };
+
+        /**
+         * Local state of a buffer node, used to reuse it without locking alloc_mutex_.
+         * Only the thread which moves a node from NODE_ALLOCATED to NODE_CLAIMED may change it.
+         */
+        struct NodeState
+        {
+            std::atomic<uint8_t> state;
+            //! Size of the data block of the node
+            std::atomic<uint32_t> capacity;
+        };
+
+        //! Maximum number of nodes checked for reuse before falling back to the interprocess allocator
+        static constexpr uint32_t max_reuse_attempts = 8;
+
+        BufferNode* buffer_nodes_ = nullptr;
+        uint32_t max_allocations_;
+        std::unique_ptr<NodeState[]> node_states_;
+        //! Next node checked for reuse, shared by all the allocating threads to spread them over the nodes
+        std::atomic<uint32_t> reuse_cursor_;
+
+        inline NodeState& state_of(
+                BufferNode* buffer_node)
+        {
+            return node_states_[static_cast<size_t>(buffer_node - buffer_nodes_)];
+        }
+
+        /**
+         * Reuse a node which is no longer referenced, together with its data block, without locking alloc_mutex_.
+         * @return The node, marked as being processed, or nullptr if no suitable node was found.
+         */
+        BufferNode* reuse_node(
+                uint32_t size,
+                uint32_t& validity_id)
+        {
+            uint32_t attempts = max_allocations_ < max_reuse_attempts ? max_allocations_ : max_reuse_attempts;
+            for (uint32_t n = 0; n < attempts; ++n)
+            {
+                uint32_t index = reuse_cursor_.fetch_add(1, std::memory_order_relaxed) % max_allocations_;
+                NodeState& node_state = node_states_[index];
+                BufferNode& node = buffer_nodes_[index];
+                uint8_t expected = NODE_ALLOCATED;
+                if (node_state.capacity.load(std::memory_order_relaxed) < size ||
+                        !node.is_not_referenced() ||
+                        !node_state.state.compare_exchange_strong(expected, NODE_CLAIMED,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                // Check again, as the node may have been reused and released since it was checked
+                if (node_state.capacity.load(std::memory_order_relaxed) >= size && node.is_not_referenced())
+                {
+                    node.invalidate_buffer();
+                    node.data_size = size;
+                    validity_id = static_cast<uint32_t>(node.status.load(std::memory_order_relaxed).validity_id);
+                    node.inc_processing_count(validity_id);
+                    node_state.state.store(NODE_ALLOCATED, std::memory_order_release);
+                    return &node;
+                }
+
+                node_state.state.store(NODE_ALLOCATED, std::memory_order_release);
+            }
+
+            return nullptr;
+        }
+
         void generate_segment_id_and_name(
                 const std::string& domain_name)
         {
@@ -575,7 +844,49 @@ public:
             segment_->get().deallocate(
                 segment_->get_address_from_offset(buffer_node->data_offset));
 
-            free_bytes_ += buffer_node->data_size;
+            free_bytes_ += state_of(buffer_node).capacity.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Release the data block of an allocated node and return it to free_buffers_, when it is not referenced or,
+         * if force is true, when it is not being processed.
+         * Should be called with alloc_mutex_ locked. The node is skipped while another thread is reusing it.
+         * @return true if the node was recovered, false otherwise.
+         */
+        bool recover_node(
+                BufferNode* buffer_node,
+                bool force)
+        {
+            NodeState& node_state = state_of(buffer_node);
+            uint8_t expected = NODE_ALLOCATED;
+            if (!node_state.state.compare_exchange_strong(expected, NODE_CLAIMED,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            bool recovered = false;
+            if (force)
+            {
+                recovered = buffer_node->invalidate_if_not_processing();
+            }
+            else if (buffer_node->is_not_referenced())
+            {
+                buffer_node->invalidate_buffer();
+                recovered = true;
+            }
+
+            if (!recovered)
+            {
+                node_state.state.store(NODE_ALLOCATED, std::memory_order_release);
+                return false;
+            }
+
+            release_buffer(buffer_node);
+            node_state.capacity.store(0, std::memory_order_relaxed);
+            node_state.state.store(NODE_FREE, std::memory_order_relaxed);
+            free_buffers_.push_back(buffer_node);
+            return true;
         }
 
         /**
@@ -586,40 +897,44 @@ public:
         bool recover_buffers(
                 uint32_t required_data_size)
         {
+            // Buffers are usually released in the same order they were allocated, so recovering the unreferenced
+            // buffers at the head of the list is enough most of the times, and avoids walking the whole list.
+            while (!allocated_buffers_.empty() && recover_node(allocated_buffers_.front(), false))
+            {
+                allocated_buffers_.pop_front();
+            }
+
+            if (free_bytes_ >= required_data_size && !free_buffers_.empty())
+            {
+                return true;
+            }
+
+            // Recover unreferenced buffers out of order before invalidating any buffer still enqueued
             auto it = allocated_buffers_.begin();
             while (it != allocated_buffers_.end())
             {
-                // There is enough space to allocate the buffer
-                if (free_bytes_ >= required_data_size)
+                if (recover_node(*it, false))
                 {
-                    if ((*it)->is_not_referenced())
-                    {
-                        (*it)->invalidate_buffer();
-
-                        release_buffer(*it);
-
-                        free_buffers_.push_back(*it);
-                        it = allocated_buffers_.erase(it);
-                    }
-                    else
-                    {
-                        it++;
-                    }
+                    it = allocated_buffers_.erase(it);
                 }
-                else // No enough space, try to recover oldest not processing buffers
+                else
                 {
-                    // Buffer is not being processed by any listener
-                    if ((*it)->invalidate_if_not_processing())
-                    {
-                        release_buffer(*it);
+                    it++;
+                }
+            }
 
-                        free_buffers_.push_back(*it);
-                        it = allocated_buffers_.erase(it);
-                    }
-                    else
-                    {
-                        it++;
-                    }
+            it = allocated_buffers_.begin();
+            while (it != allocated_buffers_.end())
+            {
+                // There is enough space to allocate the buffer. Otherwise, try to recover oldest not processing
+                // buffers
+                if (recover_node(*it, free_bytes_ < required_data_size))
+                {
+                    it = allocated_buffers_.erase(it);
+                }
+                else
+                {
+                    it++;
                 }
             }
 
@@ -628,11 +943,8 @@ public:
             while (free_buffers_.empty() && it != allocated_buffers_.end())
             {
                 // Buffer is not beign processed by any listener
-                if ((*it)->invalidate_if_not_processing())
+                if (recover_node(*it, true))
                 {
-                    release_buffer(*it);
-
-                    free_buffers_.push_back(*it);
                     it = allocated_buffers_.erase(it);
                 }
                 else
@@ -656,12 +968,20 @@ public:
     {
     public:
 
+        /**
+         * @param shared_mem_manager Manager owning the listener.
+         * @param port Port to listen to.
+         * @param spin_time_us Maximum time (us) pop() polls the port before blocking on it. 0 disables polling.
+         */
         Listener(
                 SharedMemManager* shared_mem_manager,
-                std::shared_ptr<SharedMemGlobal::Port> port)
+                std::shared_ptr<SharedMemGlobal::Port> port,
+                uint32_t spin_time_us = 0)
             : global_port_(port)
             , shared_mem_manager_(shared_mem_manager)
             , is_closed_(false)
+            , max_spin_time_us_(spin_time_us)
+            , spin_budget_us_(spin_time_us)
         {
             global_listener_ = global_port_->create_listener(&listener_index_);
         }
@@ -690,14 +1010,16 @@ public:
             other.global_port_.reset();
             shared_mem_manager_ = other.shared_mem_manager_;
             is_closed_.exchange(other.is_closed_);
+            max_spin_time_us_ = other.max_spin_time_us_;
+            spin_budget_us_ = other.spin_budget_us_;
 
             return *this;
         }
 
         /**
          * Extract the first buffer enqueued in the port.
-         * If the queue is empty, blocks until a buffer is pushed
-         * to the port.
+         * If the queue is empty, polls the port for up to the configured spin time and then
+         * blocks until a buffer is pushed to the port.
          * @return A shared_ptr to the buffer, this shared_ptr can be nullptr if the
          * wait was interrupted because errors or close operations.
          * @remark Multithread not supported.
@@ -716,7 +1038,12 @@ public:
                     SharedMemGlobal::PortCell* head_cell = nullptr;
                     buffer_ref.reset();
 
-                    while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
+                    if (max_spin_time_us_ > 0)
+                    {
+                        head_cell = spin_wait_head();
+                    }
+
+                    while ( !head_cell && !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
                     {
                         // Wait until there's data to pop
                         global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
@@ -804,7 +1131,7 @@ public:
         {
             auto new_port = global_port_;
             shared_mem_manager_->regenerate_port(new_port, new_port->open_mode());
-            auto new_listener = std::make_shared<Listener>(shared_mem_manager_, new_port);
+            auto new_listener = std::make_shared<Listener>(shared_mem_manager_, new_port, max_spin_time_us_);
             *this = std::move(*new_listener);
         }
 
@@ -820,6 +1147,55 @@ public:
 
     private:
 
+        /**
+         * Poll the port for a new descriptor during the current spin budget.
+         * A spinning listener is not accounted in the port's waiting_count, so writers
+         * pushing to the port meanwhile skip the notification of the interprocess condition.
+         * The budget adapts to the traffic: it is restored to the maximum every time
+         * polling succeeds, and halved (down to a minimum) every time it expires,
+         * so idle ports quickly fall back to blocking.
+         * @return The head cell, or nullptr if the budget expired or the listener was closed.
+         */
+        SharedMemGlobal::PortCell* spin_wait_head()
+        {
+            constexpr uint32_t polls_per_clock_check = 64;
+
+            SharedMemGlobal::PortCell* head_cell = global_listener_->head();
+            if (head_cell)
+            {
+                return head_cell;
+            }
+
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(spin_budget_us_);
+            uint32_t polls = 0;
+            while (!is_closed_.load(std::memory_order_relaxed))
+            {
+                head_cell = global_listener_->head();
+                if (head_cell)
+                {
+                    // head() is a relaxed read, synchronize with the writer's release push
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    spin_budget_us_ = max_spin_time_us_;
+                    return head_cell;
+                }
+
+                if (++polls == polls_per_clock_check)
+                {
+                    polls = 0;
+                    if (std::chrono::steady_clock::now() >= deadline)
+                    {
+                        break;
+                    }
+                }
+
+                std::this_thread::yield();
+            }
+
+            uint32_t min_budget_us = (std::max)(max_spin_time_us_ / 8, static_cast<uint32_t>(1));
+            spin_budget_us_ = (std::max)(spin_budget_us_ / 2, min_budget_us);
+            return nullptr;
+        }
+
         std::shared_ptr<SharedMemGlobal::Port> global_port_;
 
         std::unique_ptr<SharedMemGlobal::Listener> global_listener_;
@@ -829,6 +1205,12 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        //! Maximum time (us) pop() polls the port before blocking on it
+        uint32_t max_spin_time_us_;
+
+        //! Current polling time (us), adapted to the traffic
+        uint32_t spin_budget_us_;
+
     }; // Listener
 
     /**
@@ -952,9 +1334,15 @@ public:
             }
         }
 
-        std::shared_ptr<Listener> create_listener()
+        /**
+         * Create a listener for this port.
+         * @param spin_time_us Maximum time (us) the listener polls the port before blocking on it.
+         * 0 disables polling.
+         */
+        std::shared_ptr<Listener> create_listener(
+                uint32_t spin_time_us = 0)
         {
-            return std::make_shared<Listener>(shared_mem_manager_, global_port_);
+            return std::make_shared<Listener>(shared_mem_manager_, global_port_, spin_time_us);
         }
 
     private:
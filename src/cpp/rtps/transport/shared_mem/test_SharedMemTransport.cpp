@@ -80,7 +80,7 @@ SharedMemChannelResource* test_SharedMemTransport::CreateInputChannelResource(
             locator.port,
             configuration()->port_queue_capacity(),
             configuration()->healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+            open_mode)->create_listener(configuration()->listener_spin_time_us()),
         locator,
         receiver,
         big_buffer_size_,
@@ -19,6 +19,8 @@
 
 #include <rtps/transport/tcp/RTCPMessageManager.h>
 
+#include <algorithm>
+#include <cstring>
 #include <thread>
 
 #include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
@@ -171,6 +173,48 @@ uint32_t& RTCPMessageManager::addToCRC(
     return crc;
 }
 
+uint32_t RTCPMessageManager::addToCRC(
+        uint32_t crc,
+        const octet* data,
+        size_t size)
+{
+    // Adding bytes with end-around carry is the same as adding them modulo 0xFFFFFFFF, with the only difference that
+    // a non-zero multiple of 0xFFFFFFFF is represented as 0xFFFFFFFF instead of 0.
+    // So the bytes are added in a 64-bit accumulator, and the result is reduced once at the end.
+    constexpr uint64_t max = 0xffffffff;
+    constexpr uint64_t lanes_mask = 0x00ff00ff00ff00ffull;
+    uint64_t sum = crc;
+
+    // Add eight bytes at a time, in four 16-bit lanes.
+    // Each word adds at most 2 * 255 to a lane, so a lane cannot overflow before 128 words.
+    while (size >= sizeof(uint64_t))
+    {
+        size_t words = std::min(size / sizeof(uint64_t), static_cast<size_t>(128));
+        size -= words * sizeof(uint64_t);
+
+        uint64_t lanes = 0;
+        for (; 0 < words; --words, data += sizeof(uint64_t))
+        {
+            uint64_t word;
+            memcpy(&word, data, sizeof(word));
+            lanes += (word & lanes_mask) + ((word >> 8) & lanes_mask);
+        }
+        sum += (lanes & 0xffff) + ((lanes >> 16) & 0xffff) + ((lanes >> 32) & 0xffff) + (lanes >> 48);
+    }
+
+    for (; 0 < size; --size, ++data)
+    {
+        sum += *data;
+    }
+
+    if (0 == sum)
+    {
+        return 0;
+    }
+    sum %= max;
+    return static_cast<uint32_t>(0 == sum ? max : sum);
+}
+
 void RTCPMessageManager::fillHeaders(
         TCPCPMKind kind,
         const TCPTransactionId& transaction_id,
@@ -240,10 +284,7 @@ void RTCPMessageManager::fillHeaders(
             {
                 crc = addToCRC(crc, pay[i]);
             }
-            for (uint32_t i = 0; i < payload->length; ++i)
-            {
-                crc = addToCRC(crc, payload->data[i]);
-            }
+            crc = addToCRC(crc, payload->data, payload->length);
         }
     }
     header.crc = crc;
@@ -20,8 +20,9 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
-#include <memory>
 #include <atomic>
+#include <cstddef>
+#include <memory>
 
 #include <rtps/transport/tcp/TCPControlMessage.h>
 #include <rtps/transport/tcp/RTCPHeader.h>
@@ -155,6 +156,21 @@ public:
             uint32_t& crc,
             fastdds::rtps::octet data);
 
+    /**
+     * Add a block of bytes to a CRC.
+     * Gives the same result as calling addToCRC for each byte, but adds several bytes at a time.
+     *
+     * @param crc Current value of the CRC.
+     * @param data Pointer to the bytes to add.
+     * @param size Number of bytes to add.
+     *
+     * @return The updated CRC.
+     */
+    static uint32_t addToCRC(
+            uint32_t crc,
+            const fastdds::rtps::octet* data,
+            size_t size);
+
     void dispose()
     {
         alive_.store(false);
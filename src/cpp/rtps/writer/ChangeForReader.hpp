@@ -52,6 +52,13 @@ class ChangeForReader_t
 
 public:
 
+    //! Empty entry, not associated to any change
+    ChangeForReader_t()
+        : status_(UNSENT)
+        , change_(nullptr)
+    {
+    }
+
     explicit ChangeForReader_t(
             CacheChange_t* change)
         : status_(UNSENT)
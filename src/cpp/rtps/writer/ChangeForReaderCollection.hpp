@@ -0,0 +1,313 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ChangeForReaderCollection.hpp
+ */
+
+#ifndef RTPS_WRITER__CHANGEFORREADERCOLLECTION_HPP
+#define RTPS_WRITER__CHANGEFORREADERCOLLECTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
+#include <fastdds/utils/collections/RingVector.hpp>
+
+#include <rtps/writer/ChangeForReader.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Collection of ChangeForReader_t sorted by sequence number, as kept by a ReaderProxy.
+ *
+ * Changes are stored on a ring buffer, so the acknowledged changes are removed from the front in constant time.
+ * A change is looked up at the position given by its distance to the first sequence number, which is its exact
+ * position while there are no holes on the collection. Otherwise, a binary search is done only up to that position.
+ *
+ * The number of changes on each status is kept, so operations on all the changes with a given status can be
+ * skipped when there is none. For this reason, the status of the stored changes should only be modified through
+ * @c set_status.
+ */
+class ChangeForReaderCollection final
+{
+public:
+
+    using collection_type = RingVector<ChangeForReader_t>;
+    using iterator = collection_type::iterator;
+    using const_iterator = collection_type::const_iterator;
+
+    /**
+     * Construct an empty collection.
+     *
+     * @param cfg  Resource limits of the collection. The initial number of elements is preallocated, and no more
+     *             than the maximum number of elements are accepted.
+     */
+    explicit ChangeForReaderCollection(
+            const ResourceLimitedContainerConfig& cfg)
+        : max_size_(cfg.maximum)
+    {
+        changes_.reserve(cfg.initial);
+    }
+
+    bool empty() const noexcept
+    {
+        return changes_.empty();
+    }
+
+    size_t size() const noexcept
+    {
+        return changes_.size();
+    }
+
+    iterator begin() noexcept
+    {
+        return changes_.begin();
+    }
+
+    iterator end() noexcept
+    {
+        return changes_.end();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return changes_.begin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return changes_.end();
+    }
+
+    const ChangeForReader_t& front() const
+    {
+        return changes_.front();
+    }
+
+    const ChangeForReader_t& back() const
+    {
+        return changes_.back();
+    }
+
+    //! Number of changes on a given status
+    uint32_t count(
+            ChangeForReaderStatus_t status) const
+    {
+        return status_count_[status];
+    }
+
+    /**
+     * Add a change with a sequence number greater than the ones on the collection.
+     *
+     * @param change  Change to add.
+     *
+     * @return Pointer to the added change, nullptr if the maximum number of changes has been reached.
+     */
+    ChangeForReader_t* push_back(
+            const ChangeForReader_t& change)
+    {
+        assert(changes_.empty() || change.getSequenceNumber() > changes_.back().getSequenceNumber());
+        if (changes_.size() >= max_size_)
+        {
+            return nullptr;
+        }
+
+        changes_.push_back(change);
+        ++status_count_[change.getStatus()];
+        return &changes_.back();
+    }
+
+    /**
+     * Add a change at the position given by its sequence number.
+     *
+     * @param change  Change to add. Its sequence number should not be on the collection.
+     *
+     * @return Iterator to the added change, end() if the maximum number of changes has been reached.
+     */
+    iterator insert(
+            const ChangeForReader_t& change)
+    {
+        if (changes_.size() >= max_size_)
+        {
+            return changes_.end();
+        }
+
+        iterator pos = lower_bound(change.getSequenceNumber());
+        assert(changes_.end() == pos || pos->getSequenceNumber() != change.getSequenceNumber());
+        ++status_count_[change.getStatus()];
+        return changes_.insert(pos, change);
+    }
+
+    /**
+     * Remove a change.
+     *
+     * @param pos  Iterator to the change to remove.
+     *
+     * @return Iterator to the change following the removed one.
+     */
+    iterator erase(
+            const_iterator pos)
+    {
+        --status_count_[pos->getStatus()];
+        return changes_.erase(pos);
+    }
+
+    /**
+     * Remove a range of changes.
+     * Removing from the beginning of the collection takes time proportional to the number of removed changes.
+     *
+     * @param first  Iterator to the first change to remove.
+     * @param last   Iterator to the change following the last one to remove.
+     *
+     * @return Iterator to the change following the last removed one.
+     */
+    iterator erase(
+            const_iterator first,
+            const_iterator last)
+    {
+        ptrdiff_t index = first - changes_.cbegin();
+        ptrdiff_t n = last - first;
+        if (0 == index)
+        {
+            for (; n > 0; --n)
+            {
+                --status_count_[changes_.front().getStatus()];
+                changes_.pop_front();
+            }
+        }
+        else
+        {
+            for (; n > 0; --n)
+            {
+                erase(changes_.cbegin() + index);
+            }
+        }
+        return changes_.begin() + index;
+    }
+
+    void clear()
+    {
+        changes_.clear();
+        status_count_.fill(0u);
+    }
+
+    /**
+     * Change the status of a change.
+     *
+     * @param pos     Iterator to the change to update.
+     * @param status  New status.
+     */
+    void set_status(
+            iterator pos,
+            ChangeForReaderStatus_t status)
+    {
+        --status_count_[pos->getStatus()];
+        pos->setStatus(status);
+        ++status_count_[status];
+    }
+
+    /**
+     * Find the first change with a sequence number not less than a given one.
+     *
+     * @param seq_num  Sequence number to look for.
+     *
+     * @return Iterator to the found change, end() if there is none.
+     */
+    iterator lower_bound(
+            const SequenceNumber_t& seq_num)
+    {
+        return changes_.begin() + lower_bound_index(seq_num);
+    }
+
+    const_iterator lower_bound(
+            const SequenceNumber_t& seq_num) const
+    {
+        return changes_.begin() + lower_bound_index(seq_num);
+    }
+
+    /**
+     * Find the change with a given sequence number.
+     *
+     * @param seq_num  Sequence number to look for.
+     *
+     * @return Iterator to the found change, end() if there is none.
+     */
+    iterator find(
+            const SequenceNumber_t& seq_num)
+    {
+        iterator it = lower_bound(seq_num);
+        return (changes_.end() == it || it->getSequenceNumber() == seq_num) ? it : changes_.end();
+    }
+
+    const_iterator find(
+            const SequenceNumber_t& seq_num) const
+    {
+        const_iterator it = lower_bound(seq_num);
+        return (changes_.end() == it || it->getSequenceNumber() == seq_num) ? it : changes_.end();
+    }
+
+private:
+
+    static bool change_less_than_sequence(
+            const ChangeForReader_t& change,
+            const SequenceNumber_t& seq_num)
+    {
+        return change.getSequenceNumber() < seq_num;
+    }
+
+    size_t lower_bound_index(
+            const SequenceNumber_t& seq_num) const
+    {
+        if (changes_.empty() || seq_num <= changes_.front().getSequenceNumber())
+        {
+            return 0;
+        }
+        if (seq_num > changes_.back().getSequenceNumber())
+        {
+            return changes_.size();
+        }
+
+        // Sequence numbers are unique and sorted, so the change can only be at its distance to the first one or
+        // before that position.
+        uint64_t offset = seq_num.to64long() - changes_.front().getSequenceNumber().to64long();
+        if (offset < changes_.size() && changes_[static_cast<size_t>(offset)].getSequenceNumber() == seq_num)
+        {
+            return static_cast<size_t>(offset);
+        }
+
+        size_t limit = (offset < changes_.size()) ? static_cast<size_t>(offset) : changes_.size() - 1;
+        return static_cast<size_t>(std::lower_bound(changes_.begin(), changes_.begin() + limit + 1, seq_num,
+               change_less_than_sequence) - changes_.begin());
+    }
+
+    //! Maximum number of changes
+    size_t max_size_;
+    //! Changes sorted by sequence number
+    collection_type changes_;
+    //! Number of changes on each status
+    std::array<uint32_t, UNDERWAY + 1> status_count_ {};
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // RTPS_WRITER__CHANGEFORREADERCOLLECTION_HPP
@@ -86,6 +86,11 @@ void PersistentWriter::remove_persistent_change(
     persistence_->remove_writer_change_from_storage(persistence_guid_, *change);
 }
 
+bool PersistentWriter::flush_persistent_changes()
+{
+    return persistence_->flush();
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
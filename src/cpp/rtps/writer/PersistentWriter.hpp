@@ -66,6 +66,12 @@ public:
     void remove_persistent_change(
             CacheChange_t* change);
 
+    /**
+     * Wait until the changes previously added or removed are stored.
+     * @return true if all those changes were successfully stored.
+     */
+    bool flush_persistent_changes();
+
 private:
 
     //!Persistence service
@@ -196,7 +196,7 @@ void ReaderProxy::update_nack_supression_interval(
     }
 }
 
-void ReaderProxy::add_change(
+bool ReaderProxy::add_change(
         const ChangeForReader_t& change,
         bool is_relevant,
         bool restart_nack_supression)
@@ -206,10 +206,10 @@ void ReaderProxy::add_change(
         nack_supression_event_->restart_timer();
     }
 
-    add_change(change, is_relevant);
+    return add_change(change, is_relevant);
 }
 
-void ReaderProxy::add_change(
+bool ReaderProxy::add_change(
         const ChangeForReader_t& change,
         bool is_relevant,
         bool restart_nack_supression,
@@ -220,10 +220,10 @@ void ReaderProxy::add_change(
         nack_supression_event_->restart_timer(max_blocking_time);
     }
 
-    add_change(change, is_relevant);
+    return add_change(change, is_relevant);
 }
 
-void ReaderProxy::add_change(
+bool ReaderProxy::add_change(
         const ChangeForReader_t& change,
         bool is_relevant)
 {
@@ -239,17 +239,18 @@ void ReaderProxy::add_change(
         {
             changes_low_mark_ = change.getSequenceNumber();
         }
-        return;
+        return true;
     }
 
     if (changes_for_reader_.push_back(change) == nullptr)
     {
-        // This should never happen
         EPROSIMA_LOG_ERROR(RTPS_READER_PROXY, "Error adding change " << change.getSequenceNumber()
-                                                                     << " to reader proxy " << guid());
-        eprosima::fastdds::dds::Log::Flush();
-        assert(false);
+                                                                     << " to reader proxy " << guid()
+                                                                     << ": maximum number of changes reached");
+        return false;
     }
+
+    return true;
 }
 
 bool ReaderProxy::has_changes() const
@@ -372,7 +373,6 @@ void ReaderProxy::acked_changes_set(
                 }
                 future_low_mark = current_sequence;
 
-                bool should_sort = false;
                 for (; current_sequence <= changes_low_mark_; ++current_sequence)
                 {
                     // Skip all consecutive changes already in the collection
@@ -390,18 +390,18 @@ void ReaderProxy::acked_changes_set(
                         CacheChange_t* change = nullptr;
                         if (writer_->mp_history->get_change(current_sequence, writer_->getGuid(), &change))
                         {
-                            should_sort = true;
                             ChangeForReader_t cr(change);
                             cr.setStatus(UNACKNOWLEDGED);
-                            changes_for_reader_.push_back(cr);
+                            // Keep changes sorted by sequence number
+                            if (changes_for_reader_.end() == changes_for_reader_.insert(cr))
+                            {
+                                EPROSIMA_LOG_ERROR(RTPS_READER_PROXY, "Error adding change " << current_sequence <<
+                                        " to reader proxy " << guid() << ": maximum number of changes reached");
+                                break;
+                            }
                         }
                     }
                 }
-                // Keep changes sorted by sequence number
-                if (should_sort)
-                {
-                    std::sort(changes_for_reader_.begin(), changes_for_reader_.end(), ChangeForReaderCmp());
-                }
             }
             else if (!is_local_reader())
             {
@@ -428,7 +428,7 @@ bool ReaderProxy::requested_changes_set(
                     {
                         if (UNACKNOWLEDGED == chit->getStatus())
                         {
-                            chit->setStatus(REQUESTED);
+                            changes_for_reader_.set_status(chit, REQUESTED);
                             chit->markAllFragmentsAsUnsent();
                             isSomeoneWasSetRequested = true;
                         }
@@ -490,7 +490,7 @@ void ReaderProxy::from_unsent_to_status(
         return;
     }
 
-    it->setStatus(status);
+    changes_for_reader_.set_status(it, status);
 
     if (delivered)
     {
@@ -544,17 +544,19 @@ uint32_t ReaderProxy::convert_status_on_all_changes(
     // NOTE: This is only called for REQUESTED=>UNSENT (acknack response) or
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
+    // Stop as soon as all the changes with the previous status have been converted
+    uint32_t to_change = changes_for_reader_.count(previous);
     uint32_t changed = 0;
-    for (ChangeForReader_t& change : changes_for_reader_)
+    for (ChangeIterator it = changes_for_reader_.begin(); changed < to_change && it != changes_for_reader_.end(); ++it)
     {
-        if (change.getStatus() == previous)
+        if (it->getStatus() == previous)
         {
             ++changed;
-            change.setStatus(next);
+            changes_for_reader_.set_status(it, next);
 
             if (func)
             {
-                func(change);
+                func(*it);
             }
         }
     }
@@ -603,15 +605,7 @@ bool ReaderProxy::has_unacknowledged(
         return true;
     }
 
-    for (const ChangeForReader_t& it : changes_for_reader_)
-    {
-        if (it.getStatus() == UNACKNOWLEDGED)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return 0 < changes_for_reader_.count(UNACKNOWLEDGED);
 }
 
 bool ReaderProxy::requested_fragment_set(
@@ -630,7 +624,7 @@ bool ReaderProxy::requested_fragment_set(
     // If it was UNSENT, we shouldn't switch back to REQUESTED to prevent stalling.
     if (changeIter->getStatus() != UNSENT)
     {
-        changeIter->setStatus(REQUESTED);
+        changes_for_reader_.set_status(changeIter, REQUESTED);
     }
 
     return true;
@@ -657,38 +651,17 @@ bool ReaderProxy::process_nack_frag(
     return false;
 }
 
-static bool change_less_than_sequence(
-        const ChangeForReader_t& change,
-        const SequenceNumber_t& seq_num)
-{
-    return change.getSequenceNumber() < seq_num;
-}
-
 ReaderProxy::ChangeIterator ReaderProxy::find_change(
         const SequenceNumber_t& seq_num,
         bool exact)
 {
-    ReaderProxy::ChangeIterator it;
-    ReaderProxy::ChangeIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
-
-    return (!exact)
-           ? it
-           : it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
+    return exact ? changes_for_reader_.find(seq_num) : changes_for_reader_.lower_bound(seq_num);
 }
 
 ReaderProxy::ChangeConstIterator ReaderProxy::find_change(
         const SequenceNumber_t& seq_num) const
 {
-    ReaderProxy::ChangeConstIterator it;
-    ReaderProxy::ChangeConstIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
-
-    return it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
+    return changes_for_reader_.find(seq_num);
 }
 
 bool ReaderProxy::has_been_delivered(
@@ -31,9 +31,9 @@
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/common/Types.h>
-#include <fastdds/utils/collections/ResourceLimitedVector.hpp>
 
 #include <rtps/writer/ChangeForReader.hpp>
+#include <rtps/writer/ChangeForReaderCollection.hpp>
 #include <rtps/writer/ReaderLocator.hpp>
 
 namespace eprosima {
@@ -94,13 +94,14 @@ public:
      * @param change Information regarding the change added.
      * @param is_relevant Specify if change is relevant for this remote reader.
      * @param restart_nack_supression Whether nack-supression event should be restarted.
+     * @return false when the change could not be added, as the maximum number of changes has been reached.
      */
-    void add_change(
+    bool add_change(
             const ChangeForReader_t& change,
             bool is_relevant,
             bool restart_nack_supression);
 
-    void add_change(
+    bool add_change(
             const ChangeForReader_t& change,
             bool is_relevant,
             bool restart_nack_supression,
@@ -434,7 +435,7 @@ private:
     //!Pointer to the associated StatefulWriter.
     StatefulWriter* writer_;
     //!Set of the changes and its state.
-    ResourceLimitedVector<ChangeForReader_t, std::true_type> changes_for_reader_;
+    ChangeForReaderCollection changes_for_reader_;
     //! Timed Event to manage the delay to mark a change as UNACKED after sending it.
     TimedEvent* nack_supression_event_;
     TimedEvent* initial_heartbeat_event_;
@@ -449,8 +450,8 @@ private:
 
     bool active_ = false;
 
-    using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
-    using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
+    using ChangeIterator = ChangeForReaderCollection::iterator;
+    using ChangeConstIterator = ChangeForReaderCollection::const_iterator;
 
     void disable_timers();
 
@@ -476,7 +477,7 @@ private:
             const SequenceNumber_t& seq_num,
             const FragmentNumberSet_t& frag_set);
 
-    void add_change(
+    bool add_change(
             const ChangeForReader_t& change,
             bool is_relevant);
 
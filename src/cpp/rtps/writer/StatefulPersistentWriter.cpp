@@ -96,6 +96,11 @@ bool StatefulPersistentWriter::change_removed_by_history(
     return StatefulWriter::change_removed_by_history(change, max_blocking_time);
 }
 
+bool StatefulPersistentWriter::flush_persistent_changes()
+{
+    return PersistentWriter::flush_persistent_changes();
+}
+
 void StatefulPersistentWriter::print_inconsistent_acknack(
         const GUID_t& writer_guid,
         const GUID_t& reader_guid,
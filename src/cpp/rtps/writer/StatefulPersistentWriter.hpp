@@ -98,6 +98,12 @@ public:
     bool change_removed_by_history(
             CacheChange_t* a_change,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override;
+
+    /**
+     * Wait until the changes added to or removed from the history are stored.
+     * @return True if all those changes were successfully stored.
+     */
+    bool flush_persistent_changes() override;
 };
 
 } // namespace rtps
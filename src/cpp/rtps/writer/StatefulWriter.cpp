@@ -431,7 +431,12 @@ void StatefulWriter::unsent_change_added_to_history(
                     {
                         changeForReader.setStatus(UNACKNOWLEDGED);
                     }
-                    reader->add_change(changeForReader, is_revelant, false, max_blocking_time);
+                    if (!reader->add_change(changeForReader, is_revelant, false, max_blocking_time))
+                    {
+                        // The change does not fit on the reader proxy, so it is handled as an irrelevant one:
+                        // the reader receives a GAP for it with the next change sent, or when it requests it.
+                        reader->add_change(changeForReader, false, false, max_blocking_time);
+                    }
 
                     return false;
                 }
@@ -1186,18 +1191,24 @@ bool StatefulWriter::matched_reader_add(
                         {
                             ChangeForReader_t changeForReader(*cit);
 
-                            // If it is local, maintain in UNSENT status and add to flow controller.
-                            if (rp->is_local_reader())
+                            // If it is not local, set as UNACKNOWLEDGED and expects the reader request them.
+                            if (!rp->is_local_reader())
                             {
-                                flow_controller_->add_old_sample(this, *cit);
+                                changeForReader.setStatus(UNACKNOWLEDGED);
                             }
-                            // In other case, set as UNACKNOWLEDGED and expects the reader request them.
-                            else
+
+                            if (!rp->add_change(changeForReader, true, false))
                             {
-                                changeForReader.setStatus(UNACKNOWLEDGED);
+                                // The rest of changes do not fit on the reader proxy either, so they are handled
+                                // as irrelevant ones: the reader receives GAPs for them when it requests them.
+                                break;
                             }
 
-                            rp->add_change(changeForReader, true, false);
+                            // If it is local, maintain in UNSENT status and add to flow controller.
+                            if (rp->is_local_reader())
+                            {
+                                flow_controller_->add_old_sample(this, *cit);
+                            }
                         }
                     }
                 }
@@ -94,6 +94,11 @@ bool StatelessPersistentWriter::change_removed_by_history(
     return StatelessWriter::change_removed_by_history(change, max_blocking_time);
 }
 
+bool StatelessPersistentWriter::flush_persistent_changes()
+{
+    return PersistentWriter::flush_persistent_changes();
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
@@ -23,6 +23,7 @@
 #include <rtps/messages/CDRMessage.hpp>
 
 #include <openssl/aes.h>
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 #include <cstring>
@@ -55,6 +56,112 @@ using namespace security;
 
 constexpr int initialization_vector_suffix_length = 8;
 
+/**
+ * AES-GCM cipher context kept by a thread between operations.
+ * The key schedule is only computed again when the key changes, so consecutive operations protected with the same
+ * session key (i.e. all the submessages of an RTPS message) only need to set their own initialization vector.
+ */
+class CipherContext
+{
+public:
+
+    explicit CipherContext(
+            bool encrypt)
+        : ctx_(EVP_CIPHER_CTX_new())
+        , encrypt_(encrypt ? 1 : 0)
+    {
+    }
+
+    ~CipherContext()
+    {
+        EVP_CIPHER_CTX_free(ctx_);
+        OPENSSL_cleanse(key_.data(), key_.size());
+    }
+
+    CipherContext(
+            const CipherContext&) = delete;
+
+    CipherContext& operator =(
+            const CipherContext&) = delete;
+
+    /**
+     * Prepare the context for a new operation.
+     *
+     * @param use_256_bits Whether AES-256 should be used instead of AES-128.
+     * @param key The session key. It should hold 32 bytes for AES-256 and 16 bytes for AES-128.
+     * @param initialization_vector The 12 bytes initialization vector of the operation.
+     *
+     * @return The initialized context, or nullptr on error.
+     */
+    EVP_CIPHER_CTX* init(
+            bool use_256_bits,
+            const uint8_t* key,
+            const uint8_t* initialization_vector)
+    {
+        if (nullptr == ctx_)
+        {
+            return nullptr;
+        }
+
+        const EVP_CIPHER* cipher = use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm();
+        size_t key_len = use_256_bits ? 32 : 16;
+
+        if (cipher == cipher_ && 0 == CRYPTO_memcmp(key_.data(), key, key_len))
+        {
+            // Same key, only the initialization vector has to be set
+            if (EVP_CipherInit_ex(ctx_, nullptr, nullptr, nullptr, initialization_vector, encrypt_))
+            {
+                return ctx_;
+            }
+        }
+
+        cipher_ = nullptr;
+        if (!EVP_CipherInit_ex(ctx_, cipher, nullptr, key, initialization_vector, encrypt_))
+        {
+            return nullptr;
+        }
+
+        memcpy(key_.data(), key, key_len);
+        cipher_ = cipher;
+        return ctx_;
+    }
+
+private:
+
+    EVP_CIPHER_CTX* ctx_ = nullptr;
+    int encrypt_ = 1;
+    const EVP_CIPHER* cipher_ = nullptr;
+    std::array<uint8_t, 32> key_{};
+};
+
+//! Context used to protect bodies and common MACs
+static CipherContext& encrypt_context()
+{
+    static thread_local CipherContext context(true);
+    return context;
+}
+
+//! Context used to compute receiver specific MACs
+static CipherContext& specific_mac_encrypt_context()
+{
+    static thread_local CipherContext context(true);
+    return context;
+}
+
+//! Context used to unprotect bodies and check common MACs
+static CipherContext& decrypt_context()
+{
+    static thread_local CipherContext context(false);
+    return context;
+}
+
+//! Context used to check receiver specific MACs
+static CipherContext& specific_mac_decrypt_context()
+{
+    static thread_local CipherContext context(false);
+    return context;
+}
+
 static KeyMaterial_AES_GCM_GMAC* find_key(
         KeyMaterial_AES_GCM_GMAC_Seq& keys,
         const CryptoTransformIdentifier& id)
@@ -698,7 +805,7 @@ bool AESGCMGMAC_Transform::decode_rtps_message(
     std::array<uint8_t, 32> session_key{};
     compute_sessionkey(session_key,
             sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0),
-            session_id);
+            session_id, &sending_participant->DecodeSessionKeys);
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -786,7 +893,7 @@ bool AESGCMGMAC_Transform::decode_rtps_message(
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).receiver_specific_key_id,
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).master_receiver_specific_key,
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).master_salt,
-                initialization_vector, session_id, exception))
+                initialization_vector, session_id, &sending_participant->DecodeSessionKeys, exception))
         {
             return false;
         }
@@ -1063,7 +1170,7 @@ bool AESGCMGMAC_Transform::decode_datawriter_submessage(
     memcpy(&session_id, header.session_id.data(), 4);
     //Sessionkey
     std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key, *keyMat, session_id);
+    compute_sessionkey(session_key, *keyMat, session_id, &sending_writer->DecodeSessionKeys);
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1122,7 +1229,7 @@ bool AESGCMGMAC_Transform::decode_datawriter_submessage(
                 keyMat->receiver_specific_key_id,
                 keyMat->master_receiver_specific_key,
                 keyMat->master_salt,
-                initialization_vector, session_id, exception))
+                initialization_vector, session_id, &sending_writer->DecodeSessionKeys, exception))
         {
             return false;
         }
@@ -1243,7 +1350,7 @@ bool AESGCMGMAC_Transform::decode_datareader_submessage(
     memcpy(&session_id, header.session_id.data(), 4);
     //Sessionkey
     std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key, *keyMat, session_id);
+    compute_sessionkey(session_key, *keyMat, session_id, &sending_reader->DecodeSessionKeys);
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1302,7 +1409,7 @@ bool AESGCMGMAC_Transform::decode_datareader_submessage(
                 keyMat->receiver_specific_key_id,
                 keyMat->master_receiver_specific_key,
                 keyMat->master_salt,
-                initialization_vector, session_id, exception))
+                initialization_vector, session_id, &sending_reader->DecodeSessionKeys, exception))
         {
             return false;
         }
@@ -1399,7 +1506,7 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
 
     //Sessionkey
     std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key, *keyMat, session_id);
+    compute_sessionkey(session_key, *keyMat, session_id, &sending_writer->DecodeSessionKeys);
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1439,7 +1546,7 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
     // Tag
     try
     {
-        deserialize_SecureDataTag(decoder, tag, {}, {}, {}, {}, {}, 0, exception);
+        deserialize_SecureDataTag(decoder, tag, {}, {}, {}, {}, {}, 0, nullptr, exception);
     }
     catch (eprosima::fastcdr::exception::Exception&)
     {
@@ -1465,13 +1572,15 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
 void AESGCMGMAC_Transform::compute_sessionkey(
         std::array<uint8_t, 32>& session_key,
         const KeyMaterial_AES_GCM_GMAC& key_mat,
-        const uint32_t session_id)
+        const uint32_t session_id,
+        SessionKeyCache* cache)
 {
     bool use_256_bits = (key_mat.transformation_kind == c_transfrom_kind_aes256_gcm ||
             key_mat.transformation_kind == c_transfrom_kind_aes256_gmac);
     int key_len = use_256_bits ? 32 : 16;
 
-    compute_sessionkey(session_key, false, key_mat.master_sender_key, key_mat.master_salt, session_id, key_len);
+    compute_sessionkey(session_key, false, key_mat.master_sender_key, key_mat.master_salt, session_id, key_len,
+            cache);
 }
 
 void AESGCMGMAC_Transform::compute_sessionkey(
@@ -1480,8 +1589,15 @@ void AESGCMGMAC_Transform::compute_sessionkey(
         const std::array<uint8_t, 32>& master_key,
         const std::array<uint8_t, 32>& master_salt,
         const uint32_t session_id,
-        int key_len)
+        int key_len,
+        SessionKeyCache* cache)
 {
+    if (nullptr != cache &&
+            cache->find(session_key, receiver_specific, master_key, master_salt, session_id, key_len))
+    {
+        return;
+    }
+
     session_key.fill(0);
 
     int sourceLen = 0;
@@ -1525,6 +1641,11 @@ void AESGCMGMAC_Transform::compute_sessionkey(
     EVP_MD_CTX_cleanup(ctx);
     free(ctx);
 #endif // if IS_OPENSSL_1_1
+
+    if (nullptr != cache)
+    {
+        cache->add(session_key, receiver_specific, master_key, master_salt, session_id, key_len);
+    }
 }
 
 void AESGCMGMAC_Transform::serialize_SecureDataHeader(
@@ -1555,34 +1676,16 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // AES_BLOCK_SIZE = 16
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
-    EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
+    EVP_CIPHER_CTX* e_ctx = encrypt_context().init(use_256_bits, session_key.data(), initialization_vector.data());
 
-    if (!use_256_bits)
+    if (nullptr == e_ctx)
     {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                "Unable to encode the payload. EVP_EncryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_block_size(use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm());
 
     if (!do_encryption)
     {
@@ -1591,7 +1694,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 plain_buffer_len)
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO, "Error in fastcdr trying to copy payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
         memcpy(serializer.get_current_position(), plain_buffer, plain_buffer_len);
@@ -1601,15 +1703,13 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
-        if (!EVP_EncryptFinal(e_ctx, nullptr, &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, nullptr, &final_size))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+                    "Unable to encode the payload. EVP_EncryptFinal_ex function returns an error");
             return false;
         }
     }
@@ -1653,7 +1753,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 (plain_buffer_len + (2 * cipher_block_size) - 1))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO, "Error in fastcdr trying to cipher payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1662,15 +1761,13 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
-        if (!EVP_EncryptFinal(e_ctx, &output_buffer_raw[actual_size], &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, &output_buffer_raw[actual_size], &final_size))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+                    "Unable to encode the payload. EVP_EncryptFinal_ex function returns an error");
             return false;
         }
 
@@ -1696,7 +1793,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // Get commmon_mac
     EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
-    EVP_CIPHER_CTX_free(e_ctx);
 
     if (submessage)
     {
@@ -1779,51 +1875,29 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        if (transformation_kind == c_transfrom_kind_aes128_gcm ||
-                transformation_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
-                transformation_kind == c_transfrom_kind_aes256_gmac)
+        EVP_CIPHER_CTX* e_ctx = specific_mac_encrypt_context().init(use_256_bits,
+                remote_entity->Sessions[sessionIndex].SessionKey.data(), initialization_vector.data());
+        if (nullptr == e_ctx)
         {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, NULL, &final_size))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal_ex function returns an error");
             continue;
         }
         serializer << remote_entity->Remote2EntityKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.get_current_position());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1892,52 +1966,29 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        auto& trans_kind = remote_participant->Participant2ParticipantKeyMaterial.at(0).transformation_kind;
-        if (trans_kind == c_transfrom_kind_aes128_gcm ||
-                trans_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (trans_kind == c_transfrom_kind_aes256_gcm ||
-                trans_kind == c_transfrom_kind_aes256_gmac)
+        EVP_CIPHER_CTX* e_ctx = specific_mac_encrypt_context().init(use_256_bits,
+                remote_participant->Session.SessionKey.data(), initialization_vector.data());
+        if (nullptr == e_ctx)
         {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, NULL, &final_size))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal_ex function returns an error");
             continue;
         }
         serializer << remote_participant->Participant2ParticipantKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.get_current_position());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1979,35 +2030,17 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
             transformation_kind == c_transfrom_kind_aes256_gmac);
 
-    EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
+    EVP_CIPHER_CTX* d_ctx = decrypt_context().init(use_256_bits, session_key.data(), initialization_vector.data());
 
-    if (!use_256_bits)
+    if (nullptr == d_ctx)
     {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_128_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                "Unable to decode the payload. EVP_DecryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_256_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_block_size(use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm());
 
     uint32_t protected_len = body_length;
     if (do_encryption)
@@ -2019,7 +2052,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
         if (plain_buffer_len < (protected_len + cipher_block_size))
         {
             EPROSIMA_LOG_WARNING(SECURITY_CRYPTO, "Error in fastcdr trying to decode payload");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
     }
@@ -2030,20 +2062,17 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     {
         EPROSIMA_LOG_WARNING(SECURITY_CRYPTO,
                 "Unable to decode the payload. EVP_DecryptUpdate function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
 
     EVP_CIPHER_CTX_ctrl(d_ctx, EVP_CTRL_GCM_SET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
 
-    if (!EVP_DecryptFinal(d_ctx, output_buffer ? &output_buffer[actual_size] : NULL, &final_size))
+    if (!EVP_DecryptFinal_ex(d_ctx, output_buffer ? &output_buffer[actual_size] : NULL, &final_size))
     {
         EPROSIMA_LOG_WARNING(SECURITY_CRYPTO,
-                "Unable to decode the payload. EVP_DecryptFinal function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
+                "Unable to decode the payload. EVP_DecryptFinal_ex function returns an error");
         return false;
     }
-    EVP_CIPHER_CTX_free(d_ctx);
 
     uint32_t cnt_len = do_encryption ? static_cast<uint32_t>(actual_size + final_size) : body_length;
     if (plain_buffer_len < cnt_len)
@@ -2112,6 +2141,7 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         const std::array<uint8_t, 32>& master_salt,
         const std::array<uint8_t, 12>& initialization_vector,
         const uint32_t session_id,
+        SessionKeyCache* session_keys,
         SecurityException& exception)
 {
     decoder >> tag.common_mac;
@@ -2147,9 +2177,7 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         }
 
         //Auth message - The point is that we cannot verify the authorship of the message with our receiver_specific_key the message could be crafted
-        EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
-        const EVP_CIPHER* d_cipher = nullptr;
-
+        bool use_256_bits = false;
         int actual_size = 0, final_size = 0;
 
         //Get ReceiverSpecificSessionKey
@@ -2159,28 +2187,28 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         if (transformation_kind == c_transfrom_kind_aes128_gcm ||
                 transformation_kind == c_transfrom_kind_aes128_gmac)
         {
-            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 16);
-            d_cipher = EVP_aes_128_gcm();
+            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 16,
+                    session_keys);
         }
         else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
                 transformation_kind == c_transfrom_kind_aes256_gmac)
         {
-            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 32);
-            d_cipher = EVP_aes_256_gcm();
+            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 32,
+                    session_keys);
+            use_256_bits = true;
         }
         else
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO, "Invalid transformation kind)");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
-        if (!EVP_DecryptInit(d_ctx, d_cipher, (const unsigned char*)specific_session_key.data(),
-                initialization_vector.data()))
+        EVP_CIPHER_CTX* d_ctx = specific_mac_decrypt_context().init(use_256_bits, specific_session_key.data(),
+                initialization_vector.data());
+        if (nullptr == d_ctx)
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2188,7 +2216,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2196,7 +2223,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_CIPHER_CTX_ctrl function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2204,11 +2230,8 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptFinal_ex function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
-
-        EVP_CIPHER_CTX_free(d_ctx);
     }
 
     return true;
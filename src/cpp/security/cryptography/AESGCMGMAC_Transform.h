@@ -105,18 +105,21 @@ public:
             SecurityException& exception) override;
 
     //Aux functions to compute session key from the master material
+    //When a cache is given, the session key is looked up on it before computing it
     void compute_sessionkey(
             std::array<uint8_t, 32>& session_key,
             bool receiver_specific,
             const std::array<uint8_t, 32>& master_key,
             const std::array<uint8_t, 32>& master_salt,
             const uint32_t session_id,
-            int key_len);
+            int key_len,
+            SessionKeyCache* cache = nullptr);
 
     void compute_sessionkey(
             std::array<uint8_t, 32>& session_key,
             const KeyMaterial_AES_GCM_GMAC& key,
-            const uint32_t session_id);
+            const uint32_t session_id,
+            SessionKeyCache* cache = nullptr);
 
     //Serialization and deserialization of message components
     void serialize_SecureDataHeader(
@@ -190,6 +193,7 @@ public:
             const std::array<uint8_t, 32>& master_salt,
             const std::array<uint8_t, 12>& initialization_vector,
             uint32_t session_id,
+            SessionKeyCache* session_keys,
             SecurityException& exception);
 
     uint32_t calculate_extra_size_for_rtps_message(
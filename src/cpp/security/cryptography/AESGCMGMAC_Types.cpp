@@ -19,8 +19,62 @@
 
 #include <security/cryptography/AESGCMGMAC_Types.h>
 
+#include <openssl/crypto.h>
+
 using namespace eprosima::fastdds::rtps::security;
 
 
 const char* const ParticipantKeyHandle::class_id_ = "ParticipantCryptohandle";
 const char* const EntityKeyHandle::class_id_ = "EntityCryptohandle";
+
+SessionKeyCache::~SessionKeyCache()
+{
+    OPENSSL_cleanse(entries_.data(), sizeof(entries_));
+}
+
+bool SessionKeyCache::find(
+        std::array<uint8_t, 32>& session_key,
+        bool receiver_specific,
+        const std::array<uint8_t, 32>& master_key,
+        const std::array<uint8_t, 32>& master_salt,
+        const uint32_t session_id,
+        int key_len)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const Entry& entry : entries_)
+    {
+        if (entry.valid && entry.session_id == session_id && entry.key_len == key_len &&
+                entry.receiver_specific == receiver_specific &&
+                0 == CRYPTO_memcmp(entry.master_key.data(), master_key.data(), key_len) &&
+                0 == CRYPTO_memcmp(entry.master_salt.data(), master_salt.data(), key_len))
+        {
+            session_key = entry.session_key;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SessionKeyCache::add(
+        const std::array<uint8_t, 32>& session_key,
+        bool receiver_specific,
+        const std::array<uint8_t, 32>& master_key,
+        const std::array<uint8_t, 32>& master_salt,
+        const uint32_t session_id,
+        int key_len)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Entry& entry = entries_[next_];
+    next_ = (next_ + 1) % entries_.size();
+
+    entry.valid = true;
+    entry.receiver_specific = receiver_specific;
+    entry.key_len = key_len;
+    entry.session_id = session_id;
+    entry.master_key = master_key;
+    entry.master_salt = master_salt;
+    entry.session_key = session_key;
+}
@@ -19,6 +19,7 @@
 #ifndef _SECURITY_AUTHENTICATION_AESGCMGMAC_TYPES_H_
 #define _SECURITY_AUTHENTICATION_AESGCMGMAC_TYPES_H_
 
+#include <array>
 #include <cassert>
 #include <functional>
 #include <limits>
@@ -137,6 +138,61 @@ struct SecureDataTag
  * Note: the common key of the remote cryptohandle is stored along with the specific keys. KeyMaterial->master_sender_key
  */
 
+/* Session key cache
+ * -----------------
+ *  Session keys recently derived to decode the messages protected by a remote element.
+ *  A session key only changes when its session rotates, so there is no need to compute the HMAC for every message.
+ *  The cache is owned by the CryptoHandle of the remote element, and its entries are cleansed when the handle is
+ *  destroyed.
+ */
+class SessionKeyCache
+{
+public:
+
+    SessionKeyCache() = default;
+
+    ~SessionKeyCache();
+
+    SessionKeyCache(
+            const SessionKeyCache&) = delete;
+
+    SessionKeyCache& operator =(
+            const SessionKeyCache&) = delete;
+
+    bool find(
+            std::array<uint8_t, 32>& session_key,
+            bool receiver_specific,
+            const std::array<uint8_t, 32>& master_key,
+            const std::array<uint8_t, 32>& master_salt,
+            const uint32_t session_id,
+            int key_len);
+
+    void add(
+            const std::array<uint8_t, 32>& session_key,
+            bool receiver_specific,
+            const std::array<uint8_t, 32>& master_key,
+            const std::array<uint8_t, 32>& master_salt,
+            const uint32_t session_id,
+            int key_len);
+
+private:
+
+    struct Entry
+    {
+        bool valid = false;
+        bool receiver_specific = false;
+        int key_len = 0;
+        uint32_t session_id = 0;
+        std::array<uint8_t, 32> master_key{};
+        std::array<uint8_t, 32> master_salt{};
+        std::array<uint8_t, 32> session_key{};
+    };
+
+    std::mutex mutex_;
+    std::array<Entry, 8> entries_{};
+    size_t next_ = 0;
+};
+
 struct KeySessionData
 {
     uint32_t session_id = (std::numeric_limits<uint32_t>::max)();
@@ -170,6 +226,8 @@ struct EntityKeyHandle
     KeySessionData Sessions[2];
     uint64_t max_blocks_per_session = 0;
     std::mutex mutex_;
+    //Session keys derived to decode the messages of a remote element
+    mutable SessionKeyCache DecodeSessionKeys;
 };
 
 class AESGCMGMAC_KeyFactory;
@@ -204,6 +262,8 @@ struct ParticipantKeyHandle
     KeySessionData Session;
     uint64_t max_blocks_per_session = {0};
     std::mutex mutex_;
+    //Session keys derived to decode the messages of a remote participant
+    mutable SessionKeyCache DecodeSessionKeys;
 };
 
 typedef HandleImpl<ParticipantKeyHandle, AESGCMGMAC_KeyFactory> AESGCMGMAC_ParticipantCryptoHandle;
@@ -115,8 +115,18 @@ bool StatisticsListenersImpl::add_statistics_listener_impl(
 
     std::lock_guard<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
 
-    // add the new listener
-    return members_->listeners.insert(listener).second;
+    auto current = std::atomic_load(&members_->listeners);
+    if (0 != current->count(listener))
+    {
+        return false;
+    }
+
+    // add the new listener on a copy of the collection
+    auto listeners = std::make_shared<StatisticsAncillary::ListenerCollection>(*current);
+    listeners->insert(listener);
+    std::atomic_store(&members_->listeners,
+            std::shared_ptr<const StatisticsAncillary::ListenerCollection>(std::move(listeners)));
+    return true;
 }
 
 bool StatisticsListenersImpl::remove_statistics_listener_impl(
@@ -130,7 +140,18 @@ bool StatisticsListenersImpl::remove_statistics_listener_impl(
         return false;
     }
 
-    return 1 == members_->listeners.erase(listener);
+    auto current = std::atomic_load(&members_->listeners);
+    if (0 == current->count(listener))
+    {
+        return false;
+    }
+
+    // remove the listener from a copy of the collection
+    auto listeners = std::make_shared<StatisticsAncillary::ListenerCollection>(*current);
+    listeners->erase(listener);
+    std::atomic_store(&members_->listeners,
+            std::shared_ptr<const StatisticsAncillary::ListenerCollection>(std::move(listeners)));
+    return true;
 }
 
 void StatisticsListenersImpl::set_enabled_statistics_writers_mask_impl(
@@ -172,6 +193,47 @@ std::recursive_mutex& StatisticsParticipantImpl::get_statistics_mutex()
     return statistics_mutex_;
 }
 
+std::shared_ptr<const StatisticsParticipantImpl::ProxyCollection> StatisticsParticipantImpl::get_listeners()
+{
+    return std::atomic_load(&listeners_);
+}
+
+void StatisticsParticipantImpl::set_listeners(
+        std::shared_ptr<const ProxyCollection> listeners)
+{
+    std::atomic_store(&listeners_, std::move(listeners));
+}
+
+StatisticsParticipantImpl::rtps_sent_data& StatisticsParticipantImpl::get_traffic(
+        const fastdds::rtps::Locator_t& loc)
+{
+    {
+        std::shared_ptr<const TrafficCollection> traffic = std::atomic_load(&traffic_);
+        auto it = traffic->find(loc);
+        if (traffic->end() != it)
+        {
+            return *it->second;
+        }
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
+
+    // Another thread may have added it meanwhile
+    auto it = traffic_->find(loc);
+    if (traffic_->end() != it)
+    {
+        return *it->second;
+    }
+
+    // add the new destination on a copy of the collection
+    traffic_entries_.emplace_back(new rtps_sent_data());
+    rtps_sent_data* entry = traffic_entries_.back().get();
+    auto traffic = std::make_shared<TrafficCollection>(*traffic_);
+    traffic->emplace(loc, entry);
+    std::atomic_store(&traffic_, std::shared_ptr<const TrafficCollection>(std::move(traffic)));
+    return *entry;
+}
+
 bool StatisticsParticipantImpl::are_statistics_writers_enabled(
         uint32_t checked_enabled_writers)
 {
@@ -246,17 +308,22 @@ bool StatisticsParticipantImpl::add_statistics_listener(
     }
 
     // add the new listener, and identify selection changes
-    auto res = listeners_.emplace(std::make_shared<ListenerProxy>(listener, mask));
-    const ListenerProxy& proxy = **res.first;
+    auto proxy = std::make_shared<ListenerProxy>(listener, mask);
+    auto it = listeners_->find(proxy);
 
-    if (res.second)
+    if (listeners_->end() == it)
     {
+        auto listeners = std::make_shared<ProxyCollection>(*listeners_);
+        listeners->insert(proxy);
+        set_listeners(std::move(listeners));
+
         new_mask = mask;
         old_mask = 0;
     }
     else
     {
-        old_mask = proxy.mask();
+        proxy = *it;
+        old_mask = proxy->mask();
         new_mask = old_mask | mask;
 
         if ( old_mask == new_mask )
@@ -265,7 +332,7 @@ bool StatisticsParticipantImpl::add_statistics_listener(
             return false;
         }
 
-        proxy.mask(new_mask);
+        proxy->mask(new_mask);
     }
 
     // no other mutex should be taken in order to prevent ABBA deadlocks
@@ -276,7 +343,7 @@ bool StatisticsParticipantImpl::add_statistics_listener(
     if (are_writers_involved(new_mask)
             && !are_writers_involved(old_mask))
     {
-        writers_res = register_in_writer(proxy.get_shared_ptr());
+        writers_res = register_in_writer(proxy->get_shared_ptr());
     }
 
     // Check if the listener should be registered in readers
@@ -284,7 +351,7 @@ bool StatisticsParticipantImpl::add_statistics_listener(
     if (are_readers_involved(new_mask)
             && !are_readers_involved(old_mask))
     {
-        readers_res = register_in_reader(proxy.get_shared_ptr());
+        readers_res = register_in_reader(proxy->get_shared_ptr());
     }
 
     return writers_res && readers_res;
@@ -306,11 +373,10 @@ bool StatisticsParticipantImpl::remove_statistics_listener(
         return false;
     }
 
-    ProxyCollection::iterator it;
     auto proxy = std::make_shared<ListenerProxy>(listener, mask);
-    it = listeners_.find(proxy);
+    auto it = listeners_->find(proxy);
 
-    if ( listeners_.end() == it )
+    if ( listeners_->end() == it )
     {
         // not registered
         return false;
@@ -335,7 +401,9 @@ bool StatisticsParticipantImpl::remove_statistics_listener(
     else
     {
         // remove
-        listeners_.erase(it);
+        auto listeners = std::make_shared<ProxyCollection>(*listeners_);
+        listeners->erase(proxy);
+        set_listeners(std::move(listeners));
     }
 
     // no other mutex should be taken in order to prevent ABBA deadlocks
@@ -513,12 +581,12 @@ void StatisticsParticipantImpl::on_rtps_sent(
     notification.dst_locator(to_statistics_type(loc));
 
     {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-
-        auto& val = traffic_[loc];
-        notification.packet_count(++val.packet_count);
-        notification.byte_count(val.byte_count += payload_size);
-        notification.byte_magnitude_order((int16_t)floor(log10(float(val.byte_count))));
+        rtps_sent_data& val = get_traffic(loc);
+        unsigned long long byte_count =
+                val.byte_count.fetch_add(payload_size, std::memory_order_relaxed) + payload_size;
+        notification.packet_count(val.packet_count.fetch_add(1, std::memory_order_relaxed) + 1);
+        notification.byte_count(byte_count);
+        notification.byte_magnitude_order((int16_t)floor(log10(float(byte_count))));
     }
 
     // Perform the callbacks
@@ -605,11 +673,7 @@ void StatisticsParticipantImpl::on_pdp_packet(
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
 
-    {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-        pdp_counter_ += packages;
-        notification.count(pdp_counter_);
-    }
+    notification.count(pdp_counter_.fetch_add(packages, std::memory_order_relaxed) + packages);
 
     // Perform the callbacks
     Data data;
@@ -634,11 +698,7 @@ void StatisticsParticipantImpl::on_edp_packet(
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
 
-    {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-        edp_counter_ += packages;
-        notification.count(edp_counter_);
-    }
+    notification.count(edp_counter_.fetch_add(packages, std::memory_order_relaxed) + packages);
 
     // Perform the callbacks
     Data data;
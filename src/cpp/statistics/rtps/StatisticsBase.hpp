@@ -22,8 +22,11 @@
 #include <atomic>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include <fastdds/config.h>
 #include <fastdds/dds/core/policy/ParameterTypes.hpp>
@@ -51,7 +54,12 @@ namespace statistics {
 // RTPSWriter and RTPSReader statistics members
 struct StatisticsAncillary
 {
-    std::set<std::shared_ptr<IListener>> listeners;
+    using ListenerCollection = std::set<std::shared_ptr<IListener>>;
+
+    //! Replaced by a modified copy when a listener is added or removed, so it is traversed without copying it.
+    //! It is loaded and replaced with the atomic shared_ptr operations, replacements are serialized by the statistics
+    //! mutex.
+    std::shared_ptr<const ListenerCollection> listeners = std::make_shared<ListenerCollection>();
     std::atomic<uint32_t> enabled_writers_mask{0};
     virtual ~StatisticsAncillary() = default;
 };
@@ -76,14 +84,16 @@ template<class Function>
 Function StatisticsListenersImpl::for_each_listener(
         Function f)
 {
-    // Use a collection copy to prevent locking on traversal
-    std::unique_lock<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
+    // Take a reference to the current collection, which is never modified, so it is traversed without locking
+    std::shared_ptr<const StatisticsAncillary::ListenerCollection> listeners;
     if (members_)
     {
-        auto listeners = members_->listeners;
-        lock.unlock();
+        listeners = std::atomic_load(&members_->listeners);
+    }
 
-        for (auto& listener : listeners)
+    if (listeners)
+    {
+        for (auto& listener : *listeners)
         {
             f(listener);
         }
@@ -109,11 +119,48 @@ private:
     // RTPS_SENT ancillary
     struct rtps_sent_data
     {
-        unsigned long long packet_count = {};
-        unsigned long long byte_count = {};
+        // Updated independently, so a notification may report the packets and bytes of other concurrent sends,
+        // but each count includes all the messages sent before it was read
+        std::atomic<unsigned long long> packet_count{0};
+        std::atomic<unsigned long long> byte_count{0};
     };
 
-    std::map<fastdds::rtps::Locator_t, rtps_sent_data> traffic_;
+    struct locator_hash
+    {
+        std::size_t operator ()(
+                const fastdds::rtps::Locator_t& loc) const noexcept
+        {
+            // FNV-1a over the fields compared by the equality operator
+            std::size_t ret = 2166136261u;
+            auto add = [&ret](uint8_t byte)
+                    {
+                        ret = (ret ^ byte) * 16777619u;
+                    };
+            for (size_t i = 0; i < sizeof(loc.kind); ++i)
+            {
+                add(static_cast<uint8_t>(static_cast<uint32_t>(loc.kind) >> (8 * i)));
+            }
+            for (size_t i = 0; i < sizeof(loc.port); ++i)
+            {
+                add(static_cast<uint8_t>(loc.port >> (8 * i)));
+            }
+            for (uint8_t byte : loc.address)
+            {
+                add(byte);
+            }
+            return ret;
+        }
+
+    };
+
+    using TrafficCollection = std::unordered_map<fastdds::rtps::Locator_t, rtps_sent_data*, locator_hash>;
+
+    // Replaced by a copy with the new entry when a destination is added, so it is looked up without locking.
+    // It is loaded and replaced with the atomic shared_ptr operations, replacements are serialized by the participant
+    // mutex.
+    std::shared_ptr<const TrafficCollection> traffic_ = std::make_shared<TrafficCollection>();
+    // Owner of the traffic_ entries, which are never removed
+    std::vector<std::unique_ptr<rtps_sent_data>> traffic_entries_;
 
     // RTPS_LOST ancillary
     using lost_traffic_key = std::pair<fastdds::rtps::GuidPrefix_t, fastdds::rtps::Locator_t>;
@@ -126,9 +173,9 @@ private:
     std::map<lost_traffic_key, lost_traffic_value> lost_traffic_;
 
     // PDP_PACKETS ancillary
-    unsigned long long pdp_counter_ = {};
+    std::atomic<unsigned long long> pdp_counter_{0};
     // EDP_PACKETS ancillary
-    unsigned long long edp_counter_ = {};
+    std::atomic<unsigned long long> edp_counter_{0};
 
     // Mask of enabled statistics writers
     std::atomic<uint32_t> enabled_writers_mask_{0};
@@ -139,6 +186,14 @@ private:
      */
     const GUID_t& get_guid() const;
 
+    /*
+     * Retrieve the traffic counters of a destination, creating them if needed
+     * @param loc destination
+     * @return counters of the traffic sent to loc
+     */
+    rtps_sent_data& get_traffic(
+            const fastdds::rtps::Locator_t& loc);
+
 protected:
 
     class ListenerProxy
@@ -146,7 +201,7 @@ protected:
         , public std::enable_shared_from_this<ListenerProxy>
     {
         // the external_ listener is the actual key value
-        mutable uint32_t mask_;
+        mutable std::atomic<uint32_t> mask_;
         std::shared_ptr<IListener> external_;
 
     public:
@@ -191,11 +246,22 @@ protected:
     };
 
     using ProxyCollection = std::set<Key, CompareProxies>;
-    ProxyCollection listeners_;
+
+    // Replaced by a modified copy when a listener is added or removed, so it is traversed without copying it.
+    // It is loaded and replaced with the atomic shared_ptr operations, replacements are serialized by the participant
+    // mutex.
+    std::shared_ptr<const ProxyCollection> listeners_ = std::make_shared<ProxyCollection>();
 
     // retrieve the participant mutex
     std::recursive_mutex& get_statistics_mutex();
 
+    // retrieve the current listeners collection
+    std::shared_ptr<const ProxyCollection> get_listeners();
+
+    // replace the listeners collection. @pre the participant mutex is locked
+    void set_listeners(
+            std::shared_ptr<const ProxyCollection> listeners);
+
     /**
      * @brief Check whether the statistics writers in the input mask are enabled
      *
@@ -245,11 +311,10 @@ protected:
     Function for_each_listener(
             Function f)
     {
-        std::unique_lock<std::recursive_mutex> lock(get_statistics_mutex());
-        auto temp_listeners = listeners_;
-        lock.unlock();
+        // The collection is never modified, so it is traversed without locking
+        std::shared_ptr<const ProxyCollection> listeners = get_listeners();
 
-        for (auto& listener : temp_listeners)
+        for (auto& listener : *listeners)
         {
             f(listener);
         }
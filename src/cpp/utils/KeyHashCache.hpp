@@ -0,0 +1,158 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file KeyHashCache.hpp
+ *
+ */
+
+#ifndef FASTDDS_UTILS_KEYHASHCACHE_HPP_
+#define FASTDDS_UTILS_KEYHASHCACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Cache of the instance handles computed for serialized keys.
+ *
+ * Computing the MD5 of a serialized key is much more expensive than looking it up, so keeping the handles of the last
+ * keys avoids hashing again the keys of the instances which are written or received repeatedly.
+ * The cache is direct-mapped: each key can only be kept in one entry, chosen from a fast hash of its bytes, replacing
+ * the key previously kept there.
+ *
+ * This class is not thread safe.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+class KeyHashCache
+{
+public:
+
+    /**
+     * Construct a cache.
+     *
+     * @param max_entries Maximum number of keys kept in the cache. Rounded up to a power of two.
+     */
+    explicit KeyHashCache(
+            size_t max_entries)
+    {
+        size_t size = 1;
+        while (size < max_entries)
+        {
+            size <<= 1;
+        }
+        entries_.resize(size);
+        mask_ = size - 1;
+    }
+
+    /**
+     * Look for the instance handle of a serialized key.
+     *
+     * @param key Pointer to the serialized key.
+     * @param length Length of the serialized key.
+     * @param [out] handle Instance handle of the key, only written when found.
+     *
+     * @return true when the key was found in the cache.
+     */
+    bool find(
+            const unsigned char* key,
+            size_t length,
+            InstanceHandle_t& handle) const
+    {
+        const Entry& entry = entries_[hash(key, length) & mask_];
+        if (entry.valid && entry.key.size() == length && 0 == memcmp(entry.key.data(), key, length))
+        {
+            handle = entry.handle;
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Keep the instance handle of a serialized key.
+     *
+     * @param key Pointer to the serialized key.
+     * @param length Length of the serialized key.
+     * @param handle Instance handle of the key.
+     */
+    void insert(
+            const unsigned char* key,
+            size_t length,
+            const InstanceHandle_t& handle)
+    {
+        Entry& entry = entries_[hash(key, length) & mask_];
+        entry.key.assign(key, key + length);
+        entry.handle = handle;
+        entry.valid = true;
+    }
+
+    //! Maximum number of keys kept in the cache.
+    size_t capacity() const
+    {
+        return entries_.size();
+    }
+
+private:
+
+    struct Entry
+    {
+        std::vector<unsigned char> key;
+        InstanceHandle_t handle;
+        bool valid = false;
+    };
+
+    static uint64_t hash(
+            const unsigned char* key,
+            size_t length)
+    {
+        constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+        uint64_t ret = length * multiplier;
+        uint64_t word;
+
+        for (; length >= sizeof(word); key += sizeof(word), length -= sizeof(word))
+        {
+            memcpy(&word, key, sizeof(word));
+            ret = (ret ^ word) * multiplier;
+            ret ^= ret >> 32;
+        }
+        if (0 < length)
+        {
+            word = 0;
+            memcpy(&word, key, length);
+            ret = (ret ^ word) * multiplier;
+        }
+
+        ret ^= ret >> 29;
+        ret *= multiplier;
+        return ret ^ (ret >> 32);
+    }
+
+    std::vector<Entry> entries_;
+    size_t mask_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_UTILS_KEYHASHCACHE_HPP_
@@ -38,6 +38,8 @@
 #include <cstdio>
 #include <stdio.h>
 
+#include <fastdds/config.h>
+
 
 // Constants for MD5Transform routine.
 #define S11 7
@@ -65,7 +67,8 @@ inline MD5::uint4 MD5::F(
         uint4 y,
         uint4 z)
 {
-    return (x & y) | (~x & z);
+    // Same as (x & y) | (~x & z), with one operation less.
+    return z ^ (x & (y ^ z));
 }
 
 inline MD5::uint4 MD5::G(
@@ -73,7 +76,8 @@ inline MD5::uint4 MD5::G(
         uint4 y,
         uint4 z)
 {
-    return (x & z) | (y & ~z);
+    // Same as (x & z) | (y & ~z), with one operation less.
+    return y ^ (z & (x ^ y));
 }
 
 inline MD5::uint4 MD5::H(
@@ -225,7 +229,12 @@ void MD5::transform(
         const uint1 block[blocksize])
 {
     uint4 a = state[0], b = state[1], c = state[2], d = state[3], x[16];
+#if FASTDDS_IS_BIG_ENDIAN_TARGET
     decode (x, block, blocksize);
+#else
+    // MD5 words are little endian, so they can be copied directly.
+    memcpy(x, block, blocksize);
+#endif // if FASTDDS_IS_BIG_ENDIAN_TARGET
 
     /* Round 1 */
     FF (a, b, c, d, x[ 0], S11, 0xd76aa478); /* 1 */
@@ -303,9 +312,6 @@ void MD5::transform(
     state[1] += b;
     state[2] += c;
     state[3] += d;
-
-    // Zeroize sensitive information.
-    memset(x, 0, sizeof x);
 }
 
 //////////////////////////////
@@ -930,7 +930,9 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     <xs:element name="scheduler" type="flowControllerSchedulerPolicy" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="max_bytes_per_period" type="int32" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="period_ms" type="uint64" minOccurs="0" maxOccurs="1"/>
+                    <xs:element name="max_burst_bytes" type="int32" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="sender_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                    <xs:element name="num_sender_threads" type="uint32" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
             </xs:complexType>
 
@@ -1012,11 +1014,31 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            else if (strcmp(name, MAX_BURST_BYTES) == 0)
+            {
+                // max_burst_bytes - int32Type
+                if (XMLP_ret::XML_OK != getXMLInt(p_aux1, &flow_controller_descriptor->max_burst_bytes, ident) ||
+                        0 >= flow_controller_descriptor->max_burst_bytes)
+                {
+                    EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid value for '" << MAX_BURST_BYTES << "'");
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, SENDER_THREAD) == 0)
             {
                 // sender_thread - threadSettingsType
                 getXMLThreadSettings(*p_aux1, flow_controller_descriptor->sender_thread);
             }
+            else if (strcmp(name, NUM_SENDER_THREADS) == 0)
+            {
+                // num_sender_threads - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux1, &flow_controller_descriptor->num_sender_threads, ident) ||
+                        0 == flow_controller_descriptor->num_sender_threads)
+                {
+                    EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid value for '" << NUM_SENDER_THREADS << "'");
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else
             {
                 EPROSIMA_LOG_ERROR(XMLPARSER,
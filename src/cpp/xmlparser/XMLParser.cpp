@@ -268,6 +268,8 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="receiveBufferSize" type="int32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="TTL" type="uint8Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="non_blocking_send" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="receive_batch_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_batch_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="interfaceWhiteList" type="stringListType" minOccurs="0" maxOccurs="1"/>
@@ -284,6 +286,7 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tcp_negotiation_timeout" type="uint32_t" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reactor_threads" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
@@ -356,6 +359,22 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        // Receive batch size
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(RECEIVE_BATCH_SIZE)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->receive_batch_size, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Send batch size
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(SEND_BATCH_SIZE)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->send_batch_size, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
     }
     else if (sType == TCPv4)
     {
@@ -454,6 +473,8 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, NETWORK_INTERFACES) == 0 ||
                 strcmp(name, TTL) == 0 ||
                 strcmp(name, NON_BLOCKING_SEND) == 0 ||
+                strcmp(name, RECEIVE_BATCH_SIZE) == 0 ||
+                strcmp(name, SEND_BATCH_SIZE) == 0 ||
                 strcmp(name, UDP_OUTPUT_PORT) == 0 ||
                 strcmp(name, TCP_WAN_ADDR) == 0 ||
                 strcmp(name, KEEP_ALIVE_FREQUENCY) == 0 ||
@@ -468,10 +489,12 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, ACCEPT_THREAD) == 0 ||
                 strcmp(name, ENABLE_TCP_NODELAY) == 0 ||
                 strcmp(name, TCP_NEGOTIATION_TIMEOUT) == 0 ||
+                strcmp(name, REACTOR_THREADS) == 0 ||
                 strcmp(name, TLS) == 0 ||
                 strcmp(name, SEGMENT_SIZE) == 0 ||
                 strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
                 strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 ||
+                strcmp(name, LISTENER_SPIN_TIME_US) == 0 ||
                 strcmp(name, RTPS_DUMP_FILE) == 0 ||
                 strcmp(name, DEFAULT_RECEPTION_THREADS) == 0 ||
                 strcmp(name, RECEPTION_THREADS) == 0 ||
@@ -880,6 +903,7 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="keep_alive_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="accept_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reactor_threads" type="uint32Type" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -1023,6 +1047,14 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                 }
                 pTCPDesc->tcp_negotiation_timeout = static_cast<uint32_t>(iTimeout);
             }
+            else if (strcmp(name, REACTOR_THREADS) == 0)
+            {
+                // reactor_threads - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->reactor_threads, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
         }
     }
     else
@@ -1046,6 +1078,7 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 <xs:element name="segment_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="port_queue_capacity" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="listener_spin_time_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="rtps_dump_file" type="stringType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="dump_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
@@ -1087,6 +1120,14 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->healthy_check_timeout_ms(static_cast<uint32_t>(aux));
             }
+            else if (strcmp(name, LISTENER_SPIN_TIME_US) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->listener_spin_time_us(static_cast<uint32_t>(aux));
+            }
             else if (strcmp(name, RTPS_DUMP_FILE) == 0)
             {
                 std::string str;
@@ -2551,6 +2592,14 @@ XMLP_ret XMLParser::fillDataNode(
             EPROSIMA_LOG_WARNING(XMLPARSER, "Ignoring '" << SECURITY_LOG_THREAD << "' since security is disabled");
 #endif // if HAVE_SECURITY
         }
+        else if (strcmp(name, PERSISTENCE_COMMIT_THREAD) == 0)
+        {
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(*p_aux0, participant_node.get()->rtps.persistence_commit_thread))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid element found into 'rtpsParticipantAttributesType'. Name: " << name);
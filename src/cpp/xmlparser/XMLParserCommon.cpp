@@ -47,6 +47,8 @@ const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
 const char* TTL = "TTL";
 const char* NON_BLOCKING_SEND = "non_blocking_send";
+const char* RECEIVE_BATCH_SIZE = "receive_batch_size";
+const char* SEND_BATCH_SIZE = "send_batch_size";
 const char* WHITE_LIST = "interfaceWhiteList";
 const char* NETWORK_INTERFACE = "interface";
 const char* NETMASK_FILTER = "netmask_filter";
@@ -68,11 +70,13 @@ const char* CHECK_CRC = "check_crc";
 const char* KEEP_ALIVE_THREAD = "keep_alive_thread";
 const char* ACCEPT_THREAD = "accept_thread";
 const char* TCP_NEGOTIATION_TIMEOUT = "tcp_negotiation_timeout";
+const char* REACTOR_THREADS = "reactor_threads";
 const char* SEGMENT_SIZE = "segment_size";
 const char* PORT_QUEUE_CAPACITY = "port_queue_capacity";
 const char* PORT_OVERFLOW_POLICY = "port_overflow_policy";
 const char* SEGMENT_OVERFLOW_POLICY = "segment_overflow_policy";
 const char* HEALTHY_CHECK_TIMEOUT_MS = "healthy_check_timeout_ms";
+const char* LISTENER_SPIN_TIME_US = "listener_spin_time_us";
 const char* DISCARD = "DISCARD";
 const char* FAIL = "FAIL";
 const char* RTPS_DUMP_FILE = "rtps_dump_file";
@@ -149,6 +153,7 @@ const char* TIMED_EVENTS_THREAD = "timed_events_thread";
 const char* DISCOVERY_SERVER_THREAD = "discovery_server_thread";
 const char* TYPELOOKUP_SERVICE_THREAD = "typelookup_service_thread";
 const char* SECURITY_LOG_THREAD = "security_log_thread";
+const char* PERSISTENCE_COMMIT_THREAD = "persistence_commit_thread";
 const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS = "builtin_transports_reception_threads";
 const char* BUILTIN_CONTROLLERS_SENDER_THREAD = "builtin_controllers_sender_thread";
 
@@ -286,6 +291,8 @@ const char* SCHEDULER = "scheduler";
 const char* SENDER_THREAD = "sender_thread";
 const char* MAX_BYTES_PER_PERIOD = "max_bytes_per_period";
 const char* PERIOD_MILLISECS = "period_ms";
+const char* MAX_BURST_BYTES = "max_burst_bytes";
+const char* NUM_SENDER_THREADS = "num_sender_threads";
 const char* FLOW_CONTROLLER_NAME = "flow_controller_name";
 const char* FIFO = "FIFO";
 const char* HIGH_PRIORITY = "HIGH_PRIORITY";
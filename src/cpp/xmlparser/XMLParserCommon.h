@@ -60,6 +60,8 @@ extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
 extern const char* NON_BLOCKING_SEND;
+extern const char* RECEIVE_BATCH_SIZE;
+extern const char* SEND_BATCH_SIZE;
 extern const char* WHITE_LIST;
 extern const char* NETWORK_INTERFACE;
 extern const char* NETMASK_FILTER;
@@ -81,11 +83,13 @@ extern const char* CHECK_CRC;
 extern const char* KEEP_ALIVE_THREAD;
 extern const char* ACCEPT_THREAD;
 extern const char* TCP_NEGOTIATION_TIMEOUT;
+extern const char* REACTOR_THREADS;
 extern const char* SEGMENT_SIZE;
 extern const char* PORT_QUEUE_CAPACITY;
 extern const char* PORT_OVERFLOW_POLICY;
 extern const char* SEGMENT_OVERFLOW_POLICY;
 extern const char* HEALTHY_CHECK_TIMEOUT_MS;
+extern const char* LISTENER_SPIN_TIME_US;
 extern const char* DISCARD;
 extern const char* FAIL;
 extern const char* RTPS_DUMP_FILE;
@@ -165,6 +169,7 @@ extern const char* TIMED_EVENTS_THREAD;
 extern const char* DISCOVERY_SERVER_THREAD;
 extern const char* TYPELOOKUP_SERVICE_THREAD;
 extern const char* SECURITY_LOG_THREAD;
+extern const char* PERSISTENCE_COMMIT_THREAD;
 extern const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS;
 extern const char* BUILTIN_CONTROLLERS_SENDER_THREAD;
 
@@ -304,6 +309,8 @@ extern const char* ROUND_ROBIN;
 extern const char* PRIORITY_WITH_RESERVATION;
 extern const char* FLOW_CONTROLLER_NAME;
 extern const char* PERIOD_MILLISECS;
+extern const char* MAX_BURST_BYTES;
+extern const char* NUM_SENDER_THREADS;
 extern const char* PORT_BASE;
 extern const char* DOMAIN_ID_GAIN;
 extern const char* PARTICIPANT_ID_GAIN;
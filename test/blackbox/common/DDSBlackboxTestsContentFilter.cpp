@@ -324,6 +324,11 @@ protected:
             EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(5)));
             EXPECT_EQ(reader->get_unread_count(), 0);
 
+            uint64_t evaluations = 0;
+            uint64_t evaluations_saved = 0;
+            EXPECT_EQ(RETCODE_OK,
+                    writer.get_native_writer().get_content_filter_evaluations(evaluations, evaluations_saved));
+
             // Send 10 samples with index 1 to 10
             auto data = default_helloworld_data_generator();
             writer.send(data);
@@ -375,6 +380,14 @@ protected:
             {
                 EXPECT_EQ(filter_counter.content_filter_info_count, filter_counter.user_data_count);
                 EXPECT_EQ(filter_counter.max_filter_signature_number, num_writer_filters);
+
+                // All the filtering readers share the same filter, so it is evaluated once per sample
+                uint64_t new_evaluations = 0;
+                uint64_t new_evaluations_saved = 0;
+                EXPECT_EQ(RETCODE_OK, writer.get_native_writer().get_content_filter_evaluations(
+                            new_evaluations, new_evaluations_saved));
+                EXPECT_EQ(evaluations + 10u, new_evaluations);
+                EXPECT_EQ(evaluations_saved + 10u * (num_writer_filters - 1u), new_evaluations_saved);
             }
             else
             {
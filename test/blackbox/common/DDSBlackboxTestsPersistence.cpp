@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdlib>
 #include <thread>
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
@@ -96,6 +97,8 @@ protected:
                 break;
         }
         std::remove(db_file_name_.c_str());
+        std::remove((db_file_name_ + "-wal").c_str());
+        std::remove((db_file_name_ + "-shm").c_str());
     }
 
     void fragment_data(
@@ -472,6 +475,71 @@ TEST_P(PersistenceLargeData, PubSubAsReliablePubPersistentWithStaticDiscovery)
     ASSERT_EQ(0u, reader.block_for_all(std::chrono::seconds(1)));
 }
 
+/*
+ * This test checks that the samples written before a call to flush_persistent_changes are recovered when the
+ * process ends abruptly, without destroying the DataWriter, even when they are stored asynchronously.
+ */
+TEST_P(PersistenceLargeData, PubSubAsReliablePubPersistentFlushBeforeAbruptExit)
+{
+    const std::string persistence_guid("78.73.69.74.65.72.5f.70.65.72.73.5f|67.75.69.5");
+
+    // Write the samples on a child process which exits right after flushing them, so the asynchronous queue of the
+    // persistence service is not drained on destruction. The delay ensures they are not stored before the flush.
+    ASSERT_EXIT(
+    {
+        PropertyPolicy async_commit;
+        async_commit.properties().emplace_back("dds.persistence.async_commit", "true");
+        async_commit.properties().emplace_back("dds.persistence.async_commit.max_delay_ms", "60000");
+
+        PubSubWriter<HelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+        writer
+                .history_kind(eprosima::fastdds::dds::KEEP_ALL_HISTORY_QOS)
+                .reliability(eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS)
+                .property_policy(async_commit)
+                .make_persistent(db_file_name(), persistence_guid)
+                .init();
+
+        if (!writer.isInitialized())
+        {
+            std::_Exit(EXIT_FAILURE);
+        }
+
+        auto data = default_helloworld_data_generator();
+        writer.send(data);
+
+        bool flushed = data.empty() &&
+                eprosima::fastdds::dds::RETCODE_OK == writer.get_native_writer().flush_persistent_changes();
+        std::_Exit(flushed ? EXIT_SUCCESS : EXIT_FAILURE);
+    }, ::testing::ExitedWithCode(EXIT_SUCCESS), "");
+
+    PubSubReader<HelloWorldPubSubType> reader(TEST_TOPIC_NAME);
+    reader
+            .reliability(eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS)
+            .durability_kind(eprosima::fastdds::dds::TRANSIENT_LOCAL_DURABILITY_QOS)
+            .init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    auto data = default_helloworld_data_generator();
+    reader.startReception(data);
+
+    // Load the persistent DataWriter with the samples stored by the child process
+    PubSubWriter<HelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+    writer
+            .history_kind(eprosima::fastdds::dds::KEEP_ALL_HISTORY_QOS)
+            .reliability(eprosima::fastdds::dds::RELIABLE_RELIABILITY_QOS)
+            .make_persistent(db_file_name(), persistence_guid)
+            .init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    // Every sample written before the flush should be received
+    reader.block_for_all();
+}
+
 
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
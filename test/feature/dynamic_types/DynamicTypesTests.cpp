@@ -14205,6 +14205,83 @@ TEST_F(DynamicTypesTests, TypeDescriptorFullyQualifiedName)
     ASSERT_FALSE(descriptor->is_consistent());
 }
 
+/*!
+ * Create, set, serialize and deserialize several samples of a structure mixing primitives, a string and a sequence,
+ * which is what routing applications do for each sample they forward.
+ */
+TEST_F(DynamicTypesTests, DynamicData_struct_round_trip)
+{
+    constexpr uint32_t num_samples = 100;
+
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name("RoundTripStruct");
+    DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+    ASSERT_TRUE(builder);
+
+    const std::array<TypeKind, 7> primitive_kinds {{TK_INT32, TK_UINT32, TK_INT64, TK_FLOAT64, TK_BOOLEAN, TK_CHAR8,
+                                                    TK_INT16}};
+    MemberId id {0};
+    for (TypeKind kind : primitive_kinds)
+    {
+        MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+        member_descriptor->type(factory->get_primitive_type(kind));
+        member_descriptor->name("member_" + std::to_string(id));
+        member_descriptor->id(id++);
+        ASSERT_EQ(RETCODE_OK, builder->add_member(member_descriptor));
+    }
+
+    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+    member_descriptor->type(factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+    member_descriptor->name("label");
+    member_descriptor->id(id++);
+    ASSERT_EQ(RETCODE_OK, builder->add_member(member_descriptor));
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->create_sequence_type(factory->get_primitive_type(TK_INT32),
+            static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+    member_descriptor->name("values");
+    member_descriptor->id(id++);
+    ASSERT_EQ(RETCODE_OK, builder->add_member(member_descriptor));
+
+    DynamicType::_ref_type struct_type {builder->build()};
+    ASSERT_TRUE(struct_type);
+
+    TypeSupport pubsubType {new DynamicPubSubType(struct_type)};
+    const Int32Seq values(16, 3);
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        DynamicData::_ref_type sample {DynamicDataFactory::get_instance()->create_data(struct_type)};
+        ASSERT_TRUE(sample);
+        ASSERT_EQ(RETCODE_OK, sample->set_int32_value(0, static_cast<int32_t>(i)));
+        ASSERT_EQ(RETCODE_OK, sample->set_uint32_value(1, i));
+        ASSERT_EQ(RETCODE_OK, sample->set_int64_value(2, i));
+        ASSERT_EQ(RETCODE_OK, sample->set_float64_value(3, i * 0.5));
+        ASSERT_EQ(RETCODE_OK, sample->set_boolean_value(4, 0 == i % 2));
+        ASSERT_EQ(RETCODE_OK, sample->set_char8_value(5, 'a'));
+        ASSERT_EQ(RETCODE_OK, sample->set_int16_value(6, 16));
+        ASSERT_EQ(RETCODE_OK, sample->set_string_value(7, "sample label"));
+        ASSERT_EQ(RETCODE_OK, sample->set_int32_values(8, values));
+
+        int32_t int32_value {0};
+        ASSERT_EQ(RETCODE_OK, sample->get_int32_value(int32_value, 0));
+        EXPECT_EQ(static_cast<int32_t>(i), int32_value);
+        std::string string_value;
+        ASSERT_EQ(RETCODE_OK, sample->get_string_value(string_value, 7));
+        EXPECT_EQ("sample label", string_value);
+
+        SerializedPayload_t payload(
+            static_cast<uint32_t>(pubsubType.get_serialized_size_provider(&sample, XCDR2_DATA_REPRESENTATION)()));
+        ASSERT_TRUE(pubsubType.serialize(&sample, &payload, XCDR2_DATA_REPRESENTATION));
+
+        DynamicData::_ref_type received {DynamicDataFactory::get_instance()->create_data(struct_type)};
+        ASSERT_TRUE(pubsubType.deserialize(&payload, &received));
+        EXPECT_TRUE(received->equals(sample));
+    }
+}
+
 int main(
         int argc,
         char** argv)
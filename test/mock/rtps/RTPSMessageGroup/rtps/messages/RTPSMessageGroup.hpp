@@ -68,6 +68,8 @@ public:
 
     MOCK_METHOD0(reset_current_bytes_processed, void());
 
+    MOCK_METHOD0(get_size_exceeding_limitation, uint32_t());
+
     void sender(
             Endpoint*,
             const RTPSMessageSenderInterface*) const
@@ -226,6 +226,11 @@ public:
         return true;
     }
 
+    virtual bool flush_persistent_changes()
+    {
+        return true;
+    }
+
     virtual bool process_acknack(
             const GUID_t& writer_guid,
             const GUID_t& reader_guid,
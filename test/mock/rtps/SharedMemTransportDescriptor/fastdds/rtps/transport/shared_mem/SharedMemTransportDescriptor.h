@@ -110,6 +110,17 @@ typedef struct SharedMemTransportDescriptor : public PortBasedTransportDescripto
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    FASTDDS_EXPORTED_API uint32_t listener_spin_time_us() const
+    {
+        return listener_spin_time_us_;
+    }
+
+    FASTDDS_EXPORTED_API void listener_spin_time_us(
+            uint32_t listener_spin_time_us)
+    {
+        listener_spin_time_us_ = listener_spin_time_us;
+    }
+
     //! Return the thread settings for the transport dump thread
     FASTDDS_EXPORTED_API ThreadSettings dump_thread() const
     {
@@ -129,6 +140,7 @@ private:
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    uint32_t listener_spin_time_us_ = 0;
     ThreadSettings dump_thread_;
 
 }SharedMemTransportDescriptor;
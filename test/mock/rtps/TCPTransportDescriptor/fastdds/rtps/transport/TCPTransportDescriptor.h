@@ -181,6 +181,8 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
 
     uint32_t tcp_negotiation_timeout;
 
+    uint32_t reactor_threads = 0;
+
     void add_listener_port(
             uint16_t port)
     {
@@ -52,7 +52,8 @@ public:
 
     virtual ~WriterHistory() = default;
 
-    using iterator = std::vector<CacheChange_t*>::iterator;
+    using ChangeCollection = std::vector<CacheChange_t*>;
+    using iterator = ChangeCollection::iterator;
 
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD1(add_change_mock, bool(CacheChange_t*));
@@ -202,7 +203,7 @@ public:
     }
 
     HistoryAttributes m_att;
-    std::vector<CacheChange_t*> m_changes;
+    ChangeCollection m_changes;
 
     std::condition_variable samples_number_cond_;
     std::mutex samples_number_mutex_;
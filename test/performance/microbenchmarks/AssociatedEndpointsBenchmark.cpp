@@ -0,0 +1,247 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fastdds/rtps/common/EntityId_t.hpp>
+
+#include <rtps/messages/AssociatedEndpoints.hpp>
+#include <utils/shared_mutex.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+struct BenchmarkEndpoint
+{
+    EntityId_t entity_id;
+    std::atomic<uint64_t> calls{0};
+};
+
+static EntityId_t make_entity_id(
+        uint32_t key)
+{
+    EntityId_t ret;
+    ret.value[0] = static_cast<octet>(key >> 16);
+    ret.value[1] = static_cast<octet>(key >> 8);
+    ret.value[2] = static_cast<octet>(key);
+    ret.value[3] = 0x07;
+    return ret;
+}
+
+//! Previous implementation on MessageReceiver: an std::unordered_map protected by a shared_mutex
+class MapEndpoints
+{
+public:
+
+    void add(
+            const EntityId_t& entity_id,
+            BenchmarkEndpoint* endpoint)
+    {
+        std::lock_guard<eprosima::shared_mutex> guard(mtx_);
+        map_[entity_id].push_back(endpoint);
+    }
+
+    void remove(
+            BenchmarkEndpoint* endpoint)
+    {
+        std::lock_guard<eprosima::shared_mutex> guard(mtx_);
+        auto it = map_.find(endpoint->entity_id);
+        if (it != map_.end())
+        {
+            for (auto ep = it->second.begin(); ep != it->second.end(); ++ep)
+            {
+                if (*ep == endpoint)
+                {
+                    it->second.erase(ep);
+                    break;
+                }
+            }
+            if (it->second.empty())
+            {
+                map_.erase(it);
+            }
+        }
+    }
+
+    template<typename Functor>
+    void for_each(
+            const EntityId_t& entity_id,
+            const Functor& callback) const
+    {
+        eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
+        auto it = map_.find(entity_id);
+        if (it != map_.end())
+        {
+            for (BenchmarkEndpoint* endpoint : it->second)
+            {
+                callback(endpoint);
+            }
+        }
+    }
+
+private:
+
+    mutable eprosima::shared_mutex mtx_;
+    std::unordered_map<EntityId_t, std::vector<BenchmarkEndpoint*>> map_;
+};
+
+//! AssociatedEndpoints, with the interface of MapEndpoints
+class SnapshotEndpoints
+{
+public:
+
+    void add(
+            const EntityId_t& entity_id,
+            BenchmarkEndpoint* endpoint)
+    {
+        endpoints_.add(entity_id, endpoint);
+    }
+
+    void remove(
+            BenchmarkEndpoint* endpoint)
+    {
+        endpoints_.remove(endpoint);
+    }
+
+    template<typename Functor>
+    void for_each(
+            const EntityId_t& entity_id,
+            const Functor& callback) const
+    {
+        AssociatedEndpoints<BenchmarkEndpoint>::ReadGuard guard(endpoints_);
+        guard->for_each(entity_id, callback);
+    }
+
+private:
+
+    AssociatedEndpoints<BenchmarkEndpoint> endpoints_;
+};
+
+struct Result
+{
+    double ns_per_submessage;
+    uint64_t updates;
+};
+
+/**
+ * Each receive thread looks up the destination readers of a number of submessages, while another thread optionally
+ * associates and removes a reader in a loop, as discovery does.
+ */
+template<typename Endpoints>
+Result run_scenario(
+        uint32_t num_readers,
+        uint32_t num_receive_threads,
+        bool churn)
+{
+    using clock = std::chrono::steady_clock;
+    constexpr uint32_t num_submessages = 1000000;
+
+    std::deque<BenchmarkEndpoint> storage(num_readers + 1);
+    std::vector<EntityId_t> entity_ids;
+    Endpoints endpoints;
+    for (uint32_t i = 0; i < num_readers + 1; ++i)
+    {
+        storage[i].entity_id = make_entity_id(i + 1);
+        entity_ids.push_back(storage[i].entity_id);
+    }
+    entity_ids.pop_back();
+    for (uint32_t i = 0; i < num_readers; ++i)
+    {
+        endpoints.add(storage[i].entity_id, &storage[i]);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> updates{0};
+    std::thread updater;
+    if (churn)
+    {
+        BenchmarkEndpoint* extra = &storage[num_readers];
+        updater = std::thread([&]()
+                        {
+                            while (!stop.load(std::memory_order_relaxed))
+                            {
+                                endpoints.add(extra->entity_id, extra);
+                                endpoints.remove(extra);
+                                updates.fetch_add(1, std::memory_order_relaxed);
+                            }
+                        });
+    }
+
+    auto process = [](BenchmarkEndpoint* endpoint)
+            {
+                endpoint->calls.fetch_add(1, std::memory_order_relaxed);
+            };
+
+    auto start = clock::now();
+    std::vector<std::thread> receivers;
+    for (uint32_t t = 0; t < num_receive_threads; ++t)
+    {
+        receivers.emplace_back([&, t]()
+                {
+                    for (uint32_t n = 0; n < num_submessages; ++n)
+                    {
+                        endpoints.for_each(entity_ids[(n + t) % num_readers], process);
+                    }
+                });
+    }
+    for (auto& receiver : receivers)
+    {
+        receiver.join();
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    stop = true;
+    if (updater.joinable())
+    {
+        updater.join();
+    }
+
+    return {elapsed / (static_cast<double>(num_submessages) * num_receive_threads), updates.load()};
+}
+
+/**
+ * Measures the lookup of the destination readers of a submessage on MessageReceiver, with AssociatedEndpoints and
+ * with the std::unordered_map protected by a shared_mutex previously used, with and without contention.
+ */
+int main()
+{
+    std::printf("Hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    for (uint32_t num_readers : {2u, 64u})
+    {
+        for (uint32_t num_receive_threads : {1u, 4u})
+        {
+            for (bool churn : {false, true})
+            {
+                Result map = run_scenario<MapEndpoints>(num_readers, num_receive_threads, churn);
+                Result snapshot = run_scenario<SnapshotEndpoints>(num_readers, num_receive_threads, churn);
+                std::printf("%2u readers, %u receive threads, %-11s: shared_mutex + unordered_map %6.1f ns, "
+                        "snapshot %6.1f ns per submessage (updates: %llu vs %llu)\n",
+                        num_readers, num_receive_threads, churn ? "with churn" : "no churn",
+                        map.ns_per_submessage, snapshot.ns_per_submessage,
+                        static_cast<unsigned long long>(map.updates),
+                        static_cast<unsigned long long>(snapshot.updates));
+            }
+        }
+    }
+
+    return 0;
+}
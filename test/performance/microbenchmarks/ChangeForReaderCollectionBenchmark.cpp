@@ -0,0 +1,173 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/utils/collections/ResourceLimitedVector.hpp>
+
+#include <rtps/writer/ChangeForReaderCollection.hpp>
+
+using namespace eprosima::fastdds;
+using namespace eprosima::fastdds::rtps;
+
+/**
+ * Reliable writer with 256 matched readers and a full history. For each written sample, every reader acknowledges
+ * the oldest change, and periodically some changes are requested by a NACK and then resent.
+ * Compares the previous collection of ReaderProxy, a ResourceLimitedVector searched with std::lower_bound, against
+ * ChangeForReaderCollection.
+ */
+int main()
+{
+    using clock = std::chrono::steady_clock;
+    using OldCollection = ResourceLimitedVector<ChangeForReader_t, std::true_type>;
+    constexpr size_t num_readers = 256;
+    constexpr uint32_t nack_period = 8;
+
+    auto less_than_sequence = [](const ChangeForReader_t& change, const SequenceNumber_t& seq_num)
+            {
+                return change.getSequenceNumber() < seq_num;
+            };
+
+    for (uint32_t depth : {1000u, 10000u})
+    {
+        uint32_t num_writes = 1000000u / depth;
+        std::vector<OldCollection> old_readers;
+        std::vector<ChangeForReaderCollection> new_readers;
+        for (size_t r = 0; r < num_readers; ++r)
+        {
+            old_readers.emplace_back(ResourceLimitedContainerConfig(depth + 1));
+            new_readers.emplace_back(ResourceLimitedContainerConfig(depth + 1));
+        }
+        std::vector<CacheChange_t> history(depth + num_writes);
+        for (uint32_t i = 0; i < history.size(); ++i)
+        {
+            history[i].sequenceNumber = SequenceNumber_t(0, i + 1);
+        }
+        for (uint32_t i = 0; i < depth; ++i)
+        {
+            ChangeForReader_t change(&history[i]);
+            change.setStatus(UNACKNOWLEDGED);
+            for (size_t r = 0; r < num_readers; ++r)
+            {
+                old_readers[r].push_back(change);
+                new_readers[r].push_back(change);
+            }
+        }
+
+        std::mt19937 rng(1);
+        std::vector<std::vector<uint32_t>> requests(num_writes / nack_period + 1);
+        for (auto& request : requests)
+        {
+            for (int n = 0; n < 4; ++n)
+            {
+                request.push_back(static_cast<uint32_t>(rng() % 256));
+            }
+        }
+
+        uint32_t old_resent = 0;
+        auto start = clock::now();
+        for (uint32_t w = 0; w < num_writes; ++w)
+        {
+            ChangeForReader_t change(&history[depth + w]);
+            change.setStatus(UNACKNOWLEDGED);
+            SequenceNumber_t acked = history[w + 1].sequenceNumber;
+            for (OldCollection& changes : old_readers)
+            {
+                changes.push_back(change);
+                auto it = std::lower_bound(changes.begin(), changes.end(), acked, less_than_sequence);
+                changes.erase(changes.begin(), it);
+                if (0 == w % nack_period)
+                {
+                    for (uint32_t offset : requests[w / nack_period])
+                    {
+                        SequenceNumber_t seq = acked + offset;
+                        it = std::lower_bound(changes.begin(), changes.end(), seq, less_than_sequence);
+                        if (it != changes.end() && it->getSequenceNumber() == seq && UNACKNOWLEDGED == it->getStatus())
+                        {
+                            it->setStatus(REQUESTED);
+                        }
+                    }
+                }
+            }
+            for (OldCollection& changes : old_readers)
+            {
+                for (ChangeForReader_t& c : changes)
+                {
+                    if (REQUESTED == c.getStatus())
+                    {
+                        c.setStatus(UNACKNOWLEDGED);
+                        ++old_resent;
+                    }
+                }
+            }
+        }
+        double old_us = std::chrono::duration<double, std::micro>(clock::now() - start).count() / num_writes;
+
+        uint32_t new_resent = 0;
+        start = clock::now();
+        for (uint32_t w = 0; w < num_writes; ++w)
+        {
+            ChangeForReader_t change(&history[depth + w]);
+            change.setStatus(UNACKNOWLEDGED);
+            SequenceNumber_t acked = history[w + 1].sequenceNumber;
+            for (ChangeForReaderCollection& changes : new_readers)
+            {
+                changes.push_back(change);
+                changes.erase(changes.begin(), changes.lower_bound(acked));
+                if (0 == w % nack_period)
+                {
+                    for (uint32_t offset : requests[w / nack_period])
+                    {
+                        auto it = changes.find(acked + offset);
+                        if (it != changes.end() && UNACKNOWLEDGED == it->getStatus())
+                        {
+                            changes.set_status(it, REQUESTED);
+                        }
+                    }
+                }
+            }
+            for (ChangeForReaderCollection& changes : new_readers)
+            {
+                uint32_t to_change = changes.count(REQUESTED);
+                for (auto it = changes.begin(); 0 < to_change; ++it)
+                {
+                    if (REQUESTED == it->getStatus())
+                    {
+                        changes.set_status(it, UNACKNOWLEDGED);
+                        --to_change;
+                        ++new_resent;
+                    }
+                }
+            }
+        }
+        double new_us = std::chrono::duration<double, std::micro>(clock::now() - start).count() / num_writes;
+
+        if (old_resent != new_resent)
+        {
+            std::printf("depth %u: resent changes differ (%u vs %u)\n", depth, old_resent, new_resent);
+            return 1;
+        }
+
+        std::printf("256 readers, depth %u: ResourceLimitedVector %.1f us, ChangeForReaderCollection %.1f us per write\n",
+                depth, old_us, new_us);
+    }
+
+    return 0;
+}
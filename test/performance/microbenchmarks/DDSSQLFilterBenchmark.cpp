@@ -0,0 +1,144 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp>
+
+using namespace eprosima::fastdds::dds;
+
+/**
+ * Measures the cost of evaluating a DDS-SQL filter on a type with 100 members, directly on the CDR payload and
+ * after deserializing it into a DynamicData.
+ */
+int main()
+{
+    constexpr uint32_t num_members = 100;
+    constexpr int num_iterations = 10000;
+
+    DynamicTypeBuilderFactory::_ref_type type_factory {DynamicTypeBuilderFactory::get_instance()};
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name("LargeFilterTestType");
+    DynamicTypeBuilder::_ref_type builder {type_factory->create_type(type_descriptor)};
+    for (uint32_t i = 0; i < num_members; ++i)
+    {
+        MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+        member_descriptor->name("m_" + std::to_string(i));
+        switch (i % 3)
+        {
+            case 0:
+                member_descriptor->type(type_factory->get_primitive_type(TK_INT32));
+                break;
+            case 1:
+                member_descriptor->type(type_factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->
+                                build());
+                break;
+            default:
+                member_descriptor->type(type_factory->create_sequence_type(
+                            type_factory->get_primitive_type(TK_FLOAT64),
+                            static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+                break;
+        }
+        builder->add_member(member_descriptor);
+    }
+    DynamicType::_ref_type type {builder->build()};
+
+    xtypes::TypeIdentifierPair type_ids;
+    if (RETCODE_OK != DomainParticipantFactory::get_instance()->type_object_registry().
+                    register_typeobject_w_dynamic_type(type, type_ids))
+    {
+        printf("Unable to register the type\n");
+        return 1;
+    }
+
+    DynamicPubSubType type_support(type);
+    std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> payloads;
+    for (int32_t value : {99, 98})
+    {
+        DynamicData::_ref_type data {DynamicDataFactory::get_instance()->create_data(type)};
+        for (uint32_t i = 0; i < num_members; ++i)
+        {
+            MemberId id = data->get_member_id_by_name("m_" + std::to_string(i));
+            switch (i % 3)
+            {
+                case 0:
+                    data->set_int32_value(id, 99 == i ? value : static_cast<int32_t>(i));
+                    break;
+                case 1:
+                    data->set_string_value(id, "value_" + std::to_string(i));
+                    break;
+                default:
+                    data->set_float64_values(id, Float64Seq(i % 7, 3.14159));
+                    break;
+            }
+        }
+
+        for (DataRepresentationId_t representation : {XCDR_DATA_REPRESENTATION, XCDR2_DATA_REPRESENTATION})
+        {
+            uint32_t size = type_support.getSerializedSizeProvider(&data, representation)();
+            payloads.emplace_back(new IContentFilter::SerializedPayload(size));
+            type_support.serialize(&data, payloads.back().get(), representation);
+        }
+    }
+
+    DDSSQLFilter::DDSFilterFactory factory;
+    IContentFilterFactory::ParameterSeq params;
+    IContentFilter* filter = nullptr;
+    if (RETCODE_OK != factory.create_content_filter("DDSSQL", "LargeFilterTestType", &type_support,
+            "m_99 = 99 AND m_49 LIKE 'value_%'", params, filter))
+    {
+        printf("Unable to create the filter\n");
+        return 1;
+    }
+
+    IContentFilter::FilterSampleInfo info;
+    eprosima::fastdds::rtps::GUID_t guid;
+    size_t accepted = 0;
+    auto run = [&]() -> double
+            {
+                auto start = std::chrono::steady_clock::now();
+                for (int n = 0; n < num_iterations; ++n)
+                {
+                    for (size_t i = 0; i < payloads.size(); ++i)
+                    {
+                        accepted += filter->evaluate(*payloads[i], info, guid) ? 1 : 0;
+                    }
+                }
+                std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+                return elapsed.count() / (num_iterations * payloads.size());
+            };
+
+    auto expression = static_cast<DDSSQLFilter::DDSFilterExpression*>(filter);
+    bool has_plan = expression->has_plan();
+    double plan_time = run();
+    expression->compile_plan(xtypes::TypeObject());
+    double dynamic_data_time = run();
+    printf("Evaluation on CDR payload%s: %.3f us, evaluation on DynamicData: %.3f us (%zu samples accepted)\n",
+            has_plan ? "" : " (plan not compiled)", plan_time, dynamic_data_time, accepted);
+
+    factory.delete_content_filter("DDSSQL", filter);
+    return 0;
+}
@@ -0,0 +1,238 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastdds::rtps::InstanceHandle_t;
+using eprosima::fastdds::rtps::SerializedPayload_t;
+
+struct BenchmarkSample
+{
+    uint32_t index = 0;
+    std::array<char, 256> message {};
+};
+
+FASTDDS_SEQUENCE(BenchmarkSampleSeq, BenchmarkSample);
+
+/**
+ * Type whose deserialization takes 20 us, as a type with many strings or sequences would.
+ */
+class SlowBenchmarkType : public TopicDataType
+{
+public:
+
+    SlowBenchmarkType()
+    {
+        setName("SlowBenchmarkType");
+        m_typeSize = 4u + static_cast<uint32_t>(sizeof(BenchmarkSample));
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        if (payload->max_size < m_typeSize)
+        {
+            return false;
+        }
+
+        // Little endian encapsulation followed by the raw sample
+        payload->data[0] = 0;
+        payload->data[1] = 1;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        memcpy(payload->data + 4, data, sizeof(BenchmarkSample));
+        payload->encapsulation = CDR_LE;
+        payload->length = m_typeSize;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        if (payload->length < m_typeSize)
+        {
+            return false;
+        }
+
+        auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(20);
+        while (std::chrono::steady_clock::now() < end)
+        {
+        }
+
+        memcpy(data, payload->data + 4, sizeof(BenchmarkSample));
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*,
+            DataRepresentationId_t) override
+    {
+        return [this]()
+               {
+                   return m_typeSize;
+               };
+    }
+
+    void* createData() override
+    {
+        return new BenchmarkSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BenchmarkSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+/**
+ * Measures how long the reception of a sample is blocked while another thread takes batches of samples which are
+ * expensive to deserialize.
+ * With synchronous intraprocess delivery, samples are received on the thread calling write, so the time spent in
+ * write includes the time waiting for the reader mutex.
+ */
+int main()
+{
+    constexpr int32_t num_samples = 20000;
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::printf("could not create the participant\n");
+        return 1;
+    }
+
+    TypeSupport type(new SlowBenchmarkType());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("DataReaderTakeBenchmark", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = 1;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.resource_limits().max_instances = 1;
+    reader_qos.resource_limits().max_samples_per_instance = num_samples;
+    reader_qos.resource_limits().max_samples = num_samples;
+
+    for (int32_t batch_size : {1, 10, 100})
+    {
+        DataWriter* writer = publisher->create_datawriter(topic, writer_qos);
+        DataReader* reader = subscriber->create_datareader(topic, reader_qos);
+
+        std::atomic<int32_t> taken {0};
+        std::atomic<bool> writing {true};
+        std::thread taker([&]()
+                {
+                    BenchmarkSampleSeq data_seq(batch_size);
+                    SampleInfoSeq info_seq(batch_size);
+                    while (writing || taken < num_samples)
+                    {
+                        if (RETCODE_OK == reader->take(data_seq, info_seq, batch_size))
+                        {
+                            taken += data_seq.length();
+                        }
+                        else if (!writing)
+                        {
+                            break;
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+
+        BenchmarkSample sample;
+        std::chrono::steady_clock::duration max_write_time {0};
+        std::chrono::steady_clock::duration total_write_time {0};
+        for (int32_t i = 0; i < num_samples; ++i)
+        {
+            sample.index = static_cast<uint32_t>(i);
+            auto start = std::chrono::steady_clock::now();
+            writer->write(&sample);
+            auto write_time = std::chrono::steady_clock::now() - start;
+            total_write_time += write_time;
+            max_write_time = (std::max)(max_write_time, write_time);
+        }
+        writing = false;
+        taker.join();
+
+        std::printf("batches of %d samples: %d taken, write average %.1f us, max %.1f us\n", batch_size,
+                taken.load(), std::chrono::duration<double, std::micro>(total_write_time).count() / num_samples,
+                std::chrono::duration<double, std::micro>(max_write_time).count());
+
+        subscriber->delete_datareader(reader);
+        publisher->delete_datawriter(writer);
+    }
+
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+    return 0;
+}
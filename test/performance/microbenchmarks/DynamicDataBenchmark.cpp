@@ -0,0 +1,163 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastdds::rtps::SerializedPayload_t;
+
+/**
+ * Build a structure mixing primitives, a string and a sequence.
+ */
+static DynamicType::_ref_type create_struct_type(
+        MemberId& num_members)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name("BenchmarkStruct");
+    DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+
+    const std::array<TypeKind, 7> primitive_kinds {{TK_INT32, TK_UINT32, TK_INT64, TK_FLOAT64, TK_BOOLEAN, TK_CHAR8,
+                                                    TK_INT16}};
+    MemberId id {0};
+    for (TypeKind kind : primitive_kinds)
+    {
+        MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+        member_descriptor->type(factory->get_primitive_type(kind));
+        member_descriptor->name("member_" + std::to_string(id));
+        member_descriptor->id(id++);
+        builder->add_member(member_descriptor);
+    }
+
+    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+    member_descriptor->type(factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+    member_descriptor->name("label");
+    member_descriptor->id(id++);
+    builder->add_member(member_descriptor);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->create_sequence_type(factory->get_primitive_type(TK_INT32),
+            static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+    member_descriptor->name("values");
+    member_descriptor->id(id++);
+    builder->add_member(member_descriptor);
+
+    num_members = id;
+    return builder->build();
+}
+
+/**
+ * Measures the time spent creating, setting, serializing and deserializing a DynamicData structure, which is what
+ * routing applications do for each sample they forward.
+ */
+int main()
+{
+    using clock = std::chrono::steady_clock;
+    constexpr uint32_t num_samples = 20000;
+
+    MemberId num_members {0};
+    DynamicType::_ref_type struct_type {create_struct_type(num_members)};
+    if (!struct_type)
+    {
+        std::printf("Error building the structure type\n");
+        return 1;
+    }
+
+    std::vector<DynamicData::_ref_type> samples(num_samples);
+    auto start = clock::now();
+    for (auto& sample : samples)
+    {
+        sample = DynamicDataFactory::get_instance()->create_data(struct_type);
+    }
+    double create_us = std::chrono::duration<double, std::micro>(clock::now() - start).count() / num_samples;
+
+    const Int32Seq values(16, 3);
+    start = clock::now();
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        DynamicData::_ref_type& sample = samples[i];
+        sample->set_int32_value(0, static_cast<int32_t>(i));
+        sample->set_uint32_value(1, i);
+        sample->set_int64_value(2, i);
+        sample->set_float64_value(3, i * 0.5);
+        sample->set_boolean_value(4, 0 == i % 2);
+        sample->set_char8_value(5, 'a');
+        sample->set_int16_value(6, 16);
+        sample->set_string_value(7, "sample label");
+        sample->set_int32_values(8, values);
+    }
+    double set_us = std::chrono::duration<double, std::micro>(clock::now() - start).count() / num_samples;
+
+    TypeSupport pubsubType {new DynamicPubSubType(struct_type)};
+    uint32_t payload_size =
+            static_cast<uint32_t>(pubsubType.get_serialized_size_provider(&samples.front(),
+            XCDR2_DATA_REPRESENTATION)());
+    std::vector<SerializedPayload_t> payloads;
+    payloads.reserve(num_samples);
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        payloads.emplace_back(payload_size);
+    }
+
+    start = clock::now();
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        pubsubType.serialize(&samples[i], &payloads[i], XCDR2_DATA_REPRESENTATION);
+    }
+    double serialize_us = std::chrono::duration<double, std::micro>(clock::now() - start).count() / num_samples;
+
+    std::vector<DynamicData::_ref_type> received(num_samples);
+    for (auto& sample : received)
+    {
+        sample = DynamicDataFactory::get_instance()->create_data(struct_type);
+    }
+    start = clock::now();
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        pubsubType.deserialize(&payloads[i], &received[i]);
+    }
+    double deserialize_us = std::chrono::duration<double, std::micro>(clock::now() - start).count() / num_samples;
+
+    for (uint32_t i = 0; i < num_samples; i += num_samples / 10)
+    {
+        if (!received[i]->equals(samples[i]))
+        {
+            std::printf("Sample %u was not deserialized correctly\n", i);
+            return 1;
+        }
+    }
+
+    std::printf("DynamicData struct of %u members: create %.2f us, set %.2f us, serialize %.2f us, "
+            "deserialize %.2f us per sample\n", num_members, create_us, set_us, serialize_us, deserialize_us);
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
+
+#include <fastdds/publisher/filtering/DataWriterFilteredChange.hpp>
+#include <fastdds/publisher/filtering/ReaderFilterCollection.hpp>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastdds::ResourceLimitedContainerConfig;
+using eprosima::fastdds::rtps::ContentFilterProperty;
+using eprosima::fastdds::rtps::GUID_t;
+using eprosima::fastdds::rtps::SampleIdentity;
+
+/**
+ * Gives access to the implementation of a DomainParticipant, needed to register reader filters.
+ */
+class DomainParticipantAccess : public DomainParticipant
+{
+public:
+
+    DomainParticipantImpl* get_impl() const
+    {
+        return impl_;
+    }
+
+};
+
+/**
+ * Measures the cost of the writer-side filtering of a sample for 200 readers using the built-in DDS-SQL filter, when
+ * they share 5 filters, so the result of each filter is reused by 40 readers, and when each reader has a filter of
+ * its own, so all of them are evaluated.
+ */
+int main()
+{
+    constexpr uint32_t num_readers = 200;
+    constexpr uint32_t num_shared_filters = 5;
+    constexpr uint32_t num_samples = 10000;
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::printf("could not create the participant\n");
+        return 1;
+    }
+
+    DynamicTypeBuilderFactory::_ref_type type_factory {DynamicTypeBuilderFactory::get_instance()};
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name("FilterDedupBenchmarkType");
+    DynamicTypeBuilder::_ref_type builder {type_factory->create_type(type_descriptor)};
+    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+    member_descriptor->name("index");
+    member_descriptor->type(type_factory->get_primitive_type(TK_INT32));
+    builder->add_member(member_descriptor);
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->name("message");
+    member_descriptor->type(type_factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+    builder->add_member(member_descriptor);
+    DynamicType::_ref_type type {builder->build()};
+
+    xtypes::TypeIdentifierPair type_ids;
+    TypeSupport type_support(new DynamicPubSubType(type));
+    Topic* topic = nullptr;
+    if (RETCODE_OK == DomainParticipantFactory::get_instance()->type_object_registry().
+                    register_typeobject_w_dynamic_type(type, type_ids) &&
+            RETCODE_OK == type_support.register_type(participant))
+    {
+        topic = participant->create_topic("FilterDedupBenchmark", type_support.get_type_name(), TOPIC_QOS_DEFAULT);
+    }
+    if (nullptr == topic)
+    {
+        std::printf("could not create the topic\n");
+        DomainParticipantFactory::get_instance()->delete_participant(participant);
+        return 1;
+    }
+
+    // The sample being filtered
+    DynamicData::_ref_type data {DynamicDataFactory::get_instance()->create_data(type)};
+    data->set_int32_value(data->get_member_id_by_name("index"), 100);
+    data->set_string_value(data->get_member_id_by_name("message"), "message_100");
+
+    DataWriterFilteredChange change(ResourceLimitedContainerConfig(0, num_readers));
+    change.kind = eprosima::fastdds::rtps::ALIVE;
+    change.writerGUID.entityId = eprosima::fastdds::rtps::EntityId_t(0x100 + 0x02);
+    uint32_t size = type_support.get_serialized_size_provider(&data, XCDR2_DATA_REPRESENTATION)();
+    change.serializedPayload.reserve(size);
+    if (!type_support.serialize(&data, &change.serializedPayload, XCDR2_DATA_REPRESENTATION))
+    {
+        std::printf("could not serialize the sample\n");
+        participant->delete_contained_entities();
+        DomainParticipantFactory::get_instance()->delete_participant(participant);
+        return 1;
+    }
+
+    DomainParticipantImpl* participant_impl = static_cast<DomainParticipantAccess*>(participant)->get_impl();
+    ContentFilterProperty::AllocationConfiguration filter_allocation;
+
+    int ret = 0;
+    for (uint32_t num_filters : {num_shared_filters, num_readers})
+    {
+        ReaderFilterCollection reader_filters(ResourceLimitedContainerConfig(0, num_readers));
+
+        // Readers using the same parameter share the filter signature
+        ContentFilterProperty filter_property(filter_allocation);
+        filter_property.content_filtered_topic_name = "FilterDedupBenchmarkFiltered";
+        filter_property.related_topic_name = "FilterDedupBenchmark";
+        filter_property.filter_class_name = FASTDDS_SQLFILTER_NAME;
+        filter_property.filter_expression = "index >= %0 AND message LIKE 'message_%'";
+        for (uint32_t i = 0; i < num_readers; ++i)
+        {
+            GUID_t reader_guid;
+            reader_guid.entityId = eprosima::fastdds::rtps::EntityId_t((i + 1) * 0x100 + 0x07);
+            filter_property.expression_parameters.clear();
+            filter_property.expression_parameters.push_back(std::to_string(50 * (i % num_filters)));
+            reader_filters.process_reader_filter_info(reader_guid, filter_property, participant_impl, topic);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t n = 0; n < num_samples; ++n)
+        {
+            change.sequenceNumber = eprosima::fastdds::rtps::SequenceNumber_t(0, n + 1);
+            change.inline_qos.length = 0;
+            change.inline_qos.pos = 0;
+            reader_filters.update_filter_info(change, SampleIdentity::unknown());
+        }
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+        if (num_readers * num_samples !=
+                reader_filters.filter_evaluations() + reader_filters.filter_evaluations_saved())
+        {
+            std::printf("the filters of some readers were not applied\n");
+            ret = 1;
+            break;
+        }
+
+        std::printf("%u readers with %u filters: %.3f us per sample, %.1f evaluations per sample, "
+                "%llu evaluations saved\n", num_readers, num_filters, elapsed.count() / num_samples,
+                static_cast<double>(reader_filters.filter_evaluations()) / num_samples,
+                static_cast<unsigned long long>(reader_filters.filter_evaluations_saved()));
+    }
+
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+    return ret;
+}
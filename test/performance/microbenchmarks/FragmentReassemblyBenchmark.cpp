@@ -0,0 +1,78 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+
+using namespace eprosima::fastdds::rtps;
+
+/**
+ * Measures the reassembly throughput of large samples on a CacheChange_t, with the fragments received in order and
+ * in random order, as happens when the missing fragments are repaired after a NACK_FRAG.
+ */
+int main()
+{
+    using clock = std::chrono::steady_clock;
+    constexpr uint16_t fragment_size = 1344;
+
+    for (uint32_t length : {4u * 1024u * 1024u, 16u * 1024u * 1024u})
+    {
+        uint32_t num_fragments = (length + fragment_size - 1) / fragment_size;
+        SerializedPayload_t fragment(fragment_size);
+        fragment.length = fragment_size;
+        memset(fragment.data, 0xAB, fragment_size);
+
+        std::vector<uint32_t> in_order(num_fragments);
+        std::iota(in_order.begin(), in_order.end(), 1u);
+        std::vector<uint32_t> random_order(in_order);
+        std::shuffle(random_order.begin(), random_order.end(), std::mt19937(1));
+
+        CacheChange_t change(length);
+        // Avoid measuring the first access to the pages of the payload
+        memset(change.serializedPayload.data, 0, length);
+        for (const std::vector<uint32_t>* order : {&in_order, &random_order})
+        {
+            constexpr int repetitions = 5;
+            auto start = clock::now();
+            for (int n = 0; n < repetitions; ++n)
+            {
+                change.serializedPayload.length = length;
+                change.setFragmentSize(fragment_size, true);
+                for (uint32_t fragment_num : *order)
+                {
+                    change.add_fragments(fragment, fragment_num, 1);
+                }
+                if (!change.is_fully_assembled())
+                {
+                    std::printf("Sample not fully assembled\n");
+                    return 1;
+                }
+            }
+            double seconds = std::chrono::duration<double>(clock::now() - start).count();
+            std::printf("%2u MB sample, %5u fragments %-15s: %.0f MB/s\n", length / (1024u * 1024u), num_fragments,
+                    order == &in_order ? "in order" : "in random order",
+                    repetitions * (length / (1024.0 * 1024.0)) / seconds);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/utils/md5.h>
+
+#include <utils/KeyHashCache.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+static InstanceHandle_t md5_handle(
+        const std::string& key)
+{
+    MD5 md5;
+    md5.update(key.data(), static_cast<MD5::size_type>(key.size()));
+    md5.finalize();
+
+    InstanceHandle_t ret;
+    memcpy(ret.value, md5.digest, 16);
+    return ret;
+}
+
+/**
+ * Computes the instance handles of string keys of 32 to 256 bytes, with and without KeyHashCache.
+ * Each round writes a sample for each of 100 instances, as a writer publishing their updates would do.
+ */
+int main()
+{
+    using clock = std::chrono::steady_clock;
+    constexpr uint32_t num_instances = 100;
+    constexpr uint32_t num_rounds = 20000;
+
+    for (size_t key_length : {32u, 64u, 128u, 256u})
+    {
+        std::vector<std::string> keys;
+        for (uint32_t i = 0; i < num_instances; ++i)
+        {
+            std::string key = "instance_" + std::to_string(i) + "_";
+            key.resize(key_length, 'k');
+            keys.push_back(key);
+        }
+
+        InstanceHandle_t result;
+        auto start = clock::now();
+        for (uint32_t round = 0; round < num_rounds; ++round)
+        {
+            for (const std::string& key : keys)
+            {
+                result = md5_handle(key);
+            }
+        }
+        double md5_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() /
+                (num_rounds * num_instances);
+
+        KeyHashCache cache(1024);
+        start = clock::now();
+        for (uint32_t round = 0; round < num_rounds; ++round)
+        {
+            for (const std::string& key : keys)
+            {
+                const unsigned char* data = reinterpret_cast<const unsigned char*>(key.data());
+                if (!cache.find(data, key.size(), result))
+                {
+                    result = md5_handle(key);
+                    cache.insert(data, key.size(), result);
+                }
+            }
+        }
+        double cache_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() /
+                (num_rounds * num_instances);
+
+        if (md5_handle(keys.back()) != result)
+        {
+            std::printf("key of %zu bytes: cached handle differs from MD5\n", key_length);
+            return 1;
+        }
+
+        std::printf("key of %zu bytes: MD5 %.1f ns, cached %.1f ns per key\n", key_length, md5_ns, cache_ns);
+    }
+
+    return 0;
+}
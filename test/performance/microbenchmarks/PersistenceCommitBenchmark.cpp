@@ -0,0 +1,86 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/common/CacheChange.h>
+
+#include <rtps/persistence/PersistenceService.h>
+
+using namespace eprosima::fastdds::rtps;
+
+/**
+ * Measures the sustained rate of 256-byte changes stored on an SQLite database, committing each change on its own
+ * transaction and with asynchronous group commits.
+ */
+int main()
+{
+    constexpr uint32_t num_changes = 2000;
+    const std::string persist_guid("BENCHMARK_WRITER");
+    const std::string dbfile("PersistenceCommitBenchmark.db");
+
+    std::vector<octet> data(256, 0xAA);
+    CacheChange_t change;
+    change.kind = ALIVE;
+    change.writerGUID = GUID_t(GuidPrefix_t::unknown(), 1U);
+    change.serializedPayload.data = data.data();
+    change.serializedPayload.length = static_cast<uint32_t>(data.size());
+
+    int ret = 0;
+    for (bool async_commit : {false, true})
+    {
+        PropertyPolicy policy;
+        policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+        policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+        policy.properties().emplace_back("dds.persistence.async_commit", async_commit ? "true" : "false");
+        std::unique_ptr<IPersistenceService> service(PersistenceFactory::create_persistence_service(policy));
+        if (!service)
+        {
+            std::printf("could not create the SQLite3 persistence service\n");
+            ret = 1;
+            break;
+        }
+
+        bool success = true;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 1; i <= num_changes; ++i)
+        {
+            change.sequenceNumber = SequenceNumber_t(async_commit ? 1 : 0, i);
+            success = service->add_writer_change_to_storage(persist_guid, change) && success;
+        }
+        success = service->flush() && success;
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (!success)
+        {
+            std::printf("some changes could not be stored\n");
+            ret = 1;
+            break;
+        }
+
+        std::printf("%s commits: %.0f changes/s\n", async_commit ? "asynchronous" : "synchronous",
+                num_changes / seconds);
+    }
+
+    // The payload belongs to the vector
+    change.serializedPayload.data = nullptr;
+    std::remove(dbfile.c_str());
+    return ret;
+}
@@ -0,0 +1,271 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/rtps/common/WriteParams.h>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastdds::rtps::InstanceHandle_t;
+using eprosima::fastdds::rtps::SequenceNumber_t;
+using eprosima::fastdds::rtps::SerializedPayload_t;
+using eprosima::fastdds::rtps::WriteParams;
+
+struct BenchmarkSample
+{
+    uint32_t index = 0;
+    std::array<char, 60> message {};
+};
+
+/**
+ * Type of 64-byte samples copied as they are on the payload.
+ */
+class BenchmarkType : public TopicDataType
+{
+public:
+
+    BenchmarkType()
+    {
+        setName("PersistenceRecoveryBenchmarkType");
+        m_typeSize = 4u + static_cast<uint32_t>(sizeof(BenchmarkSample));
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        if (payload->max_size < m_typeSize)
+        {
+            return false;
+        }
+
+        // Little endian encapsulation followed by the raw sample
+        payload->data[0] = 0;
+        payload->data[1] = 1;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        memcpy(payload->data + 4, data, sizeof(BenchmarkSample));
+        payload->encapsulation = CDR_LE;
+        payload->length = m_typeSize;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        if (payload->length < m_typeSize)
+        {
+            return false;
+        }
+
+        memcpy(data, payload->data + 4, sizeof(BenchmarkSample));
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*,
+            DataRepresentationId_t) override
+    {
+        return [this]()
+               {
+                   return m_typeSize;
+               };
+    }
+
+    void* createData() override
+    {
+        return new BenchmarkSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BenchmarkSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+//! Remove the database of builtin.SQLITE3 and the files of the log stored by builtin.LOG
+static void remove_persistence_files(
+        const std::string& dbfile,
+        const std::string& logfile,
+        const std::string& persistence_guid)
+{
+    std::remove(dbfile.c_str());
+    std::remove((dbfile + "-wal").c_str());
+    std::remove((dbfile + "-shm").c_str());
+
+    // builtin.LOG replaces the characters of the GUID which cannot be used on a file name
+    std::string guid_part = persistence_guid;
+    for (char& c : guid_part)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)))
+        {
+            c = '_';
+        }
+    }
+    std::string base_name = logfile + "_" + guid_part;
+
+    uint64_t first_index = 0;
+    {
+        std::ifstream head(base_name + ".head");
+        head >> first_index;
+    }
+    std::remove((base_name + ".head").c_str());
+    std::remove((base_name + ".head.tmp").c_str());
+    for (uint64_t index = 0;; ++index)
+    {
+        if (0 != std::remove((base_name + "_" + std::to_string(index) + ".log").c_str()) && first_index < index)
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * Measures how long a TRANSIENT DataWriter takes to store a history of 20000 samples of 64 bytes, and to recover it
+ * when it is created again, with the SQLite3 plugin using asynchronous commits and with the log plugin.
+ */
+int main()
+{
+    constexpr int32_t num_samples = 20000;
+    const std::string persistence_guid("77.72.69.74.65.72.5f.70.65.72.73.5f|67.75.69.64");
+    const std::string dbfile("PersistenceRecoveryBenchmark.db");
+    const std::string logfile("PersistenceRecoveryBenchmark");
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::printf("could not create the participant\n");
+        return 1;
+    }
+
+    TypeSupport type(new BenchmarkType());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("PersistenceRecoveryBenchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+
+    int ret = 0;
+    for (const char* plugin : {"builtin.SQLITE3", "builtin.LOG"})
+    {
+        remove_persistence_files(dbfile, logfile, persistence_guid);
+
+        // One more sample is written after the recovery to check the sequence number
+        DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+        writer_qos.durability().kind = TRANSIENT_DURABILITY_QOS;
+        writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+        writer_qos.resource_limits().max_instances = 1;
+        writer_qos.resource_limits().max_samples_per_instance = num_samples + 1;
+        writer_qos.resource_limits().max_samples = num_samples + 1;
+        writer_qos.properties().properties().emplace_back("dds.persistence.plugin", plugin);
+        writer_qos.properties().properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+        writer_qos.properties().properties().emplace_back("dds.persistence.log.filename", logfile);
+        writer_qos.properties().properties().emplace_back("dds.persistence.async_commit",
+                0 == strcmp(plugin, "builtin.SQLITE3") ? "true" : "false");
+        writer_qos.properties().properties().emplace_back("dds.persistence.guid", persistence_guid);
+
+        DataWriter* writer = publisher->create_datawriter(topic, writer_qos);
+        if (nullptr == writer)
+        {
+            std::printf("could not create the DataWriter with %s\n", plugin);
+            ret = 1;
+            break;
+        }
+
+        BenchmarkSample sample;
+        bool success = true;
+        auto start = std::chrono::steady_clock::now();
+        for (int32_t i = 0; i < num_samples; ++i)
+        {
+            sample.index = static_cast<uint32_t>(i);
+            success = writer->write(&sample) && success;
+        }
+        double store_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // Deleting the DataWriter waits for the pending commits
+        publisher->delete_datawriter(writer);
+
+        start = std::chrono::steady_clock::now();
+        writer = publisher->create_datawriter(topic, writer_qos);
+        double load_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (nullptr == writer)
+        {
+            std::printf("could not create the DataWriter again with %s\n", plugin);
+            ret = 1;
+            break;
+        }
+
+        WriteParams params;
+        success = writer->write(&sample, params) && success;
+        publisher->delete_datawriter(writer);
+
+        if (!success || params.sample_identity().sequence_number() != SequenceNumber_t(0, num_samples + 1))
+        {
+            std::printf("the history stored with %s was not recovered\n", plugin);
+            ret = 1;
+            break;
+        }
+
+        std::printf("%s: %.0f samples/s stored, %d samples recovered in %.3f s\n", plugin,
+                num_samples / store_seconds, num_samples, load_seconds);
+    }
+
+    remove_persistence_files(dbfile, logfile, persistence_guid);
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+    return ret;
+}
@@ -0,0 +1,75 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <fastdds/utils/collections/RingVector.hpp>
+
+using namespace eprosima::fastdds;
+
+/**
+ * Writes on a full KEEP_LAST history: each new change is added at the back, and the oldest one is removed from the
+ * front. Compares the previous storage of History on an std::vector against RingVector.
+ */
+int main()
+{
+    using clock = std::chrono::steady_clock;
+
+    for (size_t depth : {1000u, 10000u, 100000u})
+    {
+        size_t num_writes = 20000000u / depth;
+        if (num_writes < 2000u)
+        {
+            num_writes = 2000u;
+        }
+
+        std::vector<uint64_t> vector;
+        RingVector<uint64_t> ring;
+        for (uint64_t sn = 0; sn < depth; ++sn)
+        {
+            vector.push_back(sn);
+            ring.push_back(sn);
+        }
+
+        auto start = clock::now();
+        for (uint64_t sn = depth; sn < depth + num_writes; ++sn)
+        {
+            vector.erase(vector.begin());
+            vector.push_back(sn);
+        }
+        double vector_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / num_writes;
+
+        start = clock::now();
+        for (uint64_t sn = depth; sn < depth + num_writes; ++sn)
+        {
+            ring.pop_front();
+            ring.push_back(sn);
+        }
+        double ring_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / num_writes;
+
+        if (!std::equal(vector.begin(), vector.end(), ring.begin()))
+        {
+            std::printf("depth %zu: contents differ\n", depth);
+            return 1;
+        }
+
+        std::printf("depth %zu: std::vector %.1f ns, RingVector %.1f ns per write\n", depth, vector_ns, ring_ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <rtps/transport/shared_mem/SharedMemManager.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+/**
+ * Measures the allocation throughput of SharedMemManager::Segment::alloc_buffer with 1, 2, 4 and 8 writer threads
+ * allocating and releasing buffers on the same segment, and how it scales with respect to a single writer.
+ * Released buffers are reused without taking the allocation lock of the segment, so the throughput should grow with
+ * the number of writers up to the number of cores.
+ */
+int main()
+{
+    constexpr uint32_t max_writers = 8u;
+    constexpr uint32_t allocations_per_writer = 100000u;
+    constexpr uint32_t buffer_size = 64u;
+
+    std::stringstream domain_name;
+    domain_name << "SharedMemAllocBenchmark_" << std::this_thread::get_id();
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name.str());
+    // Enough buffers for every writer to keep one allocated at any time
+    auto segment = shared_mem_manager->create_segment(buffer_size * max_writers * 4, max_writers * 4);
+
+    double single_writer_rate = 0.0;
+    for (uint32_t num_writers = 1u; num_writers <= max_writers; num_writers *= 2u)
+    {
+        std::atomic<uint32_t> overflows(0u);
+        std::vector<std::thread> writers;
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t w = 0u; w < num_writers; ++w)
+        {
+            writers.emplace_back([&]()
+                    {
+                        for (uint32_t i = 0u; i < allocations_per_writer; ++i)
+                        {
+                            try
+                            {
+                                auto buf = segment->alloc_buffer(buffer_size, std::chrono::steady_clock::time_point());
+                                memset(buf->data(), static_cast<int>(i), buffer_size);
+                            }
+                            catch (const std::exception&)
+                            {
+                                overflows.fetch_add(1u);
+                            }
+                        }
+                    });
+        }
+
+        for (auto& writer : writers)
+        {
+            writer.join();
+        }
+        auto t1 = std::chrono::steady_clock::now();
+
+        double total_us = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+        double rate = (num_writers * allocations_per_writer) / total_us;
+        if (1u == num_writers)
+        {
+            single_writer_rate = rate;
+        }
+        printf("alloc_buffer with %u writers: %.3f Mallocs/s (%.2fx the single writer rate, "
+                "%.3f us per allocation per writer), %u overflows\n",
+                num_writers, rate, rate / single_writer_rate, total_us / allocations_per_writer, overflows.load());
+    }
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/statistics/IListeners.hpp>
+#include <fastdds/utils/IPLocator.h>
+
+#include <statistics/types/types.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using namespace eprosima::fastdds::statistics;
+
+/**
+ * Counts the statistics notifications received.
+ */
+class CountingListener : public IListener
+{
+public:
+
+    void on_statistics_data(
+            const Data&) override
+    {
+        ++count;
+    }
+
+    std::atomic<uint64_t> count{0};
+};
+
+/**
+ * Measures the rate of 255-byte samples sent by a best effort writer to 1, 16 and 256 destinations, with RTPS_SENT
+ * statistics disabled and enabled. Each destination is a remote reader on its own localhost port, so every sample
+ * updates the traffic counters of each destination.
+ */
+int main()
+{
+    constexpr uint32_t num_samples = 2000;
+    constexpr uint32_t length = 255;
+
+    RTPSParticipantAttributes participant_attr;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, participant_attr);
+    if (nullptr == participant)
+    {
+        std::printf("could not create the participant\n");
+        return 1;
+    }
+
+    HistoryAttributes history_attr;
+    history_attr.payloadMaxSize = length;
+    WriterHistory history(history_attr);
+
+    WriterAttributes writer_attr;
+    writer_attr.endpoint.reliabilityKind = BEST_EFFORT;
+    writer_attr.endpoint.durabilityKind = VOLATILE;
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, writer_attr, &history);
+    if (nullptr == writer)
+    {
+        std::printf("could not create the writer\n");
+        RTPSDomain::removeRTPSParticipant(participant);
+        return 1;
+    }
+
+    std::vector<octet> payload(length, 'e');
+
+    int ret = 0;
+    for (uint32_t num_destinations : {1u, 16u, 256u})
+    {
+        std::vector<GUID_t> readers;
+        for (uint32_t i = 0; i < num_destinations; ++i)
+        {
+            ReaderProxyData reader(1, 0);
+            GuidPrefix_t prefix;
+            prefix.value[0] = 0xBE;
+            memcpy(&prefix.value[1], &i, sizeof(i));
+            reader.guid(GUID_t(prefix, 0x00000107));
+            Locator_t locator;
+            IPLocator::setIPv4(locator, 127, 0, 0, 1);
+            locator.port = 40000 + i;
+            reader.add_unicast_locator(locator);
+            writer->matched_reader_add(reader);
+            readers.push_back(reader.guid());
+        }
+
+        for (bool statistics_enabled : {false, true})
+        {
+            auto listener = std::make_shared<CountingListener>();
+            if (statistics_enabled)
+            {
+                participant->set_enabled_statistics_writers_mask(EventKind::RTPS_SENT);
+                participant->add_statistics_listener(listener, EventKind::RTPS_SENT);
+            }
+
+            bool success = true;
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < num_samples && success; ++i)
+            {
+                CacheChange_t* change = writer->new_change([]() -> uint32_t
+                                {
+                                    return length;
+                                }, ALIVE);
+                success = nullptr != change;
+                if (success)
+                {
+                    memcpy(change->serializedPayload.data, payload.data(), length);
+                    change->serializedPayload.length = length;
+                    success = history.add_change(change) && history.remove_min_change();
+                }
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            if (statistics_enabled)
+            {
+                participant->remove_statistics_listener(listener, EventKind::RTPS_SENT);
+                participant->set_enabled_statistics_writers_mask(0);
+            }
+
+            if (!success)
+            {
+                std::printf("error writing a sample\n");
+                ret = 1;
+            }
+            else if (statistics_enabled ? 0 == listener->count : 0 != listener->count)
+            {
+                std::printf("unexpected number of RTPS_SENT notifications: %llu\n",
+                        static_cast<unsigned long long>(listener->count.load()));
+                ret = 1;
+            }
+            else
+            {
+                std::printf("%u destinations, statistics %s: %.0f samples/s\n", num_destinations,
+                        statistics_enabled ? "enabled" : "disabled", num_samples / seconds);
+            }
+        }
+
+        for (const GUID_t& reader : readers)
+        {
+            writer->matched_reader_remove(reader);
+        }
+
+        if (0 != ret)
+        {
+            break;
+        }
+    }
+
+    RTPSDomain::removeRTPSWriter(writer);
+    RTPSDomain::removeRTPSParticipant(participant);
+    return ret;
+}
@@ -0,0 +1,219 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
+#include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
+#include <fastdds/utils/IPLocator.h>
+
+#include <rtps/transport/tcp/RTCPMessageManager.h>
+#include <rtps/transport/TCPv4Transport.h>
+
+using namespace eprosima::fastdds::rtps;
+
+/**
+ * Counts the messages received on an input channel, checking their contents.
+ */
+class CountingReceiver : public TransportReceiverInterface
+{
+public:
+
+    CountingReceiver(
+            const std::vector<octet>& expected)
+        : expected_(expected)
+    {
+    }
+
+    void OnDataReceived(
+            const octet* data,
+            const uint32_t size,
+            const Locator&,
+            const Locator&) override
+    {
+        bool valid = size == expected_.size() && 0 == memcmp(data, expected_.data(), size);
+        std::lock_guard<std::mutex> lock(mtx_);
+        ++received_;
+        invalid_ += valid ? 0u : 1u;
+        cv_.notify_all();
+    }
+
+    //! Waits until the given number of messages are received, and returns the number of invalid ones.
+    uint32_t wait(
+            uint32_t num_messages)
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        cv_.wait(lock, [&]()
+                {
+                    return received_ >= num_messages;
+                });
+        return invalid_;
+    }
+
+private:
+
+    const std::vector<octet>& expected_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    uint32_t received_ = 0;
+    uint32_t invalid_ = 0;
+};
+
+/**
+ * Measures the cost of the TCP header CRC on messages of 32 KB:
+ * - Computing it byte by byte, as it was done before, and on whole blocks.
+ * - Sending messages between two transports through localhost, with and without CRC.
+ */
+int main()
+{
+    constexpr uint32_t num_buffers = 4;
+    constexpr uint32_t buffer_size = 8000;
+
+    std::vector<octet> message(num_buffers * buffer_size);
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<octet>(i * 7);
+    }
+
+    {
+        constexpr uint32_t num_iterations = 2000;
+
+        uint32_t bytewise_crc = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t n = 0; n < num_iterations; ++n)
+        {
+            bytewise_crc = 0;
+            for (octet byte : message)
+            {
+                RTCPMessageManager::addToCRC(bytewise_crc, byte);
+            }
+        }
+        double bytewise_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        uint32_t block_crc = 0;
+        start = std::chrono::steady_clock::now();
+        for (uint32_t n = 0; n < num_iterations; ++n)
+        {
+            block_crc = RTCPMessageManager::addToCRC(0, message.data(), message.size());
+        }
+        double block_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (bytewise_crc != block_crc)
+        {
+            std::printf("CRC computed on blocks differs from the bytewise one\n");
+            return 1;
+        }
+
+        double num_bytes = static_cast<double>(num_iterations) * message.size();
+        std::printf("CRC computation: bytewise %.0f MB/s, block %.0f MB/s\n", num_bytes / bytewise_seconds / 1e6,
+                num_bytes / block_seconds / 1e6);
+    }
+
+    std::vector<NetworkBuffer> buffer_list;
+    for (uint32_t i = 0; i < num_buffers; ++i)
+    {
+        buffer_list.emplace_back(&message[i * buffer_size], buffer_size);
+    }
+
+    constexpr uint32_t num_messages = 20000;
+    uint16_t port = 17410;
+    for (bool use_crc : {true, false})
+    {
+        ++port;
+
+        TCPv4TransportDescriptor recv_descriptor;
+        recv_descriptor.add_listener_port(port);
+        recv_descriptor.check_crc = use_crc;
+        TCPv4Transport receive_transport(recv_descriptor);
+
+        TCPv4TransportDescriptor send_descriptor;
+        send_descriptor.calculate_crc = use_crc;
+        TCPv4Transport send_transport(send_descriptor);
+
+        if (!receive_transport.init() || !send_transport.init())
+        {
+            std::printf("could not initialize the transports\n");
+            return 1;
+        }
+
+        Locator_t input_locator;
+        input_locator.kind = LOCATOR_KIND_TCPv4;
+        input_locator.port = port;
+        IPLocator::setIPv4(input_locator, 127, 0, 0, 1);
+        IPLocator::setLogicalPort(input_locator, 7410);
+
+        LocatorList_t locator_list;
+        locator_list.push_back(input_locator);
+
+        CountingReceiver receiver(message);
+        SendResourceList send_resource_list;
+        if (!receive_transport.OpenInputChannel(input_locator, &receiver, 0x8FFF) ||
+                !send_transport.OpenOutputChannel(send_resource_list, input_locator) || send_resource_list.empty())
+        {
+            std::printf("could not open the channels\n");
+            return 1;
+        }
+
+        auto send_message = [&]()
+                {
+                    Locators input_begin(locator_list.begin());
+                    Locators input_end(locator_list.end());
+                    return send_resource_list.at(0)->send(buffer_list, static_cast<uint32_t>(message.size()),
+                                   &input_begin, &input_end,
+                                   (std::chrono::steady_clock::now() + std::chrono::seconds(1)));
+                };
+
+        // Wait for the connection to be established
+        while (!send_message())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 1; i < num_messages; ++i)
+        {
+            if (!send_message())
+            {
+                std::printf("error sending a message\n");
+                return 1;
+            }
+        }
+        uint32_t invalid = receiver.wait(num_messages);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        send_resource_list.clear();
+        receive_transport.CloseInputChannel(input_locator);
+
+        if (0 != invalid)
+        {
+            std::printf("%u messages received with wrong contents\n", invalid);
+            return 1;
+        }
+
+        std::printf("localhost throughput with CRC %s: %.0f MB/s\n", use_crc ? "enabled" : "disabled",
+                (num_messages - 1) * message.size() / seconds / 1e6);
+    }
+
+    return 0;
+}
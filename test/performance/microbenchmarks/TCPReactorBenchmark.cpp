@@ -0,0 +1,201 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <asio.hpp>
+
+#include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
+#include <fastdds/utils/IPLocator.h>
+
+#include <rtps/transport/tcp/RTCPHeader.h>
+#include <rtps/transport/TCPv4Transport.h>
+
+using namespace eprosima::fastdds::rtps;
+
+/**
+ * Counts the messages of the expected size received on an input channel.
+ */
+class CountingReceiver : public TransportReceiverInterface
+{
+public:
+
+    CountingReceiver(
+            uint32_t message_size)
+        : message_size_(message_size)
+    {
+    }
+
+    void OnDataReceived(
+            const octet*,
+            const uint32_t size,
+            const Locator&,
+            const Locator&) override
+    {
+        if (message_size_ == size)
+        {
+            received_.fetch_add(1);
+        }
+    }
+
+    uint32_t received() const
+    {
+        return received_.load();
+    }
+
+private:
+
+    const uint32_t message_size_;
+    std::atomic<uint32_t> received_ {0};
+};
+
+/**
+ * Connects 100, 1000 and 5000 clients to a transport, and measures the time needed to receive a burst of messages
+ * from all of them, with a reception thread per connection and with 4 reactor threads.
+ * The number of connections is limited by the maximum number of open files of the process.
+ */
+int main()
+{
+    constexpr uint16_t logical_port = 7410;
+    constexpr uint32_t messages_per_connection = 10;
+    constexpr uint32_t message_size = 1000;
+
+    size_t max_connections = 5000;
+    // Each connection uses a socket on each side, and the transport needs some more descriptors
+    struct rlimit limit;
+    if (0 == getrlimit(RLIMIT_NOFILE, &limit) && limit.rlim_cur < 2 * max_connections + 100)
+    {
+        max_connections = limit.rlim_cur > 100 ? (limit.rlim_cur - 100) / 2 : 0;
+    }
+
+    std::vector<octet> message(TCPHeader::size() + message_size, 0);
+    TCPHeader header;
+    header.logical_port = logical_port;
+    header.length += message_size;
+    memcpy(message.data(), header.address(), TCPHeader::size());
+
+    uint16_t port = 17420;
+    for (uint32_t reactor_threads : {0u, 4u})
+    {
+        for (size_t num_connections : {100u, 1000u, 5000u})
+        {
+            if (num_connections > max_connections)
+            {
+                std::printf("skipping %zu connections: not enough file descriptors\n", num_connections);
+                continue;
+            }
+            if (0 == reactor_threads && 1000 < num_connections)
+            {
+                // Too many threads
+                continue;
+            }
+
+            CountingReceiver receiver(message_size);
+
+            TCPv4TransportDescriptor descriptor;
+            descriptor.add_listener_port(port);
+            descriptor.check_crc = false;
+            descriptor.reactor_threads = reactor_threads;
+            TCPv4Transport transport(descriptor);
+            if (!transport.init())
+            {
+                std::printf("could not initialize the transport on port %u\n", port);
+                return 1;
+            }
+
+            Locator_t input_locator;
+            input_locator.kind = LOCATOR_KIND_TCPv4;
+            input_locator.port = port;
+            IPLocator::setIPv4(input_locator, 127, 0, 0, 1);
+            IPLocator::setLogicalPort(input_locator, logical_port);
+            if (!transport.OpenInputChannel(input_locator, &receiver, 0xFFFF))
+            {
+                std::printf("could not open the input channel\n");
+                return 1;
+            }
+
+            asio::io_context ctx;
+            asio::ip::tcp::endpoint destination(asio::ip::address::from_string("127.0.0.1"), port);
+            std::vector<std::unique_ptr<asio::ip::tcp::socket>> clients;
+            for (size_t i = 0; i < num_connections; ++i)
+            {
+                asio::error_code ec;
+                clients.emplace_back(new asio::ip::tcp::socket(ctx));
+                clients.back()->connect(destination, ec);
+                if (ec)
+                {
+                    std::printf("could not connect client %zu: %s\n", i, ec.message().c_str());
+                    return 1;
+                }
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < messages_per_connection; ++i)
+            {
+                for (auto& client : clients)
+                {
+                    asio::error_code ec;
+                    asio::write(*client, asio::buffer(message.data(), message.size()), ec);
+                    if (ec)
+                    {
+                        std::printf("could not send a message: %s\n", ec.message().c_str());
+                        return 1;
+                    }
+                }
+            }
+
+            uint32_t expected = static_cast<uint32_t>(num_connections * messages_per_connection);
+            auto timeout = start + std::chrono::seconds(60);
+            while (receiver.received() < expected && std::chrono::steady_clock::now() < timeout)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            if (receiver.received() < expected)
+            {
+                std::printf("%zu connections: only %u of %u messages received\n", num_connections,
+                        receiver.received(), expected);
+                return 1;
+            }
+
+            if (0 == reactor_threads)
+            {
+                std::printf("%zu connections, a thread per connection: %.1f ms (%.0f messages/s)\n",
+                        num_connections, ms, expected / ms * 1000);
+            }
+            else
+            {
+                std::printf("%zu connections, %u reactor threads: %.1f ms (%.0f messages/s)\n",
+                        num_connections, reactor_threads, ms, expected / ms * 1000);
+            }
+
+            clients.clear();
+            transport.CloseInputChannel(input_locator);
+            ++port;
+        }
+    }
+
+    return 0;
+}
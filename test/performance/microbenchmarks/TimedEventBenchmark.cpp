@@ -0,0 +1,118 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <rtps/resources/ResourceEvent.h>
+#include <rtps/resources/TimedEvent.h>
+
+using namespace eprosima::fastdds::rtps;
+
+/**
+ * Measures the cost of rescheduling timers when lots of them are active.
+ * It keeps 50000 long timers active, rescheduling some of them on each iteration, while a short timer is restarted
+ * and waited for. It reports the delay from each restart to its callback, and the CPU consumed meanwhile.
+ */
+int main()
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t num_timers = 50000;
+    constexpr size_t reschedules_per_iteration = 100;
+    constexpr int num_iterations = 200;
+    constexpr auto newcomer_ms = std::chrono::milliseconds(1);
+
+    ResourceEvent service;
+    service.init_thread();
+
+    auto periodic_callback = []()
+            {
+                return true;
+            };
+
+    // Long timers, spread between 10 and 20 seconds so none of them is triggered during the run
+    std::vector<std::unique_ptr<TimedEvent>> timers;
+    timers.reserve(num_timers);
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < num_timers; ++i)
+    {
+        timers.emplace_back(new TimedEvent(service, periodic_callback, 10000.0 + (i % 10000)));
+        timers.back()->restart_timer();
+    }
+    Clock::duration start_all_time = Clock::now() - start;
+
+    std::condition_variable cv;
+    std::mutex mtx;
+    bool triggered = false;
+    auto callback = [&]()
+            {
+                std::lock_guard<std::mutex> guard(mtx);
+                triggered = true;
+                cv.notify_one();
+
+                return false;
+            };
+    TimedEvent newcomer_event(service, callback, 1.0 * newcomer_ms.count());
+
+    Clock::duration reschedule_time{0};
+    Clock::duration max_latency{0};
+    Clock::duration total_latency{0};
+    std::clock_t cpu_start = std::clock();
+    start = Clock::now();
+    for (int n = 0; n < num_iterations; ++n)
+    {
+        // Reschedule some of the long timers, as writers do with their heartbeats
+        Clock::time_point reschedule_start = Clock::now();
+        for (size_t i = 0; i < reschedules_per_iteration; ++i)
+        {
+            TimedEvent& timer = *timers[(n * reschedules_per_iteration + i) % num_timers];
+            timer.cancel_timer();
+            timer.restart_timer();
+        }
+        reschedule_time += Clock::now() - reschedule_start;
+
+        std::unique_lock<std::mutex> lock(mtx);
+        triggered = false;
+        Clock::time_point restart_time = Clock::now();
+        newcomer_event.restart_timer();
+        cv.wait(lock, [&]()
+                {
+                    return triggered;
+                });
+        Clock::duration latency = Clock::now() - restart_time - newcomer_ms;
+        total_latency += latency;
+        max_latency = (std::max)(max_latency, latency);
+    }
+    double cpu_ms = 1000.0 * static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+    double elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    using us = std::chrono::duration<double, std::micro>;
+    printf("Started %zu timers in %.3f ms\n", num_timers,
+            std::chrono::duration<double, std::milli>(start_all_time).count());
+    printf("Reschedule: %.3f us per timer\n",
+            us(reschedule_time).count() / (num_iterations * reschedules_per_iteration));
+    printf("Trigger latency: %.3f us average, %.3f us max\n", us(total_latency).count() / num_iterations,
+            us(max_latency).count());
+    printf("CPU usage: %.3f ms in %.3f ms\n", cpu_ms, elapsed_ms);
+
+    timers.clear();
+    return 0;
+}
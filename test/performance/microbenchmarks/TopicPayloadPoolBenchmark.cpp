@@ -0,0 +1,113 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/common/SerializedPayload.h>
+
+#include <rtps/history/TopicPayloadPool.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+/**
+ * Each thread gets and releases payloads from the same pool, keeping a few of them in use, as writers and readers of
+ * the same topic do.
+ *
+ * @return Nanoseconds per get and release.
+ */
+static double run_scenario(
+        MemoryManagementPolicy_t policy,
+        size_t num_threads)
+{
+    using clock = std::chrono::steady_clock;
+    constexpr size_t in_use = 4;
+    constexpr size_t iterations = 1000000;
+
+    PoolConfig config{ policy, 128, 0, 0 };
+    std::shared_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    pool->reserve_history(config, false);
+
+    auto start = clock::now();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&pool]()
+                {
+                    std::vector<SerializedPayload_t> payloads(in_use);
+                    for (size_t i = 0; i < iterations; ++i)
+                    {
+                        SerializedPayload_t& payload = payloads[i % in_use];
+                        if (nullptr != payload.data)
+                        {
+                            pool->release_payload(payload);
+                        }
+                        pool->get_payload(128, payload);
+                    }
+                    for (SerializedPayload_t& payload : payloads)
+                    {
+                        if (nullptr != payload.data)
+                        {
+                            pool->release_payload(payload);
+                        }
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    pool->release_history(config, false);
+
+    return elapsed / static_cast<double>(num_threads * iterations);
+}
+
+/**
+ * Measures the cost of getting and releasing a payload on a TopicPayloadPool shared by several threads.
+ *
+ * Each thread uses one of the stashes of free payloads of the pool, which are still protected by a mutex. Threads only
+ * contend when they share a stash, or when a stash is refilled from or spilled to the list of free payloads.
+ */
+int main()
+{
+    std::printf("Hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    struct
+    {
+        MemoryManagementPolicy_t policy;
+        const char* name;
+    } policies[] =
+    {
+        {PREALLOCATED_MEMORY_MODE, "PREALLOCATED"},
+        {PREALLOCATED_WITH_REALLOC_MEMORY_MODE, "PREALLOCATED_WITH_REALLOC"},
+        {DYNAMIC_REUSABLE_MEMORY_MODE, "DYNAMIC_REUSABLE"},
+    };
+
+    for (const auto& policy : policies)
+    {
+        for (size_t num_threads : {1u, 2u, 8u, 32u})
+        {
+            std::printf("%-25s %2zu threads: %6.1f ns per get and release\n", policy.name, num_threads,
+                    run_scenario(policy.policy, num_threads));
+        }
+    }
+
+    return 0;
+}
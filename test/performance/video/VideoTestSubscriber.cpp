@@ -56,6 +56,8 @@ VideoTestSubscriber::VideoTestSubscriber()
     , m_videoWidth(1024)
     , m_videoHeight(720)
     , m_videoFrameRate(30)
+    , last_seqnum_(0)
+    , lost_samples_(0)
 {
     m_datasublistener.mp_up = this;
     m_commandpublistener.mp_up = this;
@@ -411,7 +413,19 @@ void VideoTestSubscriber::DataSubListener::on_data_available(
 {
     VideoType videoData;
     SampleInfo info;
-    datareader->take_next_sample((void*)&videoData, &info);
+    if (RETCODE_OK == datareader->take_next_sample((void*)&videoData, &info) && info.valid_data)
+    {
+        // Measure the spacing of the samples on the wire and the ones which never arrived
+        std::unique_lock<std::mutex> lock(mp_up->stats_mutex_);
+        auto now = std::chrono::steady_clock::now();
+        if (0 != mp_up->last_seqnum_ && videoData.seqnum > mp_up->last_seqnum_)
+        {
+            mp_up->gaps_.push_back(std::chrono::duration<double, std::micro>(now - mp_up->t_last_arrival_).count());
+            mp_up->lost_samples_ += videoData.seqnum - mp_up->last_seqnum_ - 1;
+        }
+        mp_up->t_last_arrival_ = now;
+        mp_up->last_seqnum_ = videoData.seqnum;
+    }
     {
         mp_up->push_video_packet(videoData);
     }
@@ -466,6 +480,12 @@ bool VideoTestSubscriber::test()
     samples_.clear();
     drops_.clear();
     avgs_.clear();
+    {
+        std::unique_lock<std::mutex> stats_lock(stats_mutex_);
+        gaps_.clear();
+        last_seqnum_ = 0;
+        lost_samples_ = 0;
+    }
     TestCommandType command;
     command.m_command = BEGIN;
     mp_dw->write(&command);
@@ -928,6 +948,36 @@ void VideoTestSubscriber::analyzeTimes()
             }
         }
 
+        {
+            std::unique_lock<std::mutex> lock(stats_mutex_);
+            TS.lost = lost_samples_;
+            if (gaps_.size() > 0)
+            {
+                // INTER-ARRIVAL GAP
+                TS.m_minGap = *std::min_element(gaps_.begin(), gaps_.end());
+                TS.m_maxGap = *std::max_element(gaps_.begin(), gaps_.end());
+
+                TS.pGapMean = std::accumulate(gaps_.begin(), gaps_.end(), double(0)) / gaps_.size();
+                double auxstdev = 0;
+                for (double gap : gaps_)
+                {
+                    auxstdev += pow(gap - TS.pGapMean, 2);
+                }
+                TS.pGapStdev = sqrt(auxstdev / gaps_.size());
+
+                std::sort(gaps_.begin(), gaps_.end());
+                auto percentile = [this](double ratio)
+                        {
+                            size_t elem = static_cast<size_t>(gaps_.size() * ratio);
+                            return gaps_.at(elem > 0 ? elem - 1 : 0);
+                        };
+                TS.pGap50 = percentile(0.5);
+                TS.pGap90 = percentile(0.9);
+                TS.pGap99 = percentile(0.99);
+                TS.pGap9999 = percentile(0.9999);
+            }
+        }
+
         m_stats.push_back(TS);
     }
 }
@@ -948,7 +998,8 @@ void VideoTestSubscriber::printStat(
     output_file_csv <<
         "Samples, Avg stdev, Avg Mean, min Avg, Avg 50 %%, Avg 90 %%, Avg 99 %%, \
         Avg 99.99%%, Avg max, Drop stdev, Drop Mean, min Drop, Drop 50 %%, Drop 90 %%, Drop 99 %%, \
-        Drop 99.99%%, Drop max" << std::endl;
+        Drop 99.99%%, Drop max, Lost, Gap stdev, Gap Mean, min Gap, Gap 50 %%, Gap 90 %%, Gap 99 %%, \
+        Gap 99.99%%, Gap max" << std::endl;
 
     output_mean_csv << "Avg Mean" << std::endl;
 
@@ -969,10 +1020,20 @@ void VideoTestSubscriber::printStat(
             TS.received, TS.pDropStdev, TS.pDropMean, TS.m_minDrop, TS.pDrop50, TS.pDrop90, TS.pDrop99, TS.pDrop9999,
             TS.m_maxDrop);
 
+    printf(
+        "\n       Lost,  Gap stdev(us),  Gap Mean(us),  min Gap(us),  Gap 50%%(us),  Gap 90%%(us),  Gap 99%%(us), Gap 99.99%%(us),   Gap max(us)\n");
+    printf(
+        "-----------,---------------,--------------,-------------,--------------,--------------,--------------,----------------,--------------\n");
+    printf("%11u,%15.2f,%14.2f,%13.2f,%14.2f,%14.2f,%14.2f,%16.2f,%14.2f \n",
+            TS.lost, TS.pGapStdev, TS.pGapMean, TS.m_minGap, TS.pGap50, TS.pGap90, TS.pGap99, TS.pGap9999,
+            TS.m_maxGap);
+
     output_file_csv << TS.received << "," << TS.pAvgStdev << "," << TS.pAvgMean << "," << TS.m_minAvg << "," <<
         TS.pAvg50 << "," << TS.pAvg90 << "," << TS.pAvg99 << "," << TS.pAvg9999 << "," << TS.m_maxAvg << "," <<
         TS.pDropStdev << "," << TS.pDropMean << "," << TS.m_minDrop << "," << TS.pDrop50 << "," << TS.pDrop90 <<
-        "," << TS.pDrop99 << "," << TS.pDrop9999 << "," << TS.m_maxDrop << "," << std::endl;
+        "," << TS.pDrop99 << "," << TS.pDrop9999 << "," << TS.m_maxDrop << "," << TS.lost << "," << TS.pGapStdev <<
+        "," << TS.pGapMean << "," << TS.m_minGap << "," << TS.pGap50 << "," << TS.pGap90 << "," << TS.pGap99 << "," <<
+        TS.pGap9999 << "," << TS.m_maxGap << "," << std::endl;
 
     output_mean_csv << TS.pAvgMean << "," << std::endl;
 
@@ -48,6 +48,15 @@ public:
         , pAvg9999(0)
         , pAvgMean(0)
         , pAvgStdev(0)
+        , lost(0)
+        , m_minGap(0)
+        , m_maxGap(0)
+        , pGap50(0)
+        , pGap90(0)
+        , pGap99(0)
+        , pGap9999(0)
+        , pGapMean(0)
+        , pGapStdev(0)
     {
     }
 
@@ -59,6 +68,10 @@ public:
     double m_minDrop, m_maxDrop, m_minAvg, m_maxAvg;
     double pDrop50, pDrop90, pDrop99, pDrop9999, pDropMean, pDropStdev;
     double pAvg50, pAvg90, pAvg99, pAvg9999, pAvgMean, pAvgStdev;
+    // Samples lost, and gaps between the arrival of consecutive samples in microseconds
+    unsigned int lost;
+    double m_minGap, m_maxGap;
+    double pGap50, pGap90, pGap99, pGap9999, pGapMean, pGapStdev;
 
 };
 
@@ -203,6 +216,10 @@ public:
     std::vector<std::chrono::duration<double, std::micro>> samples_;
     std::vector<double> drops_;
     std::vector<double> avgs_;
+    std::vector<double> gaps_;
+    std::chrono::steady_clock::time_point t_last_arrival_;
+    uint32_t last_seqnum_;
+    uint32_t lost_samples_;
     std::vector<TimeStats> m_stats;
 
 protected:
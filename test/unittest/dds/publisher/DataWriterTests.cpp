@@ -36,7 +36,12 @@
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/IContentFilter.hpp>
+#include <fastdds/dds/topic/IContentFilterFactory.hpp>
 #include <fastdds/publisher/DataWriterImpl.hpp>
+#include <fastdds/publisher/filtering/DataWriterFilteredChange.hpp>
+#include <fastdds/publisher/filtering/ReaderFilterCollection.hpp>
 
 #include "../../common/CustomPayloadPool.hpp"
 #include "../../logging/mock/MockConsumer.h"
@@ -2245,6 +2250,141 @@ TEST(DataWriterTests, data_type_is_plain_data_representation)
     DomainParticipantFactory::get_instance()->delete_participant(participant);
 }
 
+class DomainParticipantTest : public DomainParticipant
+{
+public:
+
+    DomainParticipantImpl* get_impl() const
+    {
+        return impl_;
+    }
+
+};
+
+//! Content filter accepting all the samples, which counts its evaluations
+class CountingContentFilter : public IContentFilter, public IContentFilterFactory
+{
+public:
+
+    bool evaluate(
+            const SerializedPayload&,
+            const FilterSampleInfo&,
+            const GUID_t&) const override
+    {
+        ++evaluations;
+        return true;
+    }
+
+    ReturnCode_t create_content_filter(
+            const char*,
+            const char*,
+            const TopicDataType*,
+            const char*,
+            const ParameterSeq&,
+            IContentFilter*& filter_instance) override
+    {
+        filter_instance = this;
+        return RETCODE_OK;
+    }
+
+    ReturnCode_t delete_content_filter(
+            const char*,
+            IContentFilter*) override
+    {
+        return RETCODE_OK;
+    }
+
+    mutable uint32_t evaluations = 0;
+};
+
+/**
+ * This test checks that the writer-side filters of readers using the built-in DDS-SQL filter with the same
+ * signature are evaluated once per sample, and that readers with different signatures or using filters of user
+ * factories are evaluated on their own.
+ */
+TEST(DataWriterTests, reader_filters_evaluation_sharing)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(nullptr, participant);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(nullptr, topic);
+
+    CountingContentFilter counting_filter;
+    ASSERT_EQ(RETCODE_OK, participant->register_content_filter_factory("COUNTING_FILTER", &counting_filter));
+
+    DomainParticipantImpl* participant_impl = static_cast<DomainParticipantTest*>(participant)->get_impl();
+    ASSERT_NE(nullptr, participant_impl);
+
+    DataWriterFilteredChange change(ResourceLimitedContainerConfig(0, 8));
+    change.kind = fastdds::rtps::ALIVE;
+    change.writerGUID.entityId = fastdds::rtps::EntityId_t(0x100 + 0x02);
+    change.sequenceNumber = fastdds::rtps::SequenceNumber_t(0, 1);
+
+    fastdds::rtps::ContentFilterProperty::AllocationConfiguration filter_allocation;
+    auto make_reader_guid = [](uint32_t key)
+            {
+                fastdds::rtps::GUID_t guid;
+                guid.entityId = fastdds::rtps::EntityId_t(key * 0x100 + 0x07);
+                return guid;
+            };
+
+    {
+        ReaderFilterCollection reader_filters(ResourceLimitedContainerConfig(0, 8));
+
+        // Three readers with the same DDS-SQL filter and one with a different one
+        fastdds::rtps::ContentFilterProperty filter_property(filter_allocation);
+        filter_property.content_filtered_topic_name = "filtered_topic_a";
+        filter_property.related_topic_name = "footopic";
+        filter_property.filter_class_name = FASTDDS_SQLFILTER_NAME;
+        for (uint32_t key = 1; key <= 3; ++key)
+        {
+            reader_filters.process_reader_filter_info(make_reader_guid(key), filter_property, participant_impl, topic);
+        }
+        filter_property.content_filtered_topic_name = "filtered_topic_b";
+        reader_filters.process_reader_filter_info(make_reader_guid(4), filter_property, participant_impl, topic);
+
+        reader_filters.update_filter_info(change, fastdds::rtps::SampleIdentity::unknown());
+        EXPECT_EQ(2u, reader_filters.filter_evaluations());
+        EXPECT_EQ(2u, reader_filters.filter_evaluations_saved());
+        EXPECT_TRUE(change.filtered_out_readers.empty());
+
+        // Once the readers sharing the filter are gone, each filter is evaluated once again
+        reader_filters.remove_reader(make_reader_guid(1));
+        reader_filters.remove_reader(make_reader_guid(2));
+        reader_filters.update_filter_info(change, fastdds::rtps::SampleIdentity::unknown());
+        EXPECT_EQ(4u, reader_filters.filter_evaluations());
+        EXPECT_EQ(2u, reader_filters.filter_evaluations_saved());
+    }
+
+    {
+        ReaderFilterCollection reader_filters(ResourceLimitedContainerConfig(0, 8));
+
+        // Filters of user factories may depend on the reader, so they are never shared
+        fastdds::rtps::ContentFilterProperty filter_property(filter_allocation);
+        filter_property.content_filtered_topic_name = "filtered_topic_a";
+        filter_property.related_topic_name = "footopic";
+        filter_property.filter_class_name = "COUNTING_FILTER";
+        for (uint32_t key = 1; key <= 3; ++key)
+        {
+            reader_filters.process_reader_filter_info(make_reader_guid(key), filter_property, participant_impl, topic);
+        }
+
+        reader_filters.update_filter_info(change, fastdds::rtps::SampleIdentity::unknown());
+        EXPECT_EQ(3u, reader_filters.filter_evaluations());
+        EXPECT_EQ(0u, reader_filters.filter_evaluations_saved());
+        EXPECT_EQ(3u, counting_filter.evaluations);
+    }
+
+    /* Tear down */
+    ASSERT_EQ(RETCODE_OK, participant->unregister_content_filter_factory("COUNTING_FILTER"));
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+}
+
 } // namespace dds
 } // namespace fastdds
 } // namespace eprosima
@@ -1,4 +1,8 @@
+#include <memory>
+#include <vector>
+
 #include <fastdds/subscriber/history/DataReaderHistory.hpp>
+#include <fastdds/subscriber/history/DataReaderInstanceIndex.hpp>
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/dds/topic/TopicDataType.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
@@ -267,6 +271,184 @@ TEST(DataReaderHistory, exclusive_ownership_keyed_sample_reception)
     ASSERT_EQ(18u, history.getHistorySize());
 }
 
+/*!
+ * Tests `DataReaderInstanceIndex` keeps the instances accessible by their handle while they are added and removed,
+ * and reuses the storage of removed instances.
+ */
+TEST(DataReaderHistory, instance_index)
+{
+    const eprosima::fastdds::ResourceLimitedContainerConfig allocation;
+    DataReaderInstanceIndex index;
+    constexpr uint32_t num_instances = 10000;
+
+    auto handle_for = [](uint32_t i)
+            {
+                InstanceHandle_t handle;
+                memcpy(handle.value, &i, sizeof(i));
+                return handle;
+            };
+
+    std::vector<DataReaderInstance*> instances;
+    for (uint32_t i = 0; i < num_instances; ++i)
+    {
+        auto result = index.emplace(handle_for(i), allocation, allocation);
+        ASSERT_TRUE(result.second);
+        ASSERT_EQ(handle_for(i), result.first->first);
+        instances.push_back(result.first->second);
+    }
+    ASSERT_EQ(num_instances, index.size());
+    ASSERT_FALSE(index.emplace(handle_for(0), allocation, allocation).second);
+    ASSERT_EQ(index.end(), index.find(InstanceHandle_t()));
+
+    // Instances keep their address when the index grows
+    for (uint32_t i = 0; i < num_instances; ++i)
+    {
+        auto it = index.find(handle_for(i));
+        ASSERT_NE(index.end(), it);
+        ASSERT_EQ(instances[i], it->second);
+    }
+
+    // Remove even instances
+    instances[0]->view_state = NOT_NEW_VIEW_STATE;
+    for (uint32_t i = 0; i < num_instances; i += 2)
+    {
+        ASSERT_EQ(1u, index.erase(handle_for(i)));
+    }
+    ASSERT_EQ(0u, index.erase(handle_for(0)));
+    ASSERT_EQ(num_instances / 2, index.size());
+    for (uint32_t i = 0; i < num_instances; ++i)
+    {
+        auto it = index.find(handle_for(i));
+        if (0 == i % 2)
+        {
+            ASSERT_EQ(index.end(), it);
+        }
+        else
+        {
+            ASSERT_NE(index.end(), it);
+            ASSERT_EQ(instances[i], it->second);
+        }
+    }
+
+    size_t iterated = 0;
+    for (const auto& entry : index)
+    {
+        ASSERT_EQ(1u, entry.first.value[0] % 2);
+        ++iterated;
+    }
+    ASSERT_EQ(num_instances / 2, iterated);
+
+    // Removed instances are reused, and returned to their initial state
+    auto result = index.emplace(handle_for(num_instances), allocation, allocation);
+    ASSERT_TRUE(result.second);
+    ASSERT_EQ(instances[num_instances - 2], result.first->second);
+    ASSERT_EQ(NEW_VIEW_STATE, instances[0]->view_state);
+}
+
+/*!
+ * Tests instances with available data are returned in handle order, regardless of the order in which they were
+ * received.
+ */
+TEST(DataReaderHistory, available_instances_are_ordered)
+{
+    TestType* type_ = new TestType();
+    EXPECT_CALL(*type_, createData()).Times(1);
+    EXPECT_CALL(*type_, deleteData(nullptr)).Times(1);
+
+    const TypeSupport type(type_);
+    type->m_isGetKeyDefined = true;
+    const Topic topic("test", "test");
+    DataReaderQos qos;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_instances = 100;
+    DataReaderHistory history(type, topic, qos);
+    eprosima::fastdds::RecursiveTimedMutex mutex;
+    eprosima::fastdds::rtps::StatelessReader reader(&history, &mutex);
+
+    constexpr uint32_t num_instances = 50;
+    std::vector<eprosima::fastdds::rtps::CacheChange_t> changes(num_instances);
+    for (uint32_t i = 0; i < num_instances; ++i)
+    {
+        auto& change = changes[i];
+        change.writerGUID = {{}, 1};
+        change.sequenceNumber = {0, i + 1};
+        change.instanceHandle = eprosima::fastdds::rtps::GUID_t{{}, (num_instances - i) * 7919};
+        ASSERT_TRUE(history.received_change(&change, 0));
+    }
+
+    InstanceHandle_t previous;
+    uint32_t count = 0;
+    auto result = history.lookup_available_instance(InstanceHandle_t(), false);
+    while (result.first)
+    {
+        if (previous.isDefined())
+        {
+            ASSERT_TRUE(previous < result.second->first);
+        }
+        previous = result.second->first;
+        ++count;
+        result = history.lookup_available_instance(previous, false);
+    }
+    ASSERT_EQ(num_instances, count);
+}
+
+/*!
+ * Tests that, when the limit of instances is reached, the non-alive instance with the lowest handle is the one
+ * replaced by a new instance.
+ */
+TEST(DataReaderHistory, lowest_non_alive_instance_is_reused)
+{
+    TestType* type_ = new TestType();
+    EXPECT_CALL(*type_, createData()).Times(1);
+    EXPECT_CALL(*type_, deleteData(nullptr)).Times(1);
+
+    const TypeSupport type(type_);
+    type->m_isGetKeyDefined = true;
+    const Topic topic("test", "test");
+    constexpr uint32_t num_instances = 20;
+    DataReaderQos qos;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_instances = num_instances;
+    DataReaderHistory history(type, topic, qos);
+    eprosima::fastdds::RecursiveTimedMutex mutex;
+    eprosima::fastdds::rtps::StatelessReader reader(&history, &mutex);
+
+    const eprosima::fastdds::rtps::GUID_t alive_writer{{}, 1};
+    const eprosima::fastdds::rtps::GUID_t removed_writer{{}, 2};
+
+    // Instances of odd samples are written by the writer that will be removed
+    std::vector<eprosima::fastdds::rtps::CacheChange_t> changes(num_instances + 1);
+    InstanceHandle_t lowest_non_alive;
+    for (uint32_t i = 0; i < num_instances; ++i)
+    {
+        auto& change = changes[i];
+        change.writerGUID = (0 == i % 2) ? alive_writer : removed_writer;
+        change.sequenceNumber = {0, i + 1};
+        change.instanceHandle = eprosima::fastdds::rtps::GUID_t{{}, (num_instances - i) * 7919};
+        ASSERT_TRUE(history.received_change(&change, 0));
+        history.update_instance_nts(&change);
+
+        if (1 == i % 2 && (!lowest_non_alive.isDefined() || change.instanceHandle < lowest_non_alive))
+        {
+            lowest_non_alive = change.instanceHandle;
+        }
+    }
+    history.writer_not_alive(removed_writer);
+
+    auto& change = changes[num_instances];
+    change.writerGUID = alive_writer;
+    change.sequenceNumber = {0, num_instances + 1};
+    change.instanceHandle = eprosima::fastdds::rtps::GUID_t{{}, (num_instances + 1) * 7919};
+    ASSERT_TRUE(history.received_change(&change, 0));
+
+    for (uint32_t i = 0; i < num_instances; ++i)
+    {
+        const InstanceHandle_t& handle = changes[i].instanceHandle;
+        EXPECT_EQ(handle != lowest_non_alive, history.lookup_available_instance(handle, true).first);
+    }
+    EXPECT_TRUE(history.lookup_available_instance(change.instanceHandle, true).first);
+}
+
 int main(
         int argc,
         char** argv)
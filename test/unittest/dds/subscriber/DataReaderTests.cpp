@@ -15,10 +15,12 @@
 #include <array>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <forward_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <thread>
 #include <type_traits>
@@ -2325,6 +2327,90 @@ TEST_F(DataReaderTests, Deserialization_errors)
         }
     }
 
+    // Check deserialization errors when taking samples without loans (samples are deserialized after taking them)
+    {
+        // Send a bunch of samples
+        for (char i = 0; i < num_samples; ++i)
+        {
+            data.message()[0] = i + '0';
+            EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+        }
+
+        // There are unread samples, so wait_for_unread should be ok
+        EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+        {
+            FooSeq data_seq(num_samples);
+            SampleInfoSeq info_seq(num_samples);
+
+            // This should return samples 0, 2, 4, 6, and 8, and remove all of them from the history
+            EXPECT_EQ(ok_code, data_reader_->take(data_seq, info_seq, num_samples));
+            check_collection(data_seq, true, num_samples, num_samples / 2);
+            check_collection(info_seq, true, num_samples, num_samples / 2);
+            check_sample_values(data_seq, "02468");
+
+            // Sample ranks should not count the samples which could not be deserialized
+            for (SampleInfoSeq::size_type i = 0; i < info_seq.length(); ++i)
+            {
+                EXPECT_EQ(num_samples / 2 - 1 - i, info_seq[i].sample_rank);
+            }
+        }
+
+        {
+            FooSeq data_seq(num_samples);
+            SampleInfoSeq info_seq(num_samples);
+            EXPECT_EQ(no_data_code, data_reader_->take(data_seq, info_seq, num_samples));
+        }
+    }
+
+    // Check that samples which fail deserialization after taking them are replaced with the next ones in the history
+    {
+        // Send a bunch of samples
+        for (char i = 0; i < num_samples; ++i)
+        {
+            data.message()[0] = i + '0';
+            EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+        }
+
+        // There are unread samples, so wait_for_unread should be ok
+        EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+        {
+            FooSeq data_seq(4);
+            SampleInfoSeq info_seq(4);
+
+            // This should return samples 0, 2, 4 and 6, taking samples 1, 3 and 5 on the way
+            EXPECT_EQ(ok_code, data_reader_->take(data_seq, info_seq, 4));
+            check_collection(data_seq, true, 4, 4);
+            check_collection(info_seq, true, 4, 4);
+            check_sample_values(data_seq, "0246");
+
+            for (SampleInfoSeq::size_type i = 0; i < info_seq.length(); ++i)
+            {
+                EXPECT_EQ(3 - i, info_seq[i].sample_rank);
+            }
+        }
+
+        {
+            FooSeq data_seq(1);
+            SampleInfoSeq info_seq(1);
+
+            // Sample 7 fails, but sample 8 is still in the history, so the take should not return NO_DATA
+            EXPECT_EQ(ok_code, data_reader_->take(data_seq, info_seq, 1));
+            check_collection(data_seq, true, 1, 1);
+            check_sample_values(data_seq, "8");
+            EXPECT_EQ(0, info_seq[0].sample_rank);
+        }
+
+        {
+            FooSeq data_seq(1);
+            SampleInfoSeq info_seq(1);
+
+            // Sample 9 fails and there is nothing left to replace it
+            EXPECT_EQ(no_data_code, data_reader_->take(data_seq, info_seq, 1));
+        }
+    }
+
     // Check deserialization errors with loans (loaned samples are not deserialized)
     {
         // Send a bunch of samples
@@ -2392,6 +2478,139 @@ TEST_F(DataReaderTests, Deserialization_errors)
 
 }
 
+/*
+ * This type blocks the first deserialization after being armed, until it is released
+ */
+class BlockingFooTypeSupport : public FooTypeSupport
+{
+
+public:
+
+    BlockingFooTypeSupport()
+        : FooTypeSupport()
+    {
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            if (armed_)
+            {
+                armed_ = false;
+                blocked_ = true;
+                cv_.notify_all();
+                cv_.wait_for(lock, std::chrono::seconds(5), [this]()
+                        {
+                            return !blocked_;
+                        });
+                blocked_ = false;
+            }
+        }
+        return FooTypeSupport::deserialize(payload, data);
+    }
+
+    void arm()
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        armed_ = true;
+    }
+
+    bool wait_blocked()
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        return cv_.wait_for(lock, std::chrono::seconds(5), [this]()
+                       {
+                           return blocked_;
+                       });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        blocked_ = false;
+        cv_.notify_all();
+    }
+
+private:
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool armed_ = false;
+    bool blocked_ = false;
+
+};
+
+/*
+ * This test checks that samples taken without loans do not use the resources of the reader while they are being
+ * deserialized, so new samples can be received up to the resource limits in the meantime.
+ * With synchronous intraprocess delivery, samples are received on the thread calling write.
+ */
+TEST_F(DataReaderTests, take_releases_resources_before_deserializing)
+{
+    BlockingFooTypeSupport* blocking_type = new BlockingFooTypeSupport();
+    type_.reset(blocking_type);
+
+    constexpr int32_t max_samples = 2;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = 1;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.resource_limits().max_instances = 1;
+    reader_qos.resource_limits().max_samples_per_instance = max_samples;
+    reader_qos.resource_limits().max_samples = max_samples;
+    reader_qos.resource_limits().allocated_samples = max_samples;
+    reader_qos.endpoint().history_memory_policy = eprosima::fastdds::rtps::PREALLOCATED_MEMORY_MODE;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(0);
+    data.message()[1] = '\0';
+
+    // Fill the reader
+    for (int32_t i = 0; i < max_samples; ++i)
+    {
+        data.message()[0] = static_cast<char>('0' + i);
+        EXPECT_EQ(RETCODE_OK, data_writer_->write(&data, handle_ok_));
+    }
+
+    // Take them on another thread, which blocks deserializing the first one
+    blocking_type->arm();
+    std::thread taker([this]()
+            {
+                FooSeq data_seq(max_samples);
+                SampleInfoSeq info_seq(max_samples);
+                EXPECT_EQ(RETCODE_OK, data_reader_->take(data_seq, info_seq, max_samples));
+                check_sample_values(data_seq, "01");
+            });
+    EXPECT_TRUE(blocking_type->wait_blocked());
+
+    // The reader should accept as many new samples as its limits allow
+    for (int32_t i = max_samples; i < 2 * max_samples; ++i)
+    {
+        data.message()[0] = static_cast<char>('0' + i);
+        EXPECT_EQ(RETCODE_OK, data_writer_->write(&data, handle_ok_));
+    }
+
+    blocking_type->release();
+    taker.join();
+
+    FooSeq data_seq(max_samples);
+    SampleInfoSeq info_seq(max_samples);
+    EXPECT_EQ(RETCODE_OK, data_reader_->take(data_seq, info_seq, max_samples));
+    check_sample_values(data_seq, "23");
+}
+
 TEST_F(DataReaderTests, TerminateWithoutDestroyingReader)
 {
     destroy_entities_ = false;
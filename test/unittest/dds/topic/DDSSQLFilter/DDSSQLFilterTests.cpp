@@ -27,7 +27,11 @@
 #include "fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp"
 
 #include "fastdds/dds/core/StackAllocatedSequence.hpp"
+#include "fastdds/dds/domain/DomainParticipantFactory.hpp"
 #include "fastdds/dds/log/Log.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp"
 
 #include "data_types/ContentFilterTestType.hpp"
 #include "data_types/ContentFilterTestTypePubSubTypes.h"
@@ -573,6 +577,12 @@ public:
         return the_instance.values_;
     }
 
+    static const std::vector<std::unique_ptr<IContentFilter::SerializedPayload>>& xcdr2_values()
+    {
+        static DDSSQLFilterValueGlobalData the_instance;
+        return the_instance.xcdr2_values_;
+    }
+
     static const std::array<std::array<std::array<bool, 5>, 5>, 6>& results()
     {
         static std::array<std::array<std::array<bool, 5>, 5>, 6> the_results;
@@ -641,6 +651,7 @@ public:
 private:
 
     std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> values_;
+    std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> xcdr2_values_;
 
     DDSSQLFilterValueGlobalData()
     {
@@ -683,6 +694,11 @@ private:
         auto payload = new IContentFilter::SerializedPayload(data_size);
         values_.emplace_back(payload);
         type_support.serialize(data_ptr, payload);
+
+        data_size = type_support.getSerializedSizeProvider(data_ptr, XCDR2_DATA_REPRESENTATION)();
+        payload = new IContentFilter::SerializedPayload(data_size);
+        xcdr2_values_.emplace_back(payload);
+        type_support.serialize(data_ptr, payload, XCDR2_DATA_REPRESENTATION);
     }
 
     void add_char_values(
@@ -1067,7 +1083,22 @@ TEST_P(DDSSQLFilterValueTests, test_filtered_value)
     EXPECT_EQ(RETCODE_OK, ret);
     ASSERT_NE(nullptr, filter_instance);
 
+    // Every field of the test type is supported by the field-access plan, except long double ones when the host
+    // representation does not match the serialized one
+    auto expression = static_cast<DDSSQLFilter::DDSFilterExpression*>(filter_instance);
+    if (16 == sizeof(long double) || std::string::npos == input.expression.find("long_double"))
+    {
+        ASSERT_TRUE(expression->has_plan());
+    }
+
+    perform_basic_check(filter_instance, results, values);
+    perform_basic_check(filter_instance, results, DDSSQLFilterValueGlobalData::xcdr2_values());
+
+    // Results should be the same when deserializing the payloads
+    ASSERT_FALSE(expression->compile_plan(xtypes::TypeObject()));
+    ASSERT_FALSE(expression->has_plan());
     perform_basic_check(filter_instance, results, values);
+    perform_basic_check(filter_instance, results, DDSSQLFilterValueGlobalData::xcdr2_values());
 
     ret = uut.delete_content_filter("DDSSQL", filter_instance);
     EXPECT_EQ(RETCODE_OK, ret);
@@ -1241,6 +1272,106 @@ TEST_F(DDSSQLFilterValueTests, test_update_params)
     EXPECT_EQ(RETCODE_OK, ret);
 }
 
+/*
+ * Checks that evaluating directly on the CDR payload of a type with many members gives the same
+ * results as the DynamicData based evaluation.
+ */
+TEST(DDSSQLFilterPlanTests, large_type)
+{
+    constexpr uint32_t num_members = 100;
+
+    DynamicTypeBuilderFactory::_ref_type type_factory {DynamicTypeBuilderFactory::get_instance()};
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name("LargeFilterTestType");
+    DynamicTypeBuilder::_ref_type builder {type_factory->create_type(type_descriptor)};
+    for (uint32_t i = 0; i < num_members; ++i)
+    {
+        MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+        member_descriptor->name("m_" + std::to_string(i));
+        switch (i % 3)
+        {
+            case 0:
+                member_descriptor->type(type_factory->get_primitive_type(TK_INT32));
+                break;
+            case 1:
+                member_descriptor->type(type_factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->
+                                build());
+                break;
+            default:
+                member_descriptor->type(type_factory->create_sequence_type(
+                            type_factory->get_primitive_type(TK_FLOAT64),
+                            static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+                break;
+        }
+        ASSERT_EQ(RETCODE_OK, builder->add_member(member_descriptor));
+    }
+    DynamicType::_ref_type type {builder->build()};
+    ASSERT_TRUE(type);
+
+    xtypes::TypeIdentifierPair type_ids;
+    ASSERT_EQ(RETCODE_OK, DomainParticipantFactory::get_instance()->type_object_registry().
+                    register_typeobject_w_dynamic_type(type, type_ids));
+
+    DynamicPubSubType type_support(type);
+    std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> payloads;
+    for (int32_t value : {99, 98})
+    {
+        DynamicData::_ref_type data {DynamicDataFactory::get_instance()->create_data(type)};
+        for (uint32_t i = 0; i < num_members; ++i)
+        {
+            MemberId id = data->get_member_id_by_name("m_" + std::to_string(i));
+            switch (i % 3)
+            {
+                case 0:
+                    data->set_int32_value(id, 99 == i ? value : static_cast<int32_t>(i));
+                    break;
+                case 1:
+                    data->set_string_value(id, "value_" + std::to_string(i));
+                    break;
+                default:
+                    data->set_float64_values(id, Float64Seq(i % 7, 3.14159));
+                    break;
+            }
+        }
+
+        for (DataRepresentationId_t representation : {XCDR_DATA_REPRESENTATION, XCDR2_DATA_REPRESENTATION})
+        {
+            uint32_t size = type_support.getSerializedSizeProvider(&data, representation)();
+            payloads.emplace_back(new IContentFilter::SerializedPayload(size));
+            ASSERT_TRUE(type_support.serialize(&data, payloads.back().get(), representation));
+        }
+    }
+
+    DDSSQLFilter::DDSFilterFactory uut;
+    IContentFilterFactory::ParameterSeq params;
+    IContentFilter* filter = nullptr;
+    ASSERT_EQ(RETCODE_OK, uut.create_content_filter("DDSSQL", "LargeFilterTestType", &type_support,
+            "m_99 = 99 AND m_49 LIKE 'value_%'", params, filter));
+    ASSERT_NE(nullptr, filter);
+
+    IContentFilter::FilterSampleInfo info;
+    rtps::GUID_t guid;
+    const std::vector<bool> expected {true, true, false, false};
+    auto check = [&]()
+            {
+                for (size_t i = 0; i < payloads.size(); ++i)
+                {
+                    EXPECT_EQ(expected[i], filter->evaluate(*payloads[i], info, guid)) << "with i = " << i;
+                }
+            };
+
+    auto expression = static_cast<DDSSQLFilter::DDSFilterExpression*>(filter);
+    ASSERT_TRUE(expression->has_plan());
+    check();
+
+    ASSERT_FALSE(expression->compile_plan(xtypes::TypeObject()));
+    ASSERT_FALSE(expression->has_plan());
+    check();
+
+    EXPECT_EQ(RETCODE_OK, uut.delete_content_filter("DDSSQL", filter));
+}
+
 static void add_test_filtered_value_inputs(
         const std::string& test_prefix,
         const std::string& field_name,
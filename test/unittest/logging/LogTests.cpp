@@ -21,6 +21,8 @@
 #include <gtest/gtest.h>
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <cstring>
 #include <thread>
 #include <chrono>
 #include <sstream>
@@ -663,6 +665,133 @@ TEST_F(LogTests, flush_n)
     loggind_thread.join();
 }
 
+/**
+ * This test checks that entries logged by several threads are all delivered, keeping the order in which each
+ * thread logged them, even when the per-thread queues overflow.
+ */
+TEST_F(LogTests, multithreaded_ordering)
+{
+    constexpr unsigned int n_threads = 4;
+    constexpr unsigned int n_logs = 5000;
+
+    Log::ClearConsumers();
+    std::vector<std::vector<unsigned int>> received(n_threads);
+    std::mutex received_mutex;
+    class OrderConsumer : public LogConsumer
+    {
+    public:
+
+        OrderConsumer(
+                std::vector<std::vector<unsigned int>>& received,
+                std::mutex& mutex)
+            : received_(received)
+            , mutex_(mutex)
+        {
+        }
+
+        void Consume(
+                const Log::Entry& entry) override
+        {
+            unsigned int thread_id = 0;
+            unsigned int index = 0;
+            std::istringstream message(entry.message);
+            message >> thread_id >> index;
+            std::lock_guard<std::mutex> guard(mutex_);
+            received_[thread_id].push_back(index);
+        }
+
+    private:
+
+        std::vector<std::vector<unsigned int>>& received_;
+        std::mutex& mutex_;
+    };
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new OrderConsumer(received, received_mutex)));
+
+    vector<unique_ptr<thread>> threads;
+    for (unsigned int i = 0; i < n_threads; i++)
+    {
+        threads.emplace_back(new thread([i]
+                {
+                    for (unsigned int n = 0; n < n_logs; ++n)
+                    {
+                        EPROSIMA_LOG_WARNING(Ordering, i << " " << n);
+                    }
+                }));
+    }
+
+    for (auto& thread: threads)
+    {
+        thread->join();
+    }
+    Log::Flush();
+
+    std::lock_guard<std::mutex> guard(received_mutex);
+    for (const auto& thread_entries : received)
+    {
+        ASSERT_EQ(n_logs, thread_entries.size());
+        for (unsigned int n = 0; n < n_logs; ++n)
+        {
+            ASSERT_EQ(n, thread_entries[n]);
+        }
+    }
+}
+
+/**
+ * This test checks that changes on the category filter apply to call sites that already logged.
+ */
+TEST_F(LogTests, category_filter_update)
+{
+    auto log_on_categories = []()
+            {
+                EPROSIMA_LOG_WARNING(FirstCategory, "First category message");
+                EPROSIMA_LOG_WARNING(SecondCategory, "Second category message");
+            };
+
+    log_on_categories();
+    Log::Flush();
+    ASSERT_EQ(2u, mockConsumer->ConsumedEntries().size());
+
+    Log::SetCategoryFilter(std::regex("(First)"));
+    log_on_categories();
+    Log::Flush();
+    ASSERT_EQ(3u, mockConsumer->ConsumedEntries().size());
+
+    Log::UnsetCategoryFilter();
+    log_on_categories();
+    Log::Flush();
+    ASSERT_EQ(5u, mockConsumer->ConsumedEntries().size());
+}
+
+/**
+ * This test checks that a consumer can log from a call site that has not logged before.
+ */
+TEST_F(LogTests, consumer_logs_new_category)
+{
+    class LoggingConsumer : public LogConsumer
+    {
+    public:
+
+        void Consume(
+                const Log::Entry& entry) override
+        {
+            if (0 == strcmp(entry.context.category, "Trigger"))
+            {
+                EPROSIMA_LOG_WARNING(FromConsumer, "Message from the consumer");
+            }
+        }
+
+    };
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new LoggingConsumer));
+
+    EPROSIMA_LOG_WARNING(Trigger, "Trigger message");
+    Log::Flush();
+    Log::Flush();
+
+    auto entries = mockConsumer->ConsumedEntries();
+    ASSERT_EQ(2u, entries.size());
+    ASSERT_STREQ("FromConsumer", entries[1].context.category);
+}
+
 /**
  * The goal of this test is to be able to manually check that the thread settings are applied, using an external
  * tool like `htop` in Linux.
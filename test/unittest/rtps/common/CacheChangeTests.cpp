@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <climits>
+#include <cstring>
+#include <random>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -135,6 +138,67 @@ TEST(CacheChange, FragmentManagement)
     }
 }
 
+/*!
+ * Fragments of a change with several words of missing fragments are received in random order, some of them
+ * repeated. Checks the missing fragments after each step and that the data ends up on its final position.
+ */
+TEST(CacheChange, FragmentManagementRandomOrder)
+{
+    constexpr uint16_t fragment_size = 7;
+    constexpr uint32_t num_fragments = 150;
+    constexpr uint32_t length = fragment_size * (num_fragments - 1) + 3;
+
+    std::vector<octet> expected(length);
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        expected[i] = static_cast<octet>(i * 31u);
+    }
+
+    CacheChange_t uut(length);
+    uut.serializedPayload.length = length;
+    uut.setFragmentSize(fragment_size, true);
+    ASSERT_EQ(num_fragments, uut.getFragmentCount());
+    EXPECT_FALSE(uut.contains_first_fragment());
+
+    std::vector<bool> missing(num_fragments, true);
+    std::mt19937 rng(1);
+    while (!uut.is_fully_assembled())
+    {
+        uint32_t first = static_cast<uint32_t>(rng() % num_fragments);
+        uint32_t count = std::min(num_fragments - first, static_cast<uint32_t>(1 + rng() % 5));
+
+        SerializedPayload_t fragments(fragment_size * count);
+        uint32_t offset = first * fragment_size;
+        fragments.length = std::min(fragment_size * count, length - offset);
+        memcpy(fragments.data, &expected[offset], fragments.length);
+        uut.add_fragments(fragments, first + 1, count);
+        std::fill(missing.begin() + first, missing.begin() + first + count, false);
+
+        auto first_missing = std::find(missing.begin(), missing.end(), true);
+        FragmentNumberSet_t fns;
+        uut.get_missing_fragments(fns);
+        if (missing.end() == first_missing)
+        {
+            EXPECT_TRUE(fns.empty());
+            continue;
+        }
+
+        FragmentNumber_t base = static_cast<FragmentNumber_t>(first_missing - missing.begin()) + 1;
+        ASSERT_EQ(base, fns.base());
+        EXPECT_EQ(!missing[0], uut.contains_first_fragment());
+        for (FragmentNumber_t i = base; i <= num_fragments && i < base + 256u; ++i)
+        {
+            EXPECT_EQ(missing[i - 1], fns.is_set(i)) << "fragment " << i;
+        }
+    }
+
+    EXPECT_TRUE(std::none_of(missing.begin(), missing.end(), [](bool m)
+            {
+                return m;
+            }));
+    EXPECT_EQ(0, memcmp(uut.serializedPayload.data, expected.data(), length));
+}
+
 int main(
         int argc,
         char** argv)
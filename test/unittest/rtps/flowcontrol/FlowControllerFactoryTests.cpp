@@ -14,6 +14,10 @@
 
 #include <rtps/flowcontrol/FlowControllerFactory.hpp>
 #include <rtps/flowcontrol/FlowControllerImpl.hpp>
+#include <rtps/flowcontrol/ShardedFlowController.hpp>
+
+#include <limits>
+#include <set>
 
 #include <gtest/gtest.h>
 
@@ -160,6 +164,75 @@ TEST(FlowControllerFactory, register_flow_controllers)
     ASSERT_TRUE(nullptr != async_limited_reserv_flow);
 }
 
+TEST(FlowControllerFactory, register_sharded_flow_controllers)
+{
+    FlowControllerFactory factory;
+    FlowController* flow_controller = nullptr;
+    FlowControllerDescriptor flow_controller_descr;
+    eprosima::fastdds::rtps::WriterAttributes writer_attributes;
+
+    // Initialize factory.
+    factory.init(nullptr);
+
+    // A single sender thread keeps creating a plain flow controller
+    const char* async_single = "AsyncFlowControllerSingleThread";
+    flow_controller_descr.name = async_single;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::ROUND_ROBIN;
+    flow_controller_descr.num_sender_threads = 1;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_single, writer_attributes);
+    ASSERT_TRUE(nullptr != flow_controller);
+    ASSERT_TRUE(nullptr == dynamic_cast<ShardedFlowController*>(flow_controller));
+
+    // Unlimited sharded flow controller
+    const char* async_sharded = "AsyncShardedFlowController";
+    flow_controller_descr.name = async_sharded;
+    flow_controller_descr.num_sender_threads = 4;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_sharded, writer_attributes);
+    ShardedFlowController* async_sharded_flow = dynamic_cast<ShardedFlowController*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_sharded_flow);
+    EXPECT_EQ(4u, async_sharded_flow->size());
+    EXPECT_EQ((std::numeric_limits<uint32_t>::max)(), async_sharded_flow->get_max_payload());
+
+    // Writers created consecutively on a participant are spread among all the shards
+    std::set<size_t> used_shards;
+    GUID_t writer_guid;
+    writer_guid.guidPrefix.value[0] = 0x01;
+    writer_guid.guidPrefix.value[11] = 0x0B;
+    for (uint8_t key = 1; key <= 4; ++key)
+    {
+        writer_guid.entityId = EntityId_t(key * 0x100 + 0x03);
+        size_t index = async_sharded_flow->shard_index(writer_guid);
+        EXPECT_EQ(index, async_sharded_flow->shard_index(writer_guid));
+        used_shards.insert(index);
+    }
+    EXPECT_EQ(4u, used_shards.size());
+
+    // The whole GUID is used, so the first writers of different participants are spread among the shards
+    used_shards.clear();
+    writer_guid.entityId = EntityId_t(0x103);
+    for (uint8_t participant = 0; participant < 16; ++participant)
+    {
+        writer_guid.guidPrefix.value[11] = participant;
+        used_shards.insert(async_sharded_flow->shard_index(writer_guid));
+    }
+    EXPECT_LT(1u, used_shards.size());
+
+    // Limited sharded flow controller shares the bandwidth among the shards
+    const char* async_limited_sharded = "AsyncLimitedShardedFlowController";
+    flow_controller_descr.name = async_limited_sharded;
+    flow_controller_descr.max_bytes_per_period = 4000;
+    flow_controller_descr.period_ms = 10;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_limited_sharded, writer_attributes);
+    ShardedFlowController* async_limited_sharded_flow = dynamic_cast<ShardedFlowController*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_limited_sharded_flow);
+    EXPECT_EQ(4u, async_limited_sharded_flow->size());
+    // Any shard can send up to the whole bandwidth if the others are not using it
+    EXPECT_EQ(4000u, async_limited_sharded_flow->get_max_payload());
+}
+
 int main(
         int argc,
         char** argv)
@@ -642,3 +642,71 @@ TYPED_TEST(FlowControllerPublishModes, limited_async_publish_mode)
 
     async.unregister_writer(&writer1);
 }
+
+TYPED_TEST(FlowControllerPublishModes, limited_async_publish_mode_with_pacing)
+{
+    // Five samples per period, but only one of them can be sent back-to-back.
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 51000;
+    flow_controller_descr.period_ms = 50;
+    flow_controller_descr.max_burst_bytes = 10200;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+    EXPECT_EQ(10200u, async.get_max_payload());
+    async.init();
+
+    eprosima::fastdds::rtps::RTPSWriter writer1;
+    std::vector<std::chrono::steady_clock::time_point> delivery_times;
+
+    auto send_functor = [&](
+        eprosima::fastdds::rtps::CacheChange_t* change,
+        eprosima::fastdds::rtps::RTPSMessageGroup&,
+        eprosima::fastdds::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    delivery_times.push_back(std::chrono::steady_clock::now());
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            get_current_bytes_processed()).WillRepeatedly(ReturnPointee(&this->current_bytes_processed));
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            reset_current_bytes_processed()).WillRepeatedly([&]()
+            {
+                this->current_bytes_processed = 0;
+            });
+
+    async.register_writer(&writer1);
+
+    std::vector<eprosima::fastdds::rtps::CacheChange_t> changes(5);
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        INIT_CACHE_CHANGE(changes[i], writer1, i + 1);
+        EXPECT_CALL(writer1,
+                deliver_sample_nts(&changes[i], _, Ref(writer1.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastdds::rtps::DeliveryRetCode::DELIVERED)));
+    }
+
+    writer1.getMutex().lock();
+    for (auto& change : changes)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(changes.size());
+
+    // Each sample waits for the tokens consumed by the previous one, around 10ms.
+    for (size_t i = 1; i < delivery_times.size(); ++i)
+    {
+        EXPECT_LE(std::chrono::milliseconds(8), delivery_times[i] - delivery_times[i - 1]);
+    }
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+}
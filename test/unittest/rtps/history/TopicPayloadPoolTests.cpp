@@ -17,7 +17,10 @@
 #include <rtps/history/TopicPayloadPool.hpp>
 #include <fastdds/rtps/common/CacheChange.h>
 
+#include <cstring>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 using namespace eprosima::fastdds::rtps;
 using namespace ::testing;
@@ -483,6 +486,72 @@ TEST(TopicPayloalPoolTests, dynamic_reusable_memory_zero_size)
     do_dynamic_topic_payload_pool_zero_size_test(config);
 }
 
+/**
+ * Several threads get and release payloads from the same pool concurrently, each one keeping a few payloads in use.
+ * Checks that a payload is never given to two threads at the same time, and that all of them return to the pool.
+ */
+TEST(TopicPayloalPoolTests, concurrent_get_release)
+{
+    constexpr size_t num_threads = 8;
+    constexpr size_t in_use = 4;
+    constexpr size_t iterations = 50000;
+
+    for (MemoryManagementPolicy_t policy : {PREALLOCATED_MEMORY_MODE, PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
+                                            DYNAMIC_REUSABLE_MEMORY_MODE})
+    {
+        PoolConfig config{ policy, 128, 0, 0 };
+        std::shared_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        ASSERT_TRUE(pool->reserve_history(config, false));
+
+        std::vector<std::thread> threads;
+        std::vector<char> results(num_threads, 0);
+        for (size_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back([&pool, &results, t]()
+                    {
+                        std::vector<SerializedPayload_t> payloads(in_use);
+                        bool ok = true;
+                        for (size_t i = 0; ok && i < iterations; ++i)
+                        {
+                            SerializedPayload_t& payload = payloads[i % in_use];
+                            if (nullptr != payload.data)
+                            {
+                                // Nobody else should have written on the payload while this thread owned it
+                                ok = (payload.data[0] == static_cast<octet>(t)) &&
+                                (0 == std::memcmp(payload.data, payload.data + 1, payload.max_size - 1));
+                                ok = pool->release_payload(payload) && ok;
+                            }
+                            ok = ok && pool->get_payload(128, payload);
+                            if (ok)
+                            {
+                                std::memset(payload.data, static_cast<int>(t), payload.max_size);
+                            }
+                        }
+                        for (SerializedPayload_t& payload : payloads)
+                        {
+                            if (nullptr != payload.data)
+                            {
+                                ok = pool->release_payload(payload) && ok;
+                            }
+                        }
+                        results[t] = ok ? 1 : 0;
+                    });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t t = 0; t < num_threads; ++t)
+        {
+            EXPECT_EQ(1, results[t]);
+        }
+        EXPECT_EQ(pool->payload_pool_allocated_size(), pool->payload_pool_available_size());
+
+        EXPECT_TRUE(pool->release_history(config, false));
+    }
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
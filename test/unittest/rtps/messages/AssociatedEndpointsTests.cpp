@@ -0,0 +1,189 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/EntityId_t.hpp>
+
+#include <rtps/messages/AssociatedEndpoints.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+struct TestEndpoint
+{
+    EntityId_t entity_id;
+    std::atomic<bool> alive{true};
+    std::atomic<uint32_t> calls{0};
+};
+
+using TestEndpoints = AssociatedEndpoints<TestEndpoint>;
+
+static EntityId_t make_entity_id(
+        uint32_t key,
+        octet kind)
+{
+    EntityId_t ret;
+    ret.value[0] = static_cast<octet>(key >> 16);
+    ret.value[1] = static_cast<octet>(key >> 8);
+    ret.value[2] = static_cast<octet>(key);
+    ret.value[3] = kind;
+    return ret;
+}
+
+static std::vector<TestEndpoint*> find_all(
+        const TestEndpoints& endpoints,
+        const EntityId_t& entity_id)
+{
+    std::vector<TestEndpoint*> ret;
+    TestEndpoints::ReadGuard guard(endpoints);
+    guard->for_each(entity_id, [&ret](TestEndpoint* endpoint)
+            {
+                ret.push_back(endpoint);
+            });
+    return ret;
+}
+
+TEST(AssociatedEndpoints, add_remove_lookup)
+{
+    std::deque<TestEndpoint> storage(12);
+    TestEndpoints endpoints;
+    EXPECT_TRUE(endpoints.empty());
+
+    // Builtin readers share the entity id on every participant
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        storage[i].entity_id = (i < 4) ? c_EntityId_SPDPReader : make_entity_id(static_cast<uint32_t>(i), 0x07);
+        EXPECT_TRUE(endpoints.add(storage[i].entity_id, &storage[i]));
+    }
+    EXPECT_FALSE(endpoints.add(storage[5].entity_id, &storage[5]));
+    EXPECT_FALSE(endpoints.empty());
+
+    {
+        TestEndpoints::ReadGuard guard(endpoints);
+        EXPECT_EQ(9u, guard->size());
+        EXPECT_EQ(&storage[0], guard->find_first(c_EntityId_SPDPReader));
+        EXPECT_EQ(&storage[7], guard->find_first(storage[7].entity_id));
+        EXPECT_EQ(nullptr, guard->find_first(make_entity_id(100, 0x07)));
+        EXPECT_NE(nullptr, guard->find_first(c_EntityId_Unknown));
+    }
+
+    // Endpoints with the same entity id keep the order they were added
+    std::vector<TestEndpoint*> expected {&storage[0], &storage[1], &storage[2], &storage[3]};
+    EXPECT_EQ(expected, find_all(endpoints, c_EntityId_SPDPReader));
+    EXPECT_EQ(std::vector<TestEndpoint*>{&storage[9]}, find_all(endpoints, storage[9].entity_id));
+    EXPECT_TRUE(find_all(endpoints, make_entity_id(100, 0x07)).empty());
+    EXPECT_EQ(storage.size(), find_all(endpoints, c_EntityId_Unknown).size());
+
+    EXPECT_TRUE(endpoints.remove(&storage[1]));
+    EXPECT_FALSE(endpoints.remove(&storage[1]));
+    expected = {&storage[0], &storage[2], &storage[3]};
+    EXPECT_EQ(expected, find_all(endpoints, c_EntityId_SPDPReader));
+
+    for (auto& endpoint : storage)
+    {
+        endpoints.remove(&endpoint);
+    }
+    EXPECT_TRUE(endpoints.empty());
+    EXPECT_TRUE(find_all(endpoints, c_EntityId_Unknown).empty());
+    EXPECT_EQ(nullptr, TestEndpoints::ReadGuard(endpoints)->find_first(c_EntityId_Unknown));
+}
+
+TEST(AssociatedEndpoints, many_entities)
+{
+    constexpr uint32_t num_entities = 1000;
+    std::deque<TestEndpoint> storage(num_entities);
+    TestEndpoints endpoints;
+
+    for (uint32_t i = 0; i < num_entities; ++i)
+    {
+        storage[i].entity_id = make_entity_id(i / 2, (i % 2) ? 0x04 : 0x07);
+        ASSERT_TRUE(endpoints.add(storage[i].entity_id, &storage[i]));
+    }
+
+    TestEndpoints::ReadGuard guard(endpoints);
+    EXPECT_EQ(num_entities, guard->size());
+    for (uint32_t i = 0; i < num_entities; ++i)
+    {
+        EXPECT_EQ(&storage[i], guard->find_first(storage[i].entity_id));
+    }
+}
+
+/*!
+ * Endpoints are removed while a thread looks them up. Once remove returns, the endpoint is destroyed, and no lookup
+ * should be using it.
+ */
+TEST(AssociatedEndpoints, remove_waits_for_lookups)
+{
+    constexpr size_t num_endpoints = 8;
+    constexpr size_t num_iterations = 2000;
+
+    std::deque<TestEndpoint> storage(num_endpoints);
+    TestEndpoints endpoints;
+    for (size_t i = 0; i < num_endpoints; ++i)
+    {
+        storage[i].entity_id = make_entity_id(static_cast<uint32_t>(i % 3), 0x07);
+        endpoints.add(storage[i].entity_id, &storage[i]);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint32_t> errors{0};
+    std::thread receiver([&]()
+            {
+                while (!stop)
+                {
+                    TestEndpoints::ReadGuard guard(endpoints);
+                    guard->for_each(c_EntityId_Unknown, [&errors](TestEndpoint* endpoint)
+                    {
+                        if (!endpoint->alive)
+                        {
+                            ++errors;
+                        }
+                        ++endpoint->calls;
+                        std::this_thread::yield();
+                        if (!endpoint->alive)
+                        {
+                            ++errors;
+                        }
+                    });
+                }
+            });
+
+    for (size_t n = 0; n < num_iterations; ++n)
+    {
+        TestEndpoint& endpoint = storage[n % num_endpoints];
+        ASSERT_TRUE(endpoints.remove(&endpoint));
+        // The endpoint would be destroyed here
+        endpoint.alive = false;
+        std::this_thread::yield();
+        endpoint.alive = true;
+        ASSERT_TRUE(endpoints.add(endpoint.entity_id, &endpoint));
+    }
+
+    stop = true;
+    receiver.join();
+    EXPECT_EQ(0u, errors.load());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -12,8 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <climits>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -88,7 +94,9 @@ protected:
         {
             ss << test_name;
         }
-        ss << "_" << eprosima::SystemInfo::instance().process_id() << ".db";
+        ss << "_" << eprosima::SystemInfo::instance().process_id();
+        logfile = ss.str();
+        ss << ".db";
         dbfile = ss.str();
     }
 
@@ -100,6 +108,34 @@ protected:
         }
 
         std::remove(dbfile.c_str());
+        for (const std::string& guid : log_guids)
+        {
+            remove_log_files(guid);
+        }
+    }
+
+    //! Remove the files of the log stored by builtin.LOG for a persistence GUID
+    void remove_log_files(
+            const std::string& guid)
+    {
+        std::string base_name = logfile + "_" + guid;
+        uint64_t first_index = 0;
+        {
+            std::ifstream head(base_name + ".head");
+            head >> first_index;
+        }
+        std::remove((base_name + ".head").c_str());
+        std::remove((base_name + ".head.tmp").c_str());
+
+        // Compactions remove the segments before the one on the head file
+        for (uint64_t index = 0;; ++index)
+        {
+            if (0 != std::remove((base_name + "_" + std::to_string(index) + ".log").c_str()) &&
+                    first_index < index)
+            {
+                break;
+            }
+        }
     }
 
     void create_database(
@@ -248,6 +284,12 @@ protected:
     }
 
     std::string dbfile = "text.db";
+
+    //! Prefix of the files of builtin.LOG
+    std::string logfile = "text";
+
+    //! Persistence GUIDs whose log files are removed after the test
+    std::vector<std::string> log_guids;
 };
 
 /*!
@@ -460,6 +502,485 @@ TEST_F(PersistenceTest, Reader)
     ASSERT_EQ(seq_map_loaded, seq_map);
 }
 
+/*!
+ * @fn TEST_F(PersistenceTest, AsyncWriter)
+ * @brief This test checks the writer persistence interface of the persistence service with asynchronous commits.
+ */
+TEST_F(PersistenceTest, AsyncWriter)
+{
+    const std::string persist_guid("TEST_WRITER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.async_commit", "true");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    // Add two changes, which are loaded without waiting explicitly for them to be stored
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    change.sequenceNumber.low = 2;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 2u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+    ASSERT_TRUE(service->flush());
+
+    // Adding the same sequence again is reported by the next flush
+    change.sequenceNumber.low = 2;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    ASSERT_FALSE(service->flush());
+    ASSERT_TRUE(service->flush());
+
+    // Remove both changes
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    change.sequenceNumber.low = 2;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    ASSERT_TRUE(service->flush());
+
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 0u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+
+    // Changes queued when the service is destroyed are stored
+    change.sequenceNumber.low = 3;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 1u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 3u));
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, AsyncReader)
+ * @brief This test checks the reader persistence interface of the persistence service with asynchronous commits.
+ */
+TEST_F(PersistenceTest, AsyncReader)
+{
+    const char* persist_guid = "TEST_READER";
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.async_commit", "true");
+    policy.properties().emplace_back("dds.persistence.async_commit.max_delay_ms", "100");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    IPersistenceService::map_allocator_t pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map(pool);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(pool);
+    GUID_t guid_1(GuidPrefix_t::unknown(), 1U);
+    GUID_t guid_2(GuidPrefix_t::unknown(), 2U);
+
+    // Only the last value of each writer is loaded
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        seq_map[guid_1] = SequenceNumber_t(0, i);
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_1, SequenceNumber_t(0, i)));
+        seq_map[guid_2] = SequenceNumber_t(0, 2 * i);
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_2, SequenceNumber_t(0, 2 * i)));
+    }
+
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+    ASSERT_TRUE(service->flush());
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, LogWriter)
+ * @brief This test checks the writer persistence interface of the log persistence service.
+ */
+TEST_F(PersistenceTest, LogWriter)
+{
+    const std::string persist_guid("TEST_WRITER");
+    log_guids.push_back(persist_guid);
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.LOG");
+    policy.properties().emplace_back("dds.persistence.log.filename", logfile);
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    // Initial load should return empty vector
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 0u);
+
+    // Add two changes
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    change.sequenceNumber.low = 2;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+
+    // Should not be able to add same sequence again
+    change.sequenceNumber.low = 1;
+    ASSERT_FALSE(service->add_writer_change_to_storage(persist_guid, change));
+
+    // Loading should return two changes (seqs = 1, 2)
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 2u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+    uint32_t i = 0;
+    for (auto it : history.m_changes)
+    {
+        ++i;
+        ASSERT_EQ(it->sequenceNumber, SequenceNumber_t(0, i));
+    }
+
+    // Remove seq = 1, and test it can be safely removed twice
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    ASSERT_TRUE(service->flush());
+
+    // The log is recovered by a new service (seq = 2)
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 1u);
+    ASSERT_EQ((*history.m_changes.begin())->sequenceNumber, SequenceNumber_t(0, 2));
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+
+    // Remove seq = 2, and check that load returns empty vector
+    history.m_changes.clear();
+    change.sequenceNumber.low = 2;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 0u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, LogReader)
+ * @brief This test checks the reader persistence interface of the log persistence service.
+ */
+TEST_F(PersistenceTest, LogReader)
+{
+    const std::string persist_guid("TEST_READER");
+    log_guids.push_back(persist_guid);
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.LOG");
+    policy.properties().emplace_back("dds.persistence.log.filename", logfile);
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    IPersistenceService::map_allocator_t pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map(pool);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(pool);
+    GUID_t guid_1(GuidPrefix_t::unknown(), 1U);
+    GUID_t guid_2(GuidPrefix_t::unknown(), 2U);
+
+    // Initial load should return empty map
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded.size(), 0u);
+
+    // Only the last value of each writer is loaded
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        seq_map[guid_1] = SequenceNumber_t(0, i);
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_1, SequenceNumber_t(0, i)));
+        seq_map[guid_2] = SequenceNumber_t(0, 2 * i);
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_2, SequenceNumber_t(0, 2 * i)));
+    }
+
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+
+    // The log is recovered by a new service
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, LogCompaction)
+ * @brief This test checks that the log persistence service removes the segments which are no longer needed.
+ */
+TEST_F(PersistenceTest, LogCompaction)
+{
+    constexpr uint32_t num_changes = 2000;
+    constexpr uint32_t history_depth = 10;
+    const std::string persist_guid("TEST_WRITER");
+    log_guids.push_back(persist_guid);
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.LOG");
+    policy.properties().emplace_back("dds.persistence.log.filename", logfile);
+    policy.properties().emplace_back("dds.persistence.log.segment_size", "4096");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    std::vector<octet> data(64);
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.data = data.data();
+    change.serializedPayload.length = static_cast<uint32_t>(data.size());
+
+    // Keep only the last changes, as a writer with a KEEP_LAST history would do
+    for (uint32_t i = 1; i <= num_changes; ++i)
+    {
+        std::fill(data.begin(), data.end(), static_cast<octet>(i));
+        change.sequenceNumber = SequenceNumber_t(0, i);
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+        if (history_depth < i)
+        {
+            change.sequenceNumber = SequenceNumber_t(0, i - history_depth);
+            ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+        }
+    }
+
+    // The payload belongs to the vector
+    change.serializedPayload.data = nullptr;
+
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, history_depth, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    WriterHistory history;
+
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), history_depth);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, num_changes));
+    uint32_t i = num_changes - history_depth;
+    for (auto it : history.m_changes)
+    {
+        ++i;
+        ASSERT_EQ(it->sequenceNumber, SequenceNumber_t(0, i));
+        ASSERT_EQ(it->serializedPayload.length, data.size());
+        ASSERT_EQ(it->serializedPayload.data[0], static_cast<octet>(i));
+    }
+
+    // The first segments have been removed
+    std::string first_segment = logfile + "_" + persist_guid + "_0.log";
+    ASSERT_FALSE(eprosima::SystemInfo::file_exists(first_segment));
+
+    // The head file has replaced the temporary one written during the compaction
+    std::string head_name = logfile + "_" + persist_guid + ".head";
+    ASSERT_TRUE(eprosima::SystemInfo::file_exists(head_name));
+    ASSERT_FALSE(eprosima::SystemInfo::file_exists(head_name + ".tmp"));
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, LogIncompleteRecord)
+ * @brief This test checks that the log persistence service discards a change partially written.
+ */
+TEST_F(PersistenceTest, LogIncompleteRecord)
+{
+    const std::string persist_guid("TEST_WRITER");
+    log_guids.push_back(persist_guid);
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.LOG");
+    policy.properties().emplace_back("dds.persistence.log.filename", logfile);
+    policy.properties().emplace_back("dds.persistence.log.segment_size", "65536");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    std::vector<octet> data(64, 0xAA);
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.data = data.data();
+    change.serializedPayload.length = static_cast<uint32_t>(data.size());
+
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        change.sequenceNumber = SequenceNumber_t(0, i);
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+    delete service;
+    service = nullptr;
+
+    // Modify the last byte of the payload of the last change
+    std::string segment_name = logfile + "_" + persist_guid + "_0.log";
+    {
+        std::fstream segment(segment_name, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        std::string content((std::istreambuf_iterator<char>(segment)), std::istreambuf_iterator<char>());
+        size_t last = content.find_last_not_of('\0');
+        ASSERT_NE(last, std::string::npos);
+        segment.clear();
+        segment.seekp(static_cast<std::streamoff>(last));
+        segment.put(0x55);
+    }
+
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    WriterHistory history;
+
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 2u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+
+    // The changes added afterwards are recovered
+    change.sequenceNumber = SequenceNumber_t(0, 3);
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    change.serializedPayload.data = nullptr;
+
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 3u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 3u));
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, WriterRecovery)
+ * @brief This test checks that a history stored with each persistence plugin is fully recovered.
+ */
+TEST_F(PersistenceTest, WriterRecovery)
+{
+    constexpr uint32_t num_changes = 100;
+    const std::string persist_guid("TEST_WRITER");
+    log_guids.push_back(persist_guid);
+
+    std::vector<octet> data(64);
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.data = data.data();
+    change.serializedPayload.length = static_cast<uint32_t>(data.size());
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, num_changes, 0 };
+
+    for (const char* plugin : {"builtin.SQLITE3", "builtin.LOG"})
+    {
+        PropertyPolicy policy;
+        policy.properties().emplace_back("dds.persistence.plugin", plugin);
+        policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+        policy.properties().emplace_back("dds.persistence.log.filename", logfile);
+        policy.properties().emplace_back("dds.persistence.async_commit", "true");
+        service = PersistenceFactory::create_persistence_service(policy);
+        ASSERT_NE(service, nullptr);
+
+        for (uint32_t i = 1; i <= num_changes; ++i)
+        {
+            std::fill(data.begin(), data.end(), static_cast<octet>(i));
+            change.sequenceNumber = SequenceNumber_t(0, i);
+            ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+        }
+        ASSERT_TRUE(service->flush());
+
+        delete service;
+        service = PersistenceFactory::create_persistence_service(policy);
+        ASSERT_NE(service, nullptr);
+
+        auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+        SequenceNumber_t max_seq;
+        WriterHistory history;
+        ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+        ASSERT_EQ(history.m_changes.size(), num_changes);
+        ASSERT_EQ(max_seq, SequenceNumber_t(0, num_changes));
+        uint32_t i = 0;
+        for (auto it : history.m_changes)
+        {
+            ++i;
+            ASSERT_EQ(it->sequenceNumber, SequenceNumber_t(0, i));
+            ASSERT_EQ(it->serializedPayload.length, data.size());
+            ASSERT_EQ(it->serializedPayload.data[0], static_cast<octet>(i));
+            ASSERT_EQ(it->serializedPayload.data[data.size() - 1], static_cast<octet>(i));
+        }
+
+        for (auto it : history.m_changes)
+        {
+            pool->release_cache(it);
+        }
+        history.m_changes.clear();
+        delete service;
+        service = nullptr;
+    }
+
+    // The payload belongs to the vector
+    change.serializedPayload.data = nullptr;
+}
+
 int main(
         int argc,
         char** argv)
@@ -12,8 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <random>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -506,6 +511,65 @@ TEST(TimedEvent, Event_UnregisterEventWithinCallbackOfAnotherEvent)
 
 }
 
+/*!
+ * @fn TEST(TimedEvent, Event_ShortTimerAmongManyActiveTimers)
+ * @brief This test checks that a short timer is triggered on time while lots of long timers are active and being
+ * rescheduled.
+ */
+TEST(TimedEvent, Event_ShortTimerAmongManyActiveTimers)
+{
+    using TimedEvent = eprosima::fastdds::rtps::TimedEvent;
+
+    constexpr size_t num_timers = 1000;
+    constexpr size_t reschedules_per_iteration = 10;
+    constexpr int num_iterations = 20;
+
+    auto periodic_callback = []()
+            {
+                return true;
+            };
+
+    // Long timers, spread between 10 and 20 seconds so none of them is triggered during the test
+    std::vector<std::unique_ptr<TimedEvent>> timers;
+    timers.reserve(num_timers);
+    for (size_t i = 0; i < num_timers; ++i)
+    {
+        timers.emplace_back(new TimedEvent(*env->service_, periodic_callback, 10000.0 + (i * 10) % 10000));
+        timers.back()->restart_timer();
+    }
+
+    std::condition_variable cv;
+    std::mutex mtx;
+    bool triggered = false;
+    auto callback = [&]()
+            {
+                std::lock_guard<std::mutex> guard(mtx);
+                triggered = true;
+                cv.notify_one();
+
+                return false;
+            };
+    TimedEvent newcomer_event(*env->service_, callback, 1.0);
+
+    for (int n = 0; n < num_iterations; ++n)
+    {
+        for (size_t i = 0; i < reschedules_per_iteration; ++i)
+        {
+            TimedEvent& timer = *timers[(n * reschedules_per_iteration + i) % num_timers];
+            timer.cancel_timer();
+            timer.restart_timer();
+        }
+
+        std::unique_lock<std::mutex> lock(mtx);
+        triggered = false;
+        newcomer_event.restart_timer();
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]()
+                {
+                    return triggered;
+                }));
+    }
+}
+
 int main(
         int argc,
         char** argv)
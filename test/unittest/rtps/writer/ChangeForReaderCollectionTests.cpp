@@ -0,0 +1,154 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/CacheChange.h>
+
+#include <rtps/writer/ChangeForReaderCollection.hpp>
+
+using namespace eprosima::fastdds;
+using namespace eprosima::fastdds::rtps;
+
+class ChangeForReaderCollectionTests : public ::testing::Test
+{
+protected:
+
+    ChangeForReader_t make_change(
+            uint32_t seq,
+            ChangeForReaderStatus_t status = UNSENT)
+    {
+        changes_.emplace_back();
+        changes_.back().sequenceNumber = SequenceNumber_t(0, seq);
+        ChangeForReader_t ret(&changes_.back());
+        ret.setStatus(status);
+        return ret;
+    }
+
+    std::deque<CacheChange_t> changes_;
+};
+
+TEST_F(ChangeForReaderCollectionTests, find_with_holes)
+{
+    ChangeForReaderCollection uut(ResourceLimitedContainerConfig(4));
+    EXPECT_EQ(uut.end(), uut.find(SequenceNumber_t(0, 1)));
+
+    std::vector<uint32_t> sequences {3, 4, 5, 9, 10, 20, 21, 22, 40};
+    for (uint32_t seq : sequences)
+    {
+        uut.push_back(make_change(seq));
+    }
+    ASSERT_EQ(sequences.size(), uut.size());
+
+    for (uint32_t seq = 0; seq < 50; ++seq)
+    {
+        SequenceNumber_t seq_num(0, seq);
+        auto expected = std::lower_bound(sequences.begin(), sequences.end(), seq);
+        auto it = uut.lower_bound(seq_num);
+        EXPECT_EQ(expected - sequences.begin(), it - uut.begin());
+
+        it = uut.find(seq_num);
+        if (sequences.end() != expected && *expected == seq)
+        {
+            ASSERT_NE(uut.end(), it);
+            EXPECT_EQ(seq_num, it->getSequenceNumber());
+        }
+        else
+        {
+            EXPECT_EQ(uut.end(), it);
+        }
+    }
+
+    // Fill a hole keeping the order
+    auto it = uut.insert(make_change(7));
+    EXPECT_EQ(SequenceNumber_t(0, 7), it->getSequenceNumber());
+    EXPECT_EQ(SequenceNumber_t(0, 5), std::prev(it)->getSequenceNumber());
+    EXPECT_EQ(SequenceNumber_t(0, 9), std::next(it)->getSequenceNumber());
+    EXPECT_EQ(uut.begin(), uut.insert(make_change(1)));
+    EXPECT_EQ(SequenceNumber_t(0, 1), uut.front().getSequenceNumber());
+    EXPECT_EQ(SequenceNumber_t(0, 40), uut.back().getSequenceNumber());
+}
+
+TEST_F(ChangeForReaderCollectionTests, status_count)
+{
+    ChangeForReaderCollection uut(ResourceLimitedContainerConfig(0));
+    for (uint32_t seq = 1; seq <= 10; ++seq)
+    {
+        uut.push_back(make_change(seq, (seq % 2) ? UNSENT : UNACKNOWLEDGED));
+    }
+    EXPECT_EQ(5u, uut.count(UNSENT));
+    EXPECT_EQ(5u, uut.count(UNACKNOWLEDGED));
+    EXPECT_EQ(0u, uut.count(REQUESTED));
+
+    uut.set_status(uut.find(SequenceNumber_t(0, 2)), REQUESTED);
+    uut.set_status(uut.find(SequenceNumber_t(0, 4)), REQUESTED);
+    EXPECT_EQ(3u, uut.count(UNACKNOWLEDGED));
+    EXPECT_EQ(2u, uut.count(REQUESTED));
+
+    // Remove changes 1 to 3
+    uut.erase(uut.begin(), uut.find(SequenceNumber_t(0, 4)));
+    EXPECT_EQ(7u, uut.size());
+    EXPECT_EQ(3u, uut.count(UNSENT));
+    EXPECT_EQ(1u, uut.count(REQUESTED));
+
+    // Remove changes 6 and 7
+    uut.erase(uut.find(SequenceNumber_t(0, 6)), uut.find(SequenceNumber_t(0, 8)));
+    EXPECT_EQ(5u, uut.size());
+    EXPECT_EQ(2u, uut.count(UNSENT));
+    EXPECT_EQ(2u, uut.count(UNACKNOWLEDGED));
+    EXPECT_EQ(SequenceNumber_t(0, 8), uut.find(SequenceNumber_t(0, 8))->getSequenceNumber());
+
+    uut.erase(uut.find(SequenceNumber_t(0, 4)));
+    EXPECT_EQ(0u, uut.count(REQUESTED));
+
+    uut.clear();
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(0u, uut.count(UNSENT));
+    EXPECT_EQ(0u, uut.count(UNACKNOWLEDGED));
+}
+
+TEST_F(ChangeForReaderCollectionTests, maximum_size)
+{
+    ChangeForReaderCollection uut(ResourceLimitedContainerConfig(1, 3));
+    ASSERT_NE(nullptr, uut.push_back(make_change(2)));
+    ASSERT_NE(nullptr, uut.push_back(make_change(4)));
+    ASSERT_NE(uut.end(), uut.insert(make_change(3)));
+    EXPECT_EQ(3u, uut.size());
+
+    // No change is accepted once the maximum has been reached
+    EXPECT_EQ(nullptr, uut.push_back(make_change(5)));
+    EXPECT_EQ(uut.end(), uut.insert(make_change(1)));
+    EXPECT_EQ(3u, uut.size());
+    EXPECT_EQ(3u, uut.count(UNSENT));
+    EXPECT_EQ(SequenceNumber_t(0, 2), uut.front().getSequenceNumber());
+    EXPECT_EQ(SequenceNumber_t(0, 4), uut.back().getSequenceNumber());
+
+    // Room is made when a change is removed
+    uut.erase(uut.begin());
+    EXPECT_NE(nullptr, uut.push_back(make_change(5)));
+    EXPECT_EQ(3u, uut.size());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -111,6 +111,31 @@ TEST(ReaderProxyTests, find_change_removed_test)
     ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 4)));
 }
 
+TEST(ReaderProxyTests, add_change_over_limit_test)
+{
+    StatefulWriter writerMock;
+    writerMock.mp_history->m_att.initialReservedCaches = 2;
+    writerMock.mp_history->m_att.maximumReservedCaches = 2;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+    CacheChange_t seq1; seq1.sequenceNumber = {0, 1};
+    CacheChange_t seq2; seq2.sequenceNumber = {0, 2};
+    CacheChange_t seq3; seq3.sequenceNumber = {0, 3};
+    CacheChange_t seq4; seq4.sequenceNumber = {0, 4};
+
+    ASSERT_TRUE(rproxy.add_change(ChangeForReader_t(&seq1), true, false));
+    ASSERT_TRUE(rproxy.add_change(ChangeForReader_t(&seq2), true, false));
+    ASSERT_FALSE(rproxy.add_change(ChangeForReader_t(&seq3), true, false));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 1)));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 2)));
+
+    // Room is made when changes are acknowledged
+    rproxy.acked_changes_set(SequenceNumber_t(0, 3));
+    ASSERT_TRUE(rproxy.add_change(ChangeForReader_t(&seq4), true, false));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 4)));
+}
+
 // Regression test for #13556 (Github #2423)
 #ifndef __QNXNTO__
 TEST(ReaderProxyTests, requested_changes_set_test)
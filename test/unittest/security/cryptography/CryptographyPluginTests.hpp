@@ -1268,6 +1268,35 @@ TEST_F(CryptographyPluginTest, transform_SerializedPayload)
             *reader, *remote_writer, exception));
     ASSERT_TRUE(memcmp(plain_payload.data, decoded_payload.data, 18) == 0);
 
+    //Several messages in a row, going through some session key rotations
+    for (uint32_t i = 0; i < 40; ++i)
+    {
+        plain_payload.data[0] = static_cast<eprosima::fastdds::rtps::octet>(i);
+        encoded_payload.pos = 0;
+        encoded_payload.length = 0;
+        decoded_payload.pos = 0;
+        decoded_payload.length = 0;
+        ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_serialized_payload(encoded_payload, inline_qos,
+                plain_payload, *writer, exception));
+        encoded_payload.pos = 0;
+
+        if (0 == i % 10)
+        {
+            //A tampered message should be rejected, and should not affect the following ones
+            encoded_payload.data[24] ^= 0xFF;
+            ASSERT_FALSE(CryptoPlugin->cryptotransform()->decode_serialized_payload(decoded_payload, encoded_payload,
+                    inline_qos, *reader, *remote_writer, exception));
+            encoded_payload.data[24] ^= 0xFF;
+            encoded_payload.pos = 0;
+            decoded_payload.pos = 0;
+            decoded_payload.length = 0;
+        }
+
+        ASSERT_TRUE(CryptoPlugin->cryptotransform()->decode_serialized_payload(decoded_payload, encoded_payload,
+                inline_qos, *reader, *remote_writer, exception));
+        ASSERT_TRUE(memcmp(plain_payload.data, decoded_payload.data, 18) == 0);
+    }
+
     CryptoPlugin->keyfactory()->unregister_datawriter(writer, exception);
     CryptoPlugin->keyfactory()->unregister_datawriter(remote_writer, exception);
 
@@ -1586,6 +1586,120 @@ TEST_F(SHMTransportTests, buffer_recover)
     thread_listener2.join();
 }
 
+TEST_F(SHMTransportTests, alloc_buffer_multi_writer)
+{
+    constexpr uint32_t num_writers = 4u;
+    constexpr uint32_t allocations_per_writer = 1000u;
+    constexpr uint32_t buffer_size = 64u;
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    // Enough buffers for every writer to keep one allocated at any time
+    auto segment = shared_mem_manager->create_segment(buffer_size * num_writers * 4, num_writers * 4);
+
+    std::atomic<uint32_t> overflows(0u);
+    std::atomic<uint32_t> corrupted(0u);
+    std::vector<std::thread> writers;
+
+    for (uint32_t w = 0u; w < num_writers; ++w)
+    {
+        writers.emplace_back([&, w]()
+                {
+                    for (uint32_t i = 0u; i < allocations_per_writer; ++i)
+                    {
+                        try
+                        {
+                            auto buf = segment->alloc_buffer(buffer_size, std::chrono::steady_clock::time_point());
+                            memset(buf->data(), static_cast<int>(w), buffer_size);
+                            std::this_thread::yield();
+                            const uint8_t* data = static_cast<const uint8_t*>(buf->data());
+                            for (uint32_t j = 0u; j < buffer_size; ++j)
+                            {
+                                if (w != data[j])
+                                {
+                                    corrupted.fetch_add(1u);
+                                    break;
+                                }
+                            }
+                        }
+                        catch (const std::exception&)
+                        {
+                            overflows.fetch_add(1u);
+                        }
+                    }
+                });
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    // Buffers are released as soon as they are used, so the segment should never overflow
+    EXPECT_EQ(0u, overflows.load());
+    // No buffer is handed to two writers at the same time
+    EXPECT_EQ(0u, corrupted.load());
+}
+
+TEST_F(SHMTransportTests, listener_spin_ping_pong)
+{
+    constexpr uint32_t num_samples = 1000u;
+    constexpr uint32_t sample_size = 16u;
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    SharedMemGlobal* shared_mem_global = shared_mem_manager->global_segment();
+
+    // Both the blocking and the polling listeners must deliver every sample, in order
+    for (uint32_t spin_time_us : {0u, 100u})
+    {
+        shared_mem_global->remove_port(0);
+        shared_mem_global->remove_port(1);
+
+        auto ping_read = shared_mem_manager->open_port(0, 64, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+        auto pong_read = shared_mem_manager->open_port(1, 64, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+        auto ping_listener = ping_read->create_listener(spin_time_us);
+        auto pong_listener = pong_read->create_listener(spin_time_us);
+        auto ping_write = shared_mem_manager->open_port(0, 64, 1000, SharedMemGlobal::Port::OpenMode::Write);
+        auto pong_write = shared_mem_manager->open_port(1, 64, 1000, SharedMemGlobal::Port::OpenMode::Write);
+        auto segment = shared_mem_manager->create_segment(sample_size * 64, 64);
+
+        std::thread thread_echo([&]
+                {
+                    for (uint32_t i = 0u; i < num_samples; ++i)
+                    {
+                        auto recv_sample = ping_listener->pop();
+                        ASSERT_TRUE(recv_sample != nullptr);
+                        ASSERT_EQ(i, *static_cast<uint32_t*>(recv_sample->data()));
+                        ping_listener->stop_processing_buffer();
+
+                        auto sample_to_send = segment->alloc_buffer(sample_size, std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(100));
+                        memcpy(sample_to_send->data(), recv_sample->data(), sample_size);
+                        recv_sample.reset();
+                        bool is_port_ok = false;
+                        ASSERT_TRUE(pong_write->try_push(sample_to_send, is_port_ok));
+                    }
+                });
+
+        for (uint32_t i = 0u; i < num_samples; ++i)
+        {
+            auto sample_to_send = segment->alloc_buffer(sample_size, std::chrono::steady_clock::now() +
+                            std::chrono::milliseconds(100));
+            memset(sample_to_send->data(), 0, sample_size);
+            *static_cast<uint32_t*>(sample_to_send->data()) = i;
+            bool is_port_ok = false;
+            ASSERT_TRUE(ping_write->try_push(sample_to_send, is_port_ok));
+            sample_to_send.reset();
+
+            auto recv_sample = pong_listener->pop();
+            ASSERT_TRUE(recv_sample != nullptr);
+            ASSERT_EQ(i, *static_cast<uint32_t*>(recv_sample->data()));
+            pong_listener->stop_processing_buffer();
+        }
+
+        thread_echo.join();
+    }
+}
+
 TEST_F(SHMTransportTests, remote_segments_free)
 {
     uint32_t num_participants = 100;
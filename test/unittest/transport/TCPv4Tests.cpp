@@ -12,13 +12,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <asio.hpp>
 #include <gtest/gtest.h>
 
+#ifdef __linux__
+#include <pthread.h>
+#endif // ifdef __linux__
+
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/common/LocatorList.hpp>
 #include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
@@ -2440,6 +2448,241 @@ TEST_F(TCPv4Tests, add_logical_port_on_send_resource_creation)
     }
 }
 
+// Reference for the block version of addToCRC, adding the bytes one by one.
+static uint32_t add_to_crc_bytewise(
+        uint32_t crc,
+        const octet* data,
+        size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        RTCPMessageManager::addToCRC(crc, data[i]);
+    }
+    return crc;
+}
+
+// This test checks that adding a block of bytes to a CRC gives the same result as adding them one by one.
+TEST_F(TCPv4Tests, add_block_to_crc)
+{
+    // Some extra bytes, so blocks of every size can start at every offset
+    std::vector<octet> data(1500 + 8);
+    uint32_t seed = 1;
+    for (octet& byte : data)
+    {
+        seed = seed * 1103515245u + 12345u;
+        byte = static_cast<octet>(seed >> 16);
+    }
+    std::vector<octet> zeros(data.size(), 0x00);
+    std::vector<octet> ones(data.size(), 0xFF);
+
+    // Odd lengths, lengths around the words and groups of words, and unaligned offsets
+    for (uint32_t initial_crc : {0u, 1u, 0xFFFFu, 0xFFFFFF00u, 0xFFFFFFFEu, 0xFFFFFFFFu})
+    {
+        for (size_t offset = 0; offset < 8; ++offset)
+        {
+            for (size_t size : {0u, 1u, 3u, 7u, 8u, 9u, 15u, 17u, 63u, 1023u, 1024u, 1025u, 1031u, 1499u, 1500u})
+            {
+                for (const std::vector<octet>* block : {&data, &zeros, &ones})
+                {
+                    const octet* begin = block->data() + offset;
+                    EXPECT_EQ(add_to_crc_bytewise(initial_crc, begin, size),
+                            RTCPMessageManager::addToCRC(initial_crc, begin, size))
+                        << "Initial CRC " << initial_crc << ", " << size << " bytes at offset " << offset
+                        << " starting with " << uint32_t(*begin);
+                }
+            }
+        }
+    }
+
+    // Adding the buffers of a message one after the other is the same as adding the whole message
+    uint32_t expected = add_to_crc_bytewise(0, data.data(), data.size());
+    for (size_t chunk : {1u, 3u, 7u, 8u, 13u, 100u, 1021u})
+    {
+        uint32_t crc = 0;
+        for (size_t pos = 0; pos < data.size(); pos += chunk)
+        {
+            crc = RTCPMessageManager::addToCRC(crc, data.data() + pos, (std::min)(chunk, data.size() - pos));
+        }
+        EXPECT_EQ(expected, crc) << "Chunks of " << chunk << " bytes";
+    }
+}
+
+#ifndef __APPLE__
+// This test checks the exchange of messages between two transports receiving with reactor threads.
+TEST_F(TCPv4Tests, send_and_receive_between_ports_with_reactor_threads)
+{
+    uint16_t port = static_cast<uint16_t>(g_default_port + 3);
+
+    TCPv4TransportDescriptor recvDescriptor;
+    recvDescriptor.add_listener_port(port);
+    recvDescriptor.reactor_threads = 2;
+    TCPv4Transport receiveTransportUnderTest(recvDescriptor);
+    ASSERT_TRUE(receiveTransportUnderTest.init());
+
+    TCPv4TransportDescriptor sendDescriptor;
+    sendDescriptor.reactor_threads = 2;
+    TCPv4Transport sendTransportUnderTest(sendDescriptor);
+    ASSERT_TRUE(sendTransportUnderTest.init());
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_TCPv4;
+    inputLocator.port = port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(inputLocator, 7410);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(inputLocator);
+
+    MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(send_resource_list, inputLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    // Messages of different sizes, bigger than the initial reception buffer, split in several buffers
+    constexpr uint32_t num_messages = 20;
+    std::vector<octet> message(30000);
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<octet>(i);
+    }
+
+    Semaphore sem;
+    uint32_t num_received = 0;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message.data(), msg_recv->data, 5), 0);
+                if (++num_received == num_messages)
+                {
+                    sem.post();
+                }
+            };
+    msg_recv->setCallback(recCallback);
+
+    bool sent = false;
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        uint32_t size = static_cast<uint32_t>(message.size() / num_messages * (i + 1));
+        std::vector<NetworkBuffer> buffer_list;
+        buffer_list.emplace_back(message.data(), size / 2);
+        buffer_list.emplace_back(message.data() + size / 2, size - size / 2);
+
+        do
+        {
+            Locators input_begin(locator_list.begin());
+            Locators input_end(locator_list.end());
+            sent = send_resource_list.at(0)->send(buffer_list, size, &input_begin, &input_end,
+                            (std::chrono::steady_clock::now() + std::chrono::seconds(1)));
+            if (!sent)
+            {
+                // Wait for the connection to be established
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        } while (!sent);
+    }
+
+    sem.wait();
+    EXPECT_EQ(num_messages, num_received);
+}
+
+// This test checks that the messages of several connections are received, and only by the reactor threads.
+TEST_F(TCPv4Tests, receive_from_several_connections_with_reactor_threads)
+{
+    constexpr uint16_t logical_port = 7410;
+    constexpr size_t num_connections = 4;
+    constexpr uint32_t messages_per_connection = 10;
+    constexpr uint32_t message_size = 1000;
+
+    struct Receiver : public TransportReceiverInterface
+    {
+        std::atomic<uint32_t> num_received{0};
+        std::atomic<uint32_t> num_wrong_thread{0};
+
+        void OnDataReceived(
+                const octet* /*data*/,
+                const uint32_t size,
+                const Locator_t& /*local_locator*/,
+                const Locator_t& /*remote_locator*/) override
+        {
+#ifdef __linux__
+            char name[16] = {0};
+            pthread_getname_np(pthread_self(), name, sizeof(name));
+            if (0 != std::string(name).find("dds.tcp_io."))
+            {
+                num_wrong_thread.fetch_add(1);
+            }
+#endif // ifdef __linux__
+            if (message_size == size)
+            {
+                num_received.fetch_add(1);
+            }
+        }
+
+    };
+
+    std::vector<octet> message(TCPHeader::size() + message_size, 0);
+    TCPHeader header;
+    header.logical_port = logical_port;
+    header.length += message_size;
+    memcpy(message.data(), header.address(), TCPHeader::size());
+
+    uint16_t port = static_cast<uint16_t>(g_default_port + 4);
+    Receiver receiver;
+
+    TCPv4TransportDescriptor test_descriptor;
+    test_descriptor.add_listener_port(port);
+    test_descriptor.check_crc = false;
+    test_descriptor.reactor_threads = 2;
+    TCPv4Transport uut(test_descriptor);
+    ASSERT_TRUE(uut.init()) << "Failed to initialize transport. Port " << port << " may be in use";
+
+    Locator_t input_locator;
+    input_locator.kind = LOCATOR_KIND_TCPv4;
+    input_locator.port = port;
+    IPLocator::setIPv4(input_locator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(input_locator, logical_port);
+    EXPECT_TRUE(uut.OpenInputChannel(input_locator, &receiver, 0xFFFF));
+
+    asio::io_context ctx;
+    asio::ip::tcp::endpoint destination;
+    destination.port(port);
+    destination.address(asio::ip::address::from_string("127.0.0.1"));
+    std::vector<std::unique_ptr<asio::ip::tcp::socket>> clients;
+    for (size_t i = 0; i < num_connections; ++i)
+    {
+        asio::error_code ec;
+        clients.emplace_back(new asio::ip::tcp::socket(ctx));
+        clients.back()->connect(destination, ec);
+        ASSERT_TRUE(!ec) << ec;
+    }
+
+    for (uint32_t i = 0; i < messages_per_connection; ++i)
+    {
+        for (auto& client : clients)
+        {
+            asio::error_code ec;
+            asio::write(*client, asio::buffer(message.data(), message.size()), ec);
+            ASSERT_TRUE(!ec) << ec;
+        }
+    }
+
+    uint32_t expected = static_cast<uint32_t>(num_connections * messages_per_connection);
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (receiver.num_received < expected && std::chrono::steady_clock::now() < timeout)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(expected, receiver.num_received.load());
+    EXPECT_EQ(0u, receiver.num_wrong_thread.load());
+
+    clients.clear();
+    uut.CloseInputChannel(input_locator);
+}
+#endif // ifndef __APPLE__
+
 void TCPv4Tests::HELPER_SetDescriptorDefaults()
 {
     descriptor.add_listener_port(g_default_port);
@@ -306,6 +306,142 @@ TEST_F(UDPv4Tests, send_to_loopback)
     senderThread->join();
     sem.wait();
 }
+
+TEST_F(UDPv4Tests, send_and_receive_with_receive_batch)
+{
+    constexpr uint32_t num_messages = 64;
+
+    descriptor.receive_batch_size = 16;
+    UDPv4Transport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_UDPv4;
+    inputLocator.port = g_default_port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+
+    MockReceiverResource receiver(transportUnderTest, inputLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    eprosima::fastdds::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, inputLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(inputLocator));
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    std::vector<NetworkBuffer> buffer_list;
+    buffer_list.emplace_back(message, sizeof(message));
+
+    std::atomic<uint32_t> received(0);
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                if (num_messages == ++received)
+                {
+                    sem.post();
+                }
+            };
+
+    msg_recv->setCallback(recCallback);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(inputLocator);
+
+    // Send a burst, so several datagrams are queued on the socket before the reception thread wakes up.
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(buffer_list, sizeof(message), &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    sem.wait();
+    EXPECT_EQ(num_messages, received.load());
+    EXPECT_EQ(num_messages, transportUnderTest.received_datagrams());
+    // The last call is the one blocked waiting for more datagrams, which may or may not have been counted yet.
+    EXPECT_LE(transportUnderTest.receive_system_calls(), num_messages + 1);
+}
+
+TEST_F(UDPv4Tests, init_fails_with_oversized_receive_batch)
+{
+    descriptor.receive_batch_size = 1024;
+    UDPv4Transport accepted_transport(descriptor);
+    EXPECT_TRUE(accepted_transport.init());
+
+    descriptor.receive_batch_size = 1025;
+    UDPv4Transport rejected_transport(descriptor);
+    EXPECT_FALSE(rejected_transport.init());
+}
+
+TEST_F(UDPv4Tests, init_fails_with_oversized_send_batch)
+{
+    descriptor.send_batch_size = 1024;
+    UDPv4Transport accepted_transport(descriptor);
+    EXPECT_TRUE(accepted_transport.init());
+
+    descriptor.send_batch_size = 1025;
+    UDPv4Transport rejected_transport(descriptor);
+    EXPECT_FALSE(rejected_transport.init());
+}
+
+TEST_F(UDPv4Tests, send_and_receive_with_send_batch)
+{
+    constexpr size_t num_destinations = 4;
+
+    descriptor.send_batch_size = 8;
+    UDPv4Transport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locator_list;
+    std::vector<std::unique_ptr<MockReceiverResource>> receivers;
+    std::atomic<size_t> received(0);
+    Semaphore sem;
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        Locator_t inputLocator;
+        inputLocator.kind = LOCATOR_KIND_UDPv4;
+        inputLocator.port = g_default_port + static_cast<uint32_t>(i);
+        IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+        locator_list.push_back(inputLocator);
+
+        receivers.emplace_back(new MockReceiverResource(transportUnderTest, inputLocator));
+        MockMessageReceiver* msg_recv =
+                dynamic_cast<MockMessageReceiver*>(receivers.back()->CreateMessageReceiver());
+        msg_recv->setCallback([&, msg_recv]()
+                {
+                    EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                    ++received;
+                    sem.post();
+                });
+        ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(inputLocator));
+    }
+
+    eprosima::fastdds::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, locator_list[0]));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    std::vector<NetworkBuffer> buffer_list;
+    buffer_list.emplace_back(message, sizeof(message));
+
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send(buffer_list, sizeof(message), &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        sem.wait();
+    }
+    EXPECT_EQ(num_destinations, received.load());
+    EXPECT_EQ(num_destinations, transportUnderTest.sent_datagrams());
+#if defined(__linux__)
+    EXPECT_EQ(1u, transportUnderTest.send_system_calls());
+#endif // if defined(__linux__)
+}
 #endif // ifndef __APPLE__
 
 TEST_F(UDPv4Tests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
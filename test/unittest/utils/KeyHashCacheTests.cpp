@@ -0,0 +1,124 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/utils/md5.h>
+
+#include <utils/KeyHashCache.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+static InstanceHandle_t md5_handle(
+        const std::string& key)
+{
+    MD5 md5;
+    md5.update(key.data(), static_cast<MD5::size_type>(key.size()));
+    md5.finalize();
+
+    InstanceHandle_t ret;
+    memcpy(ret.value, md5.digest, 16);
+    return ret;
+}
+
+// Test suite from RFC 1321
+TEST(KeyHashCacheTests, md5_test_suite)
+{
+    EXPECT_EQ("d41d8cd98f00b204e9800998ecf8427e", md5(""));
+    EXPECT_EQ("0cc175b9c0f1b6a831c399e269772661", md5("a"));
+    EXPECT_EQ("900150983cd24fb0d6963f7d28e17f72", md5("abc"));
+    EXPECT_EQ("f96b697d7cb7938d525a2f31aaf161d0", md5("message digest"));
+    EXPECT_EQ("c3fcd3d76192e4007dfb496cca67e13b", md5("abcdefghijklmnopqrstuvwxyz"));
+    EXPECT_EQ("d174ab98d277d9f5a5611c2c9f419d9f",
+            md5("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789"));
+    EXPECT_EQ("57edf4a22be3c955ac49da2e2107b67a",
+            md5("12345678901234567890123456789012345678901234567890123456789012345678901234567890"));
+
+    // Feeding the data in several pieces gives the same result
+    std::string text = "12345678901234567890123456789012345678901234567890123456789012345678901234567890";
+    MD5 md5_pieces;
+    md5_pieces.update(text.data(), 7);
+    md5_pieces.update(text.data() + 7, 64);
+    md5_pieces.update(text.data() + 71, static_cast<MD5::size_type>(text.size() - 71));
+    EXPECT_EQ("57edf4a22be3c955ac49da2e2107b67a", md5_pieces.finalize().hexdigest());
+}
+
+TEST(KeyHashCacheTests, find_and_replace)
+{
+    KeyHashCache uut(5);
+    EXPECT_EQ(8u, uut.capacity());
+
+    std::string key_a(40, 'a');
+    std::string key_b(40, 'b');
+    const unsigned char* data_a = reinterpret_cast<const unsigned char*>(key_a.data());
+    const unsigned char* data_b = reinterpret_cast<const unsigned char*>(key_b.data());
+    InstanceHandle_t handle;
+
+    EXPECT_FALSE(uut.find(data_a, key_a.size(), handle));
+    uut.insert(data_a, key_a.size(), md5_handle(key_a));
+    ASSERT_TRUE(uut.find(data_a, key_a.size(), handle));
+    EXPECT_EQ(md5_handle(key_a), handle);
+
+    // A prefix of a cached key is a different key
+    EXPECT_FALSE(uut.find(data_a, key_a.size() - 1, handle));
+
+    // Keys colliding on the same entry replace each other, but are never mixed up
+    KeyHashCache single(1);
+    single.insert(data_a, key_a.size(), md5_handle(key_a));
+    EXPECT_FALSE(single.find(data_b, key_b.size(), handle));
+    single.insert(data_b, key_b.size(), md5_handle(key_b));
+    ASSERT_TRUE(single.find(data_b, key_b.size(), handle));
+    EXPECT_EQ(md5_handle(key_b), handle);
+    EXPECT_FALSE(single.find(data_a, key_a.size(), handle));
+}
+
+TEST(KeyHashCacheTests, many_keys)
+{
+    KeyHashCache uut(1024);
+    std::vector<std::string> keys;
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        keys.push_back("sensors/building_" + std::to_string(i % 16) + "/floor_" + std::to_string(i / 16));
+        uut.insert(reinterpret_cast<const unsigned char*>(keys.back().data()), keys.back().size(),
+                md5_handle(keys.back()));
+    }
+
+    uint32_t hits = 0;
+    for (const std::string& key : keys)
+    {
+        InstanceHandle_t handle;
+        if (uut.find(reinterpret_cast<const unsigned char*>(key.data()), key.size(), handle))
+        {
+            EXPECT_EQ(md5_handle(key), handle);
+            ++hits;
+        }
+    }
+
+    // Similar keys should be spread over the entries
+    EXPECT_LE(200u, hits);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,168 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/utils/collections/RingVector.hpp>
+
+using namespace eprosima::fastdds;
+
+template<typename Collection>
+static void expect_equal(
+        const std::vector<int>& expected,
+        const Collection& uut)
+{
+    ASSERT_EQ(expected.size(), uut.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), uut.begin()));
+    EXPECT_TRUE(std::equal(expected.rbegin(), expected.rend(), uut.rbegin()));
+}
+
+TEST(RingVectorTests, push_pop_both_ends)
+{
+    RingVector<int> uut;
+    EXPECT_TRUE(uut.empty());
+
+    std::vector<int> expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        uut.push_back(i);
+        expected.push_back(i);
+        if (0 == i % 3)
+        {
+            uut.pop_front();
+            expected.erase(expected.begin());
+        }
+        expect_equal(expected, uut);
+    }
+    EXPECT_EQ(expected.front(), uut.front());
+    EXPECT_EQ(expected.back(), uut.back());
+
+    uut.push_front(-1);
+    expected.insert(expected.begin(), -1);
+    uut.pop_back();
+    expected.pop_back();
+    expect_equal(expected, uut);
+
+    uut.clear();
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(uut.begin(), uut.end());
+}
+
+TEST(RingVectorTests, insert_erase_middle)
+{
+    std::mt19937 rng(1);
+    RingVector<int> uut;
+    std::vector<int> expected;
+
+    for (int n = 0; n < 5000; ++n)
+    {
+        int value = static_cast<int>(rng() % 1000);
+        size_t pos = expected.empty() ? 0 : rng() % expected.size();
+        if (rng() % 3 != 0 || expected.empty())
+        {
+            auto it = uut.insert(uut.begin() + pos, value);
+            expected.insert(expected.begin() + pos, value);
+            EXPECT_EQ(value, *it);
+        }
+        else
+        {
+            auto it = uut.erase(uut.cbegin() + pos);
+            auto expected_it = expected.erase(expected.begin() + pos);
+            EXPECT_EQ(expected_it - expected.begin(), it - uut.begin());
+        }
+        if (0 == rng() % 7)
+        {
+            uut.pop_front();
+            expected.erase(expected.begin());
+        }
+    }
+    expect_equal(expected, uut);
+
+    RingVector<int> copy(uut);
+    expect_equal(expected, copy);
+}
+
+TEST(RingVectorTests, random_access_iterators)
+{
+    RingVector<int> uut;
+    uut.reserve(16);
+    EXPECT_EQ(16u, uut.capacity());
+
+    // Wrap around the end of the underlying buffer
+    for (int i = 0; i < 12; ++i)
+    {
+        uut.push_back(i * 2);
+    }
+    for (int i = 0; i < 10; ++i)
+    {
+        uut.pop_front();
+        uut.push_back(24 + i * 2);
+    }
+    EXPECT_EQ(16u, uut.capacity());
+
+    RingVector<int>::const_iterator it = std::lower_bound(uut.cbegin(), uut.cend(), 33);
+    ASSERT_NE(uut.cend(), it);
+    EXPECT_EQ(34, *it);
+    EXPECT_EQ(static_cast<ptrdiff_t>(uut.size()), std::distance(uut.cbegin(), uut.cend()));
+    EXPECT_TRUE(uut.begin() < it);
+    EXPECT_EQ(uut[it - uut.cbegin()], *it);
+    EXPECT_EQ(uut.back(), *(uut.end() - 1));
+}
+
+/*!
+ * Writes on a full KEEP_LAST history: each new change is added at the back, and the oldest one is removed from the
+ * front, wrapping around the buffer several times.
+ */
+TEST(RingVectorTests, keep_last_writes)
+{
+    constexpr uint64_t depth = 100;
+    constexpr uint64_t num_writes = 1000;
+
+    std::vector<uint64_t> vector;
+    RingVector<uint64_t> ring;
+    for (uint64_t sn = 0; sn < depth; ++sn)
+    {
+        vector.push_back(sn);
+        ring.push_back(sn);
+    }
+    size_t capacity = ring.capacity();
+
+    for (uint64_t sn = depth; sn < depth + num_writes; ++sn)
+    {
+        vector.erase(vector.begin());
+        vector.push_back(sn);
+        ring.pop_front();
+        ring.push_back(sn);
+    }
+
+    EXPECT_EQ(capacity, ring.capacity());
+    ASSERT_EQ(vector.size(), ring.size());
+    EXPECT_TRUE(std::equal(vector.begin(), vector.end(), ring.begin()));
+    // Sequence numbers are still sorted, so they can be searched
+    uint64_t middle = depth / 2 + num_writes;
+    EXPECT_EQ(middle, *std::lower_bound(ring.begin(), ring.end(), middle));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
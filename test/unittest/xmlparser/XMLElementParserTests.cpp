@@ -2186,6 +2186,122 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList)
     }
 }
 
+/*
+ * This test checks the parsing of the num_sender_threads element of <flow_controller_descriptor>
+ * 1. Check that a valid value is parsed, and that 1 is the default value
+ * 2. Check that zero, non numeric and duplicated values are rejected
+ */
+TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList_num_sender_threads)
+{
+    uint8_t ident = 1;
+
+    /* Define the test cases: num_sender_threads element, expected value */
+    std::vector<std::pair<std::pair<std::string, uint32_t>, XMLP_ret>> test_cases =
+    {
+        {{"", 1u}, XMLP_ret::XML_OK},
+        {{"<num_sender_threads>1</num_sender_threads>", 1u}, XMLP_ret::XML_OK},
+        {{"<num_sender_threads>4</num_sender_threads>", 4u}, XMLP_ret::XML_OK},
+        {{"<num_sender_threads>0</num_sender_threads>", 0u}, XMLP_ret::XML_ERROR},
+        {{"<num_sender_threads>many</num_sender_threads>", 0u}, XMLP_ret::XML_ERROR},
+        {{"<num_sender_threads>2</num_sender_threads><num_sender_threads>2</num_sender_threads>", 0u},
+            XMLP_ret::XML_ERROR},
+    };
+
+    /* Run the tests */
+    for (auto test_case : test_cases)
+    {
+        const std::string& num_sender_threads_xml = test_case.first.first;
+        XMLP_ret& expectation = test_case.second;
+
+        using namespace eprosima::fastdds::rtps;
+        XMLParserTest::FlowControllerDescriptorList flow_controller_descriptor_list;
+        tinyxml2::XMLDocument xml_doc;
+        tinyxml2::XMLElement* titleElement;
+
+        // Create XML snippet
+        std::string xml =
+                "<flow_controller_descriptor_list>"
+                "   <flow_controller_descriptor>"
+                "       <name>test_flow_controller</name>"
+                "       <max_bytes_per_period>2500</max_bytes_per_period>"
+                + num_sender_threads_xml +
+                "   </flow_controller_descriptor>"
+                "</flow_controller_descriptor_list>";
+
+        // Parse the XML snippet
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml.c_str())) << xml;
+
+        // Extract FlowControllersDescriptors
+        titleElement = xml_doc.RootElement();
+        ASSERT_EQ(expectation,
+                XMLParserTest::getXMLFlowControllerDescriptorList_wrapper(titleElement, flow_controller_descriptor_list,
+                ident)) << xml;
+
+        // Validate in the OK cases
+        if (expectation == XMLP_ret::XML_OK)
+        {
+            ASSERT_EQ(flow_controller_descriptor_list.at(0)->num_sender_threads, test_case.first.second);
+        }
+    }
+}
+
+/*
+ * This test checks the parsing of the max_burst_bytes element of <flow_controller_descriptor>
+ * 1. Check that a positive value is parsed, and that 0 is the default value
+ * 2. Check that zero, negative and non numeric values are rejected
+ */
+TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList_max_burst_bytes)
+{
+    uint8_t ident = 1;
+
+    /* Define the test cases: max_burst_bytes element, expected value */
+    std::vector<std::pair<std::pair<std::string, int32_t>, XMLP_ret>> test_cases =
+    {
+        {{"", 0}, XMLP_ret::XML_OK},
+        {{"<max_burst_bytes>1000</max_burst_bytes>", 1000}, XMLP_ret::XML_OK},
+        {{"<max_burst_bytes>0</max_burst_bytes>", 0}, XMLP_ret::XML_ERROR},
+        {{"<max_burst_bytes>-1000</max_burst_bytes>", 0}, XMLP_ret::XML_ERROR},
+        {{"<max_burst_bytes>burst</max_burst_bytes>", 0}, XMLP_ret::XML_ERROR},
+    };
+
+    /* Run the tests */
+    for (auto test_case : test_cases)
+    {
+        const std::string& max_burst_bytes_xml = test_case.first.first;
+        XMLP_ret& expectation = test_case.second;
+
+        using namespace eprosima::fastdds::rtps;
+        XMLParserTest::FlowControllerDescriptorList flow_controller_descriptor_list;
+        tinyxml2::XMLDocument xml_doc;
+        tinyxml2::XMLElement* titleElement;
+
+        // Create XML snippet
+        std::string xml =
+                "<flow_controller_descriptor_list>"
+                "   <flow_controller_descriptor>"
+                "       <name>test_flow_controller</name>"
+                "       <max_bytes_per_period>2500</max_bytes_per_period>"
+                + max_burst_bytes_xml +
+                "   </flow_controller_descriptor>"
+                "</flow_controller_descriptor_list>";
+
+        // Parse the XML snippet
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml.c_str())) << xml;
+
+        // Extract FlowControllersDescriptors
+        titleElement = xml_doc.RootElement();
+        ASSERT_EQ(expectation,
+                XMLParserTest::getXMLFlowControllerDescriptorList_wrapper(titleElement, flow_controller_descriptor_list,
+                ident)) << xml;
+
+        // Validate in the OK cases
+        if (expectation == XMLP_ret::XML_OK)
+        {
+            ASSERT_EQ(flow_controller_descriptor_list.at(0)->max_burst_bytes, test_case.first.second);
+        }
+    }
+}
+
 /*
  * This test checks the negative cases in the xml child element of <flow_controller_descriptor_list>
  * 1. Check an invalid tag of:
@@ -890,6 +890,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <receiveBufferSize>8192</receiveBufferSize>\
                     <TTL>250</TTL>\
                     <non_blocking_send>false</non_blocking_send>\
+                    <receive_batch_size>32</receive_batch_size>\
+                    <send_batch_size>16</send_batch_size>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                     <interfaceWhiteList>\
@@ -949,7 +951,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     </reception_threads>\
                 </transport_descriptor>\
                 ";
-        constexpr size_t xml_len {3500};
+        constexpr size_t xml_len {4000};
         char xml[xml_len];
 
         // UDPv4
@@ -964,6 +966,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv4Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv4Desc->TTL, 250u);
         EXPECT_EQ(pUDPv4Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv4Desc->receive_batch_size, 32u);
+        EXPECT_EQ(pUDPv4Desc->send_batch_size, 16u);
         EXPECT_EQ(pUDPv4Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv4Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -993,6 +997,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv6Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv6Desc->TTL, 250u);
         EXPECT_EQ(pUDPv6Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv6Desc->receive_batch_size, 32u);
+        EXPECT_EQ(pUDPv6Desc->send_batch_size, 16u);
         EXPECT_EQ(pUDPv6Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv6Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv6Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -1054,6 +1060,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <enable_tcp_nodelay>false</enable_tcp_nodelay>\
                     <non_blocking_send>true</non_blocking_send>\
                     <tcp_negotiation_timeout>100</tcp_negotiation_timeout>\
+                    <reactor_threads>4</reactor_threads>\
                     <tls><!-- TLS Section --></tls>\
                     <keep_alive_thread>\
                         <scheduling_policy>12</scheduling_policy>\
@@ -1127,6 +1134,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv4Desc->non_blocking_send, true);
         EXPECT_EQ(pTCPv4Desc->accept_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->tcp_negotiation_timeout, 100u);
+        EXPECT_EQ(pTCPv4Desc->reactor_threads, 4u);
         EXPECT_EQ(pTCPv4Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->get_thread_config_for_port(12346), modified_thread_settings);
@@ -1163,6 +1171,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv6Desc->non_blocking_send, true);
         EXPECT_EQ(pTCPv6Desc->accept_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->tcp_negotiation_timeout, 100u);
+        EXPECT_EQ(pTCPv6Desc->reactor_threads, 4u);
         EXPECT_EQ(pTCPv6Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->get_thread_config_for_port(12346), modified_thread_settings);
@@ -1182,6 +1191,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <segment_size>262144</segment_size>\
                     <port_queue_capacity>512</port_queue_capacity>\
                     <healthy_check_timeout_ms>1000</healthy_check_timeout_ms>\
+                    <listener_spin_time_us>50</listener_spin_time_us>\
                     <rtps_dump_file>rtsp_messages.log</rtps_dump_file>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
@@ -1223,6 +1233,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pSHMDesc->segment_size(), 262144u);
         EXPECT_EQ(pSHMDesc->port_queue_capacity(), 512u);
         EXPECT_EQ(pSHMDesc->healthy_check_timeout_ms(), 1000u);
+        EXPECT_EQ(pSHMDesc->listener_spin_time_us(), 50u);
         EXPECT_EQ(pSHMDesc->rtps_dump_file(), "rtsp_messages.log");
         EXPECT_EQ(pSHMDesc->max_message_size(), 16384u);
         EXPECT_EQ(pSHMDesc->max_initial_peers_range(), 100u);
@@ -1259,6 +1270,8 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "receiveBufferSize",
         "TTL",
         "non_blocking_send",
+        "receive_batch_size",
+        "send_batch_size",
         "interfaceWhiteList",
         "netmask_filter",
         "interfaces",
@@ -1291,6 +1304,7 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "keep_alive_thread",
         "accept_thread",
         "tcp_negotiation_timeout",
+        "reactor_threads",
         "default_reception_threads",
         "reception_threads",
         "bad_element"
@@ -1303,6 +1317,7 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "segment_size",
         "port_queue_capacity",
         "healthy_check_timeout_ms",
+        "listener_spin_time_us",
         "rtps_dump_file",
         "default_reception_threads",
         "reception_threads",
@@ -3664,6 +3664,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
         ThreadSettings timed_events_thread;
         ThreadSettings discovery_server_thread;
         ThreadSettings builtin_transports_reception_threads;
+        ThreadSettings persistence_commit_thread;
 #if HAVE_SECURITY
         ThreadSettings security_log_thread;
 #endif // if HAVE_SECURITY
@@ -3701,6 +3702,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             default_thread_settings,
             default_thread_settings,
             default_thread_settings,
+            default_thread_settings,
 #if HAVE_SECURITY
             default_thread_settings
 #endif // if HAVE_SECURITY
@@ -3728,6 +3730,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             default_thread_settings,
             default_thread_settings,
             default_thread_settings,
+            default_thread_settings,
 #if HAVE_SECURITY
             default_thread_settings
 #endif // if HAVE_SECURITY
@@ -3755,6 +3758,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             modified_thread_settings,
             default_thread_settings,
             default_thread_settings,
+            default_thread_settings,
 #if HAVE_SECURITY
             default_thread_settings
 #endif // if HAVE_SECURITY
@@ -3782,6 +3786,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             modified_thread_settings,
             default_thread_settings,
             default_thread_settings,
+            default_thread_settings,
 #if HAVE_SECURITY
             default_thread_settings
 #endif // if HAVE_SECURITY
@@ -3809,6 +3814,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             default_thread_settings,
             modified_thread_settings,
             default_thread_settings,
+            default_thread_settings,
 #if HAVE_SECURITY
             default_thread_settings
 #endif // if HAVE_SECURITY
@@ -3836,6 +3842,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             default_thread_settings,
             modified_thread_settings,
             default_thread_settings,
+            default_thread_settings,
 #if HAVE_SECURITY
             default_thread_settings
 #endif // if HAVE_SECURITY
@@ -3863,6 +3870,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             default_thread_settings,
             default_thread_settings,
             modified_thread_settings,
+            default_thread_settings,
 #if HAVE_SECURITY
             default_thread_settings
 #endif // if HAVE_SECURITY
@@ -3890,6 +3898,63 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             default_thread_settings,
             default_thread_settings,
             modified_thread_settings,
+            default_thread_settings,
+#if HAVE_SECURITY
+            default_thread_settings
+#endif // if HAVE_SECURITY
+        },
+        {
+            "persistence_commit_thread_ok",
+            R"(
+                <?xml version="1.0" encoding="UTF-8" ?>
+                <dds xmlns="http://www.eprosima.com">
+                    <profiles>
+                        <participant profile_name="participant" is_default_profile="true">
+                        <rtps>
+                            <persistence_commit_thread>
+                                <scheduling_policy>12</scheduling_policy>
+                                <priority>12</priority>
+                                <affinity>12</affinity>
+                                <stack_size>12</stack_size>
+                            </persistence_commit_thread>
+                        </rtps>
+                        </participant>
+                    </profiles>
+                </dds>)",
+            xmlparser::XMLP_ret::XML_OK,
+            default_thread_settings,
+            default_thread_settings,
+            default_thread_settings,
+            default_thread_settings,
+            modified_thread_settings,
+#if HAVE_SECURITY
+            default_thread_settings
+#endif // if HAVE_SECURITY
+        },
+        {
+            "persistence_commit_thread_nok",
+            R"(
+                <?xml version="1.0" encoding="UTF-8" ?>
+                <dds xmlns="http://www.eprosima.com">
+                    <profiles>
+                        <participant profile_name="participant" is_default_profile="true">
+                        <rtps>
+                            <persistence_commit_thread>
+                                <wrong>12</wrong>
+                                <priority>12</priority>
+                                <affinity>12</affinity>
+                                <stack_size>12</stack_size>
+                            </persistence_commit_thread>
+                        </rtps>
+                        </participant>
+                    </profiles>
+                </dds>)",
+            xmlparser::XMLP_ret::XML_ERROR,
+            default_thread_settings,
+            default_thread_settings,
+            default_thread_settings,
+            default_thread_settings,
+            modified_thread_settings,
 #if HAVE_SECURITY
             default_thread_settings
 #endif // if HAVE_SECURITY
@@ -3918,6 +3983,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             default_thread_settings,
             default_thread_settings,
             default_thread_settings,
+            default_thread_settings,
             modified_thread_settings
         },
         {
@@ -3943,6 +4009,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             default_thread_settings,
             default_thread_settings,
             default_thread_settings,
+            default_thread_settings,
             modified_thread_settings
         },
 #endif // if HAVE_SECURITY
@@ -3969,6 +4036,7 @@ TEST_F(XMLProfileParserBasicTests, participant_thread_settings)
             ASSERT_EQ(profile_attr.rtps.discovery_server_thread, test.discovery_server_thread);
             ASSERT_EQ(profile_attr.rtps.builtin_transports_reception_threads,
                     test.builtin_transports_reception_threads);
+            ASSERT_EQ(profile_attr.rtps.persistence_commit_thread, test.persistence_commit_thread);
 #if HAVE_SECURITY
             ASSERT_EQ(profile_attr.rtps.security_log_thread, test.security_log_thread);
 #endif // if HAVE_SECURITY